@@ -1,5 +1,5 @@
 // Oliver Kullmann, 17.10.2009 (Swansea)
-/* Copyright 2009, 2010 Oliver Kullmann
+/* Copyright 2009, 2010, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -12,6 +12,9 @@ License, or any later version. */
   Called with parameters k and n, outputs the Green-Tao hypergraph
   in Dimacs format.
 
+  An optional third parameter T (default 1) is the number of threads used
+  for sieving the prime numbers (the output does not depend on T).
+
   \todo Use InputOutput::CLSAdaptorDIMACSOutput
   \todo Use Messages
 */
@@ -21,6 +24,7 @@ License, or any later version. */
 
 #include <boost/lexical_cast.hpp>
 
+#include <OKlib/Structures/NumberTheory/PrimeNumbers/ParallelSegmentedSieve.hpp>
 #include <OKlib/Combinatorics/Hypergraphs/Generators/GreenTao.hpp>
 
 namespace {
@@ -36,15 +40,16 @@ namespace {
   const std::string program = "GreenTao";
   const std::string err = "ERROR[" + program + "]: ";
 
-  const std::string version = "0.2";
+  const std::string version = "0.3";
 
 }
 
 int main(const int argc, const char* const argv[]) {
 
-  if (argc != 3) {
-    std::cerr << err << "Exactly two arguments are needed,\n"
-    "the length k of arithmetic progressions, and the number n of primes.\n";
+  if (argc != 3 and argc != 4) {
+    std::cerr << err << "Two or three arguments are needed,\n"
+    "the length k of arithmetic progressions, the number n of primes,\n"
+    "and optionally the number of threads for sieving.\n";
     return errcode_parameter;
   }
 
@@ -52,11 +57,12 @@ int main(const int argc, const char* const argv[]) {
 
     const uint_type k = boost::lexical_cast<uint_type>(argv[1]);
     const uint_type n = boost::lexical_cast<uint_type>(argv[2]);
+    const unsigned int threads = (argc == 4) ? boost::lexical_cast<unsigned int>(argv[3]) : 1;
 
     typedef OKlib::Combinatorics::Hypergraphs::Generators::GreenTao<uint_type> gt_generator;
     typedef gt_generator::set_system_type set_system_type;
     typedef gt_generator::hyperedge_type hyperedge_type;
-    const gt_generator g(k,n);
+    const gt_generator g(k,n,OKlib::Structures::NumberTheory::PrimeNumbers::Boost_threads_execution(threads));
 
     const set_system_type G(g.hyperedge_set());
 
@@ -73,7 +79,7 @@ int main(const int argc, const char* const argv[]) {
 
   }
   catch (boost::bad_lexical_cast&) {
-    std::cerr << err << "Both parameters must be non-negative integers\n"
+    std::cerr << err << "The parameters must be non-negative integers\n"
     "in the range given by UINT_TYPE_GT (default = unsigned long).\n";
     return(errcode_parameter_values);
   }
@@ -1,5 +1,5 @@
 // Oliver Kullmann, 17.10.2009 (Swansea)
-/* Copyright 2009 Oliver Kullmann
+/* Copyright 2009, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -18,24 +18,70 @@ License, or any later version. */
 #include <stdexcept>
 #include <limits>
 #include <utility>
+#include <iterator>
 
 #include <gmpxx.h>
 
+#include <OKlib/Structures/NumberTheory/PrimeNumbers/SegmentedSieve.hpp>
+
 namespace OKlib {
   namespace Combinatorics {
     namespace Hypergraphs {
       namespace Generators {
 
+        namespace PN = ::OKlib::Structures::NumberTheory::PrimeNumbers;
+
         /*!
           \class First_prime_numbers
           \brief Functor for computing the first n prime numbers as a std::vector
 
-          \todo Move to module Structures/NumberTheory
-
+          Using the segmented sieve from Structures/NumberTheory/PrimeNumbers
+          (up to the bound bound(n) on the n-th prime); the optional second
+          argument is the execution-policy for the sieving.
         */
 
         template <typename UInt = unsigned long>
         struct First_prime_numbers {
+          typedef UInt uint_type;
+          typedef std::vector<uint_type> range_type;
+          typedef PN::Prime_bitset<uint_type> table_type;
+          range_type operator()(const uint_type n) const {
+            return operator()(n, PN::Sequential_execution());
+          }
+          template <class Execution>
+          range_type operator()(const uint_type n, const Execution& ex) const {
+            return extract(table_type(bound(n), ex), n);
+          }
+          static uint_type bound(const uint_type n) {
+            if (n == 0) return 0;
+            const PN::sieve_index_type b = PN::nth_prime_upper_bound(n);
+            const uint_type max = std::numeric_limits<uint_type>::max();
+            return (b >= max) ? max : uint_type(b);
+          }
+          static range_type extract(const table_type& P, const uint_type n) {
+            range_type primes;
+            primes.reserve(n);
+            P.primes(std::back_inserter(primes), n);
+            if (primes.size() < n)
+              throw std::overflow_error("ERROR[First_prime_numbers]: n too big.");
+            return primes;
+          }
+        };
+        template <typename UInt>
+        typename First_prime_numbers<UInt>::range_type first_prime_numbers(const UInt n) {
+          return First_prime_numbers<UInt>()(n);
+        }
+
+        /*!
+          \class First_prime_numbers_mpz
+          \brief Computing the first n prime numbers via mpz_nextprime
+
+          The original implementation of First_prime_numbers, kept as
+          reference (for testing and benchmarking).
+        */
+
+        template <typename UInt = unsigned long>
+        struct First_prime_numbers_mpz {
           typedef UInt uint_type;
           typedef std::vector<uint_type> range_type;
           range_type operator()(uint_type n) const {
@@ -51,10 +97,6 @@ namespace OKlib {
             return primes;
           }
         };
-        template <typename UInt>
-        typename First_prime_numbers<UInt>::range_type first_prime_numbers(const UInt n) {
-          return First_prime_numbers<UInt>()(n);
-        }
 
         /*!
           \class GreenTao
@@ -66,6 +108,12 @@ namespace OKlib {
 
           The hypergraph is represented as a vector of vectors.
 
+          The primality-tests when enumerating the arithmetic progressions
+          use the bitset primes_table() (from the segmented sieve, which
+          also yields the vertex set); the optional third argument of the
+          first constructor is the execution-policy for the sieving. For
+          the second constructor V must be the first n prime numbers.
+
           \todo Complete implementation
           <ul>
            <li> DONE
@@ -105,14 +153,24 @@ namespace OKlib {
           // arithmetic progressions appears for n=22,009,064,470.
           static const unsigned int rounds_compositeness_test = 10;
 
+          typedef First_prime_numbers<vertex_type> first_primes_type;
+          typedef typename first_primes_type::table_type primes_table_type;
+
           GreenTao(const vertex_type k, const vertex_type n)
-            : k(k), prime_k(prime(k)), vertex_set_(first_prime_numbers(n)), n(n), max_prime((n==0)?0:vertex_set_.back()) {
+            : k(k), prime_k(prime(k)), primes_table_(first_primes_type::bound(n)), vertex_set_(first_primes_type::extract(primes_table_, n)), n(n), max_prime((n==0)?0:vertex_set_.back()) {
+            // C++0X: the following assert should become compile-time
+            assert(std::numeric_limits<vertex_type>::max() >= 4294967295UL);
+            assert(k <= max_k);
+          }
+          template <class Execution>
+          GreenTao(const vertex_type k, const vertex_type n, const Execution& ex)
+            : k(k), prime_k(prime(k)), primes_table_(first_primes_type::bound(n), ex), vertex_set_(first_primes_type::extract(primes_table_, n)), n(n), max_prime((n==0)?0:vertex_set_.back()) {
             // C++0X: the following assert should become compile-time
             assert(std::numeric_limits<vertex_type>::max() >= 4294967295UL);
             assert(k <= max_k);
           }
           GreenTao(const vertex_type k, const vertex_type n, const hyperedge_type& V)
-            : k(k), prime_k(prime(k)), vertex_set_(V), n(n), max_prime((n==0)?0:vertex_set_.back()) {
+            : k(k), prime_k(prime(k)), primes_table_(V.empty() ? 0 : V.back()), vertex_set_(V), n(n), max_prime((n==0)?0:vertex_set_.back()) {
             // C++0X: the following assert should become compile-time
             assert(std::numeric_limits<vertex_type>::max() >= 4294967295UL);
             assert(k <= max_k);
@@ -124,6 +182,7 @@ namespace OKlib {
           size_type nhyp() const; // XXX
 
           const hyperedge_type& vertex_set() const { return vertex_set_; }
+          const primes_table_type& primes_table() const { return primes_table_; }
 
           set_system_type hyperedge_set() const {
             set_system_type result;
@@ -152,9 +211,8 @@ namespace OKlib {
             assert(n >= 4);
             assert(k >= 3);
             assert(n > k);
-            std::vector<bool> primes_table(vertex_set_.back()+1,false);
-              for (v_it_type i = vbegin; i != vend; ++i)
-                primes_table[*i] = true;
+            const primes_table_type& primes_table(primes_table_);
+            assert(primes_table.max() >= max_prime);
             vertex_type prd_primes = 1;
             for (v_it_type i = vbegin; *i <= k; ++i)
               prd_primes *= *i;
@@ -168,7 +226,7 @@ namespace OKlib {
                 for (vertex_type d = prd_primes; d <= max_slope; d+=prd_primes) {
                   bool all_primes = true;
                   for (vertex_type i = 1, e = p-d; i < k; ++i, e -= d)
-                    if (not primes_table[e]) {all_primes = false; break;}
+                    if (not primes_table(e)) {all_primes = false; break;}
                   if (all_primes) {
                     // TODO: use progression-iterator here
                     hyperedge_type H;
@@ -184,7 +242,7 @@ namespace OKlib {
                 if (q >= 2 and (k-1)*q == p-k) {
                   bool all_primes = true;
                   for (vertex_type e = k+q; e <= p; e+= q)
-                    if (not primes_table[e]) {all_primes = false; break;}
+                    if (not primes_table(e)) {all_primes = false; break;}
                   if (all_primes) {
                     // TODO: use progression-iterator here
                     hyperedge_type H;
@@ -209,6 +267,7 @@ namespace OKlib {
 
         private :
 
+          const primes_table_type primes_table_;
           const hyperedge_type vertex_set_;
           const vertex_type n; // number of vertices
           const vertex_type max_prime; // maximal value of a vertex
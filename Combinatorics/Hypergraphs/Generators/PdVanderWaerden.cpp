@@ -1,5 +1,5 @@
 // Oliver Kullmann, 20.11.2010 (Swansea)
-/* Copyright 2010 Oliver Kullmann
+/* Copyright 2010, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -12,6 +12,11 @@ License, or any later version. */
   Called with parameters k and n, outputs the palindromised vdW-hypergraph
   in Dimacs format.
 
+  The hyperedges are streamed (via Pd_arithprog_stream, in two runs: first
+  counting, then output), using space O(n). An optional third parameter
+  specifies the number of threads (default 1); the output is the same for
+  all numbers of threads. For k = 0 there are no hyperedges.
+
   \todo Use InputOutput::CLSAdaptorDIMACSOutput
   \todo Use Messages
 */
@@ -22,6 +27,7 @@ License, or any later version. */
 #include <boost/lexical_cast.hpp>
 
 #include <OKlib/Combinatorics/Hypergraphs/Generators/VanderWaerden.hpp>
+#include <OKlib/Structures/NumberTheory/PrimeNumbers/ParallelSegmentedSieve.hpp>
 
 namespace {
 
@@ -36,15 +42,16 @@ namespace {
   const std::string program = "VanderWaerden";
   const std::string err = "ERROR[" + program + "]: ";
 
-  const std::string version = "0.1.2";
+  const std::string version = "0.2.0";
 
 }
 
 int main(const int argc, const char* const argv[]) {
 
-  if (argc != 3) {
-    std::cerr << err << "Exactly two arguments are needed,\n"
-    "the length k of arithmetic progressions, and the number n of vertices.\n";
+  if (argc != 3 and argc != 4) {
+    std::cerr << err << "Two or three arguments are needed,\n"
+    "the length k of arithmetic progressions, the number n of vertices,\n"
+    "and optionally the number of threads.\n";
     return errcode_parameter;
   }
 
@@ -52,27 +59,32 @@ int main(const int argc, const char* const argv[]) {
 
     const uint_type k = boost::lexical_cast<uint_type>(argv[1]);
     const uint_type n = boost::lexical_cast<uint_type>(argv[2]);
+    const unsigned int threads = (argc == 4) ? boost::lexical_cast<unsigned int>(argv[3]) : 1;
+    if (threads == 0) {
+      std::cerr << err << "The number of threads must be positive.\n";
+      return(errcode_parameter_values);
+    }
 
-    typedef OKlib::Combinatorics::Hypergraphs::Generators::Pd_arithprog_ohg<uint_type> vdw_generator;
-    typedef vdw_generator::set_system_type set_system_type;
-    typedef vdw_generator::hyperedge_type hyperedge_type;
+    std::cout << "c Palindromised hypergraph with arithmetic-progression length " << k << " and " << n << " vertices.\n";
+    if (k == 0) { // as before: no hyperedges
+      std::cout << "p cnf " << (n+1)/2 << " 0\n";
+      return 0;
+    }
 
-    const set_system_type G(vdw_generator()(k,n));
+    namespace Gen = OKlib::Combinatorics::Hypergraphs::Generators;
+    typedef Gen::Pd_arithprog_stream<uint_type> vdw_generator;
+    const vdw_generator G(k,n);
+    const OKlib::Structures::NumberTheory::PrimeNumbers::Boost_threads_execution ex(threads);
 
-    std::cout << "c Palindromised hypergraph with arithmetic-progression length " << k << " and " << n << " vertices.\n";
-    std::cout << "p cnf " << (n+1)/2 << " " << G.size() << "\n";
+    std::cout << "p cnf " << G.nver() << " " << G.nhyp(ex) << "\n";
 
-    for (set_system_type::const_iterator i = G.begin(); i != G.end(); ++i) {
-      const hyperedge_type H = *i;
-      for (hyperedge_type::const_iterator j = H.begin(); j != H.end(); ++j)
-        std::cout << *j << " ";
-      std::cout << "0\n";
-    }
+    Gen::Dimacs_hyperedge_output out(std::cout);
+    G(out, ex);
 
   }
   catch (boost::bad_lexical_cast&) {
-    std::cerr << err << "Both parameters must be non-negative integers\n"
-    "in the range given by UINT_TYPE_VDW (default = unsigned int).\n";
+    std::cerr << err << "All parameters must be non-negative integers\n"
+    "in the range given by UINT_TYPE_VDW (default = unsigned long).\n";
     return(errcode_parameter_values);
   }
 
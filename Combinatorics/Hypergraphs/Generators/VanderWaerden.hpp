@@ -1,5 +1,5 @@
 // Oliver Kullmann, 15.5.2005 (Swansea)
-/* Copyright 2005 - 2007, 2009, 2010 Oliver Kullmann
+/* Copyright 2005 - 2007, 2009, 2010, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -20,10 +20,14 @@ License, or any later version. */
 #include <algorithm>
 #include <functional>
 #include <list>
+#include <ostream>
+
+#include <boost/cstdint.hpp>
 
 #include <OKlib/Concepts/Iterators.hpp>
 #include <OKlib/Programming/Utilities/OrderRelations/OrderConstructions.hpp>
 #include <OKlib/Structures/Sets/SetAlgorithms/Subsumption.hpp>
+#include <OKlib/Structures/NumberTheory/PrimeNumbers/SegmentedSieve.hpp>
 
 namespace OKlib {
  namespace Combinatorics {
@@ -490,7 +494,245 @@ namespace OKlib {
       }
     
     };
-    
+
+    /*!
+      \class Pd_arithprog_stream
+      \brief Streaming computation of palindromic vdW-hypergraphs
+
+      Pd_arithprog_stream<Int> G(k,n) yields the same hypergraph as
+      Pd_arithprog_ohg<Int>()(k,n) (same hyperedges, same colexicographical
+      order), however without storing it: G(sink) calls sink(H) for every
+      hyperedge H in order.
+
+      Strategy:
+      <ul>
+       <li> In colexicographical order the hyperedges come in blocks
+       1 <= m <= nver() = (n+1)/2, where block m consists of the hyperedges
+       with maximal element m. </li>
+       <li> A palindromised progression is "short" if it has less than k
+       elements, which happens iff two elements v, w of the original
+       progression have v + w = n + 1; these are only O(n) many, and are
+       computed (and subsumption-reduced) at construction, indexed by their
+       maximal element. </li>
+       <li> The "full" (size k) palindromised progressions of block m come
+       from the progressions containing m or n+1-m, with all elements in
+       {1,...,m} or {n+1-m,...,n}. A full hyperedge can only be subsumed
+       by a short one, and only these subsumptions are checked. </li>
+       <li> Thus the space used is O(n) (instead of O(n^2/k)). </li>
+       <li> The blocks are independent, and so can be computed in
+       parallel: the second argument of operator() is an execution-policy
+       as for Structures/NumberTheory/PrimeNumbers/SegmentedSieve.hpp (e.g.
+       Boost_threads_execution from ParallelSegmentedSieve.hpp). A window
+       of window_factor * threads() consecutive blocks is computed in
+       parallel (task t computing the blocks with offset t modulo the
+       number of tasks), and then handed to the sink in order; so the
+       output does not depend on the number of threads. </li>
+       <li> nhyp() counts the hyperedges (by a run with a counting sink);
+       for Dimacs-output (with the parameter line first) thus two runs are
+       needed. </li>
+      </ul>
+    */
+
+    template <typename Int = unsigned int>
+    class Pd_arithprog_stream {
+    public :
+      typedef Int vertex_type;
+      typedef std::vector<vertex_type> hyperedge_type;
+      typedef std::vector<hyperedge_type> block_type;
+      typedef typename block_type::size_type size_type;
+      typedef boost::uint64_t count_type;
+
+      static const unsigned int window_factor = 4;
+
+      const vertex_type k;
+      const vertex_type n;
+      //! midpoint of {1, ..., n}
+      const vertex_type mp;
+
+      Pd_arithprog_stream(const vertex_type k, const vertex_type n) :
+          k(k), n(n), mp((n+1)/2), shorts(mp+1) {
+        assert(k >= 1);
+        if (n >= k) compute_short_hyperedges();
+      }
+
+      vertex_type nver() const { return mp; }
+
+      //! the colexicographically sorted hyperedges with maximal element m
+      void block(const vertex_type m, block_type& B) const {
+        assert(1 <= m and m <= mp);
+        B.assign(shorts[m].begin(), shorts[m].end());
+        if (n < k) return;
+        const size_type num_shorts = B.size();
+        full_hyperedges(m, B);
+        typedef typename block_type::iterator iterator;
+        const iterator fb = B.begin() + num_shorts;
+        std::sort(fb, B.end());
+        B.erase(std::unique(fb, B.end()), B.end());
+        std::sort(B.begin(), B.end(), ::OKlib::Programming::Utilities::OrderRelations::Colexicographical_comparison<hyperedge_type>());
+      }
+
+      template <class Sink>
+      void operator()(Sink& sink) const {
+        operator()(sink, ::OKlib::Structures::NumberTheory::PrimeNumbers::Sequential_execution());
+      }
+      template <class Sink, class Execution>
+      void operator()(Sink& sink, const Execution& ex) const {
+        if (mp == 0 or n < k) return;
+        const vertex_type T = std::max(1U, ex.threads());
+        const vertex_type W = T * window_factor;
+        std::vector<block_type> window(W);
+        std::vector<Block_task> tasks;
+        for (vertex_type first = 1; first <= mp; first += W) {
+          const vertex_type size = std::min(W, vertex_type(mp - first + 1));
+          const vertex_type num_tasks = std::min(T, size);
+          tasks.clear();
+          for (vertex_type t = 0; t < num_tasks; ++t)
+            tasks.push_back(Block_task(this, &window, first, size, t, num_tasks));
+          ex(tasks);
+          for (vertex_type i = 0; i < size; ++i) {
+            const block_type& B = window[i];
+            for (typename block_type::const_iterator j = B.begin(); j != B.end(); ++j) sink(*j);
+          }
+          if (first > mp - W) break;
+        }
+      }
+
+      struct Counting_sink {
+        count_type count;
+        Counting_sink() : count(0) {}
+        void operator()(const hyperedge_type&) { ++count; }
+      };
+      count_type nhyp() const {
+        return nhyp(::OKlib::Structures::NumberTheory::PrimeNumbers::Sequential_execution());
+      }
+      template <class Execution>
+      count_type nhyp(const Execution& ex) const {
+        Counting_sink c;
+        operator()(c, ex);
+        return c.count;
+      }
+
+      //! Computing the blocks first + i, i = t + j*num_tasks < size
+      struct Block_task {
+        const Pd_arithprog_stream* G;
+        std::vector<block_type>* window;
+        vertex_type first, size, t, num_tasks;
+        Block_task(const Pd_arithprog_stream* const G, std::vector<block_type>* const window, const vertex_type first, const vertex_type size, const vertex_type t, const vertex_type num_tasks) : G(G), window(window), first(first), size(size), t(t), num_tasks(num_tasks) {}
+        void operator()() const {
+          for (vertex_type i = t; i < size; i += num_tasks)
+            G -> block(first + i, (*window)[i]);
+        }
+      };
+
+    private :
+
+      //! the reduced short hyperedges, indexed by maximal element
+      std::vector<block_type> shorts;
+
+      vertex_type pd(const vertex_type v) const {
+        return (v > mp) ? n-v+1 : v;
+      }
+
+      // The palindromised progression with first element a and slope d:
+      void pd_progression(const vertex_type a, const vertex_type d, hyperedge_type& H) const {
+        H.clear();
+        for (vertex_type i = 0, v = a; i < k; ++i, v += d) H.push_back(pd(v));
+        std::sort(H.begin(), H.end());
+        H.erase(std::unique(H.begin(), H.end()), H.end());
+      }
+
+      // Whether H is strictly subsumed by one of the short hyperedges
+      // (where a subsuming hyperedge has its maximal element in H):
+      bool subsumed(const hyperedge_type& H) const {
+        for (typename hyperedge_type::const_iterator i = H.begin(); i != H.end(); ++i) {
+          const block_type& S = shorts[*i];
+          for (typename block_type::const_iterator j = S.begin(); j != S.end(); ++j)
+            if (j -> size() < H.size() and std::includes(H.begin(), H.end(), j -> begin(), j -> end()))
+              return true;
+        }
+        return false;
+      }
+
+      void compute_short_hyperedges() {
+        if (k == 1) return;
+        block_type S;
+        hyperedge_type H;
+        H.reserve(k);
+        const vertex_type max_d = (n-1) / (k-1);
+        // 2a + s*d = n+1 for 1 <= s <= 2k-3:
+        for (vertex_type d = 1; d <= max_d; ++d)
+          for (vertex_type s = 1; s <= 2*k-3 and s*d < n+1; ++s) {
+            if ((n+1 - s*d) % 2 != 0) continue;
+            const vertex_type a = (n+1 - s*d) / 2;
+            if (a + (k-1)*d > n) continue;
+            pd_progression(a, d, H);
+            assert(H.size() < k);
+            S.push_back(H);
+          }
+        std::sort(S.begin(), S.end(), ::OKlib::Programming::Utilities::OrderRelations::SizeLessThan<std::less<hyperedge_type> >());
+        S.erase(std::unique(S.begin(), S.end()), S.end());
+        for (typename block_type::const_iterator i = S.begin(); i != S.end(); ++i)
+          if (not subsumed(*i)) shorts[i -> back()].push_back(*i);
+      }
+
+      // Adds the full palindromised progressions with maximal element m
+      // to B; for slopes d <= g (the size of the gap between m and n+1-m)
+      // the progressions lie on one side, and only the one ending in m
+      // is taken (the one starting with n+1-m yields the same hyperedge):
+      void full_hyperedges(const vertex_type m, block_type& B) const {
+        if (k == 1) { B.push_back(hyperedge_type(1, m)); return; }
+        hyperedge_type H;
+        H.reserve(k);
+        const vertex_type max_d = (n-1) / (k-1);
+        const vertex_type g = (n >= 2*m) ? n - 2*m : 0;
+        for (vertex_type d = 1; d <= std::min(g, max_d) and (k-1)*d < m; ++d) {
+          pd_progression(m - (k-1)*d, d, H);
+          assert(H.size() == k);
+          if (not subsumed(H)) B.push_back(H);
+        }
+        full_hyperedges(m, m, g, B);
+        if (n+1-m != m) full_hyperedges(n+1-m, m, g, B);
+      }
+      // Adds the full palindromised progressions obtained from the
+      // progressions containing x with slope d > g, and with maximal
+      // element m, to B:
+      void full_hyperedges(const vertex_type x, const vertex_type m, const vertex_type g, block_type& B) const {
+        hyperedge_type H;
+        H.reserve(k);
+        const vertex_type max_d = (n-1) / (k-1);
+        for (vertex_type d = g+1; d <= max_d; ++d)
+          for (vertex_type i = 0; i < k and i*d < x; ++i) {
+            const vertex_type a = x - i*d;
+            if (a + (k-1)*d > n) continue;
+            bool inside = true;
+            for (vertex_type j = 0, v = a; j < k; ++j, v += d)
+              if (pd(v) > m) { inside = false; break; }
+            if (not inside) continue;
+            pd_progression(a, d, H);
+            if (H.size() == k and not subsumed(H)) B.push_back(H);
+          }
+      }
+
+    };
+    template <typename Int>
+    const unsigned int Pd_arithprog_stream<Int>::window_factor;
+
+    /*!
+      \class Dimacs_hyperedge_output
+      \brief Sink outputting hyperedges as Dimacs-clauses
+    */
+
+    struct Dimacs_hyperedge_output {
+      std::ostream& out;
+      explicit Dimacs_hyperedge_output(std::ostream& out) : out(out) {}
+      template <class Hyperedge>
+      void operator()(const Hyperedge& H) {
+        for (typename Hyperedge::const_iterator i = H.begin(); i != H.end(); ++i)
+          out << *i << " ";
+        out << "0\n";
+      }
+    };
+
    }
   }
  }
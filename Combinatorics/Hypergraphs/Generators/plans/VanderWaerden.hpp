@@ -1,5 +1,5 @@
 // Oliver Kullmann, 11.6.2009 (Swansea)
-/* Copyright 2009, 2010 Oliver Kullmann
+/* Copyright 2009, 2010, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -29,6 +29,19 @@ License, or any later version. */
   \todo DONE Update namespace usage
 
 
+  \todo Streaming palindromic hypergraphs
+  <ul>
+   <li> DONE (Pd_arithprog_stream, used by PdVanderWaerden)
+   Generation in colexicographical order with space O(n), blockwise
+   parallelised. </li>
+   <li> Pd_arithprog_stream::nhyp() needs a full run; a closed formula
+   (or at least counting without producing the hyperedges) would save
+   the first run for Dimacs-output. </li>
+   <li> Pd_arithprog_ohg could then be implemented via
+   Pd_arithprog_stream (collecting the hyperedges). </li>
+  </ul>
+
+
   \todo New test system
   <ul>
    <li> Transfer the tests to the new testsystem. </li>
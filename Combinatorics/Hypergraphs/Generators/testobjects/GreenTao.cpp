@@ -1,5 +1,5 @@
 // Oliver Kullmann, 17.10.2009 (Swansea)
-/* Copyright 2009 Oliver Kullmann
+/* Copyright 2009, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -9,8 +9,12 @@ License, or any later version. */
 
 #include <OKlib/Combinatorics/Hypergraphs/Generators/GreenTao.hpp>
 #include <OKlib/Combinatorics/Hypergraphs/Generators/tests/GreenTao.hpp>
+#include <OKlib/Structures/NumberTheory/PrimeNumbers/ParallelSegmentedSieve.hpp>
 
 namespace {
 
+  ::OKlib::TestSystem::RunTest test_first_prime_numbers(new ::OKlib::Combinatorics::Hypergraphs::Generators::tests::Test_First_prime_numbers< ::OKlib::Combinatorics::Hypergraphs::Generators::First_prime_numbers<>, ::OKlib::Combinatorics::Hypergraphs::Generators::First_prime_numbers_mpz<>, ::OKlib::Structures::NumberTheory::PrimeNumbers::Boost_threads_execution>);
+  ::OKlib::TestSystem::RunTest test_greentao(new ::OKlib::Combinatorics::Hypergraphs::Generators::tests::Test_GreenTao< ::OKlib::Combinatorics::Hypergraphs::Generators::GreenTao<>, ::OKlib::Combinatorics::Hypergraphs::Generators::First_prime_numbers_mpz<>, ::OKlib::Structures::NumberTheory::PrimeNumbers::Boost_threads_execution>);
+
 }
 
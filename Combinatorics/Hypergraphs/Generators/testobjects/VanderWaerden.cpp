@@ -0,0 +1,18 @@
+// Oliver Kullmann, 16.10.2026 (Swansea)
+/* Copyright 2026 Oliver Kullmann
+This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
+it and/or modify it under the terms of the GNU General Public License as published by
+the Free Software Foundation and included in this library; either version 3 of the
+License, or any later version. */
+
+#include <OKlib/TestSystem/RunTest_DesignStudy.hpp>
+
+#include <OKlib/Combinatorics/Hypergraphs/Generators/VanderWaerden.hpp>
+#include <OKlib/Combinatorics/Hypergraphs/Generators/tests/VanderWaerden.hpp>
+#include <OKlib/Structures/NumberTheory/PrimeNumbers/ParallelSegmentedSieve.hpp>
+
+namespace {
+
+  ::OKlib::TestSystem::RunTest test_pd_arithprog_stream(new ::OKlib::Combinatorics::Hypergraphs::Generators::tests::Test_Pd_arithprog_stream< ::OKlib::Combinatorics::Hypergraphs::Generators::Pd_arithprog_stream<>, ::OKlib::Combinatorics::Hypergraphs::Generators::Pd_arithprog_ohg<>, ::OKlib::Structures::NumberTheory::PrimeNumbers::Boost_threads_execution>);
+
+}
@@ -1,5 +1,5 @@
 // Oliver Kullmann, 17.10.2009 (Swansea)
-/* Copyright 2009 Oliver Kullmann
+/* Copyright 2009, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -9,12 +9,24 @@ License, or any later version. */
   \file OKlib/Combinatorics/Hypergraphs/Generators/tests/GreenTao.hpp
   \brief Generic tests for algorithms generating GreenTao hypergraphs
 
+  Test_First_prime_numbers compares the sieve-based computation of the
+  first n prime numbers with the reference (via mpz_nextprime); at level
+  Extensive also timings are output (to log_stream()).
+
+  Test_GreenTao compares the hyperedge sets for the different
+  constructors and execution-policies, and checks some hyperedge-counts.
+
 */
 
 #ifndef GREENTAO_qlacsdwEsS
 #define GREENTAO_qlacsdwEsS
 
+#include <vector>
+#include <ctime>
+
 #include <OKlib/TestSystem/TestBaseClass_DesignStudy.hpp>
+#include <OKlib/TestSystem/TestExceptions_DesignStudy.hpp>
+#include <OKlib/Structures/NumberTheory/PrimeNumbers/SegmentedSieve.hpp>
 
 namespace OKlib {
   namespace Combinatorics {
@@ -23,7 +35,116 @@ namespace OKlib {
         namespace tests {
 
 # define OKLIB_FILE_ID new ::OKlib::Messages::Utilities::FileIdentification \
-      (__FILE__, __DATE__, __TIME__, "$Date: 17.10.2009 20:35:00 $", "$Revision: 1 $")
+      (__FILE__, __DATE__, __TIME__, "$Date: 16.10.2026 12:00:00 $", "$Revision: 2 $")
+
+        namespace PN = ::OKlib::Structures::NumberTheory::PrimeNumbers;
+
+        /*!
+          \class Reverse_execution
+          \brief Execution-policy running the tasks in reverse order, with
+          the given number of tasks
+        */
+
+        struct Reverse_execution {
+          const unsigned int t;
+          explicit Reverse_execution(const unsigned int t) : t(t) {}
+          unsigned int threads() const { return t; }
+          template <class Task>
+          void operator()(const std::vector<Task>& tasks) const {
+            for (typename std::vector<Task>::size_type i = tasks.size(); i != 0; --i)
+              tasks[i-1]();
+          }
+        };
+
+        /*!
+          \class Test_First_prime_numbers
+          \brief Testing First_primes against the reference First_primes_ref
+
+          Execution is a parallel execution-policy, constructible from the
+          number of threads.
+        */
+
+        template <class First_primes, class First_primes_ref, class Execution>
+        OKLIB_TEST_CLASS(Test_First_prime_numbers) {
+          OKLIB_TEST_CLASS_C(Test_First_prime_numbers) {}
+        private :
+          typedef typename First_primes::uint_type uint_type;
+          typedef typename First_primes::range_type range_type;
+          typedef PN::Prime_bitset<uint_type> table_type;
+
+          void test(::OKlib::TestSystem::Basic) {
+            const First_primes fp = First_primes();
+            const First_primes_ref fpr = First_primes_ref();
+            for (uint_type n = 0; n <= 200; ++n)
+              OKLIB_TEST_EQUAL_RANGES(fp(n), fpr(n));
+            {
+              const range_type P(fpr(10000));
+              OKLIB_TEST_EQUAL_RANGES(fp(10000), P);
+              OKLIB_TEST_EQUAL_RANGES(fp(10000, Execution(3)), P);
+              const table_type T(P.back());
+              OKLIB_TEST_EQUAL(T.count(), P.size());
+              typename range_type::size_type j = 0;
+              for (uint_type x = 0; x <= P.back(); ++x) {
+                const bool is_prime = (j < P.size() and P[j] == x);
+                OKLIB_TEST_EQUAL(T(x), is_prime);
+                if (is_prime) ++j;
+              }
+            }
+            {
+              const uint_type max[] = {0, 1, 2, 3, 4, 127, 128, 129, 262143, 262144, 262145, 1000000};
+              for (unsigned int i = 0; i < sizeof(max)/sizeof(max[0]); ++i) {
+                const table_type T(max[i]);
+                for (unsigned int t = 1; t <= 4; ++t) {
+                  OKLIB_TEST_EQUAL_RANGES(table_type(max[i], Reverse_execution(t)).bits(), T.bits());
+                  OKLIB_TEST_EQUAL_RANGES(table_type(max[i], Execution(t)).bits(), T.bits());
+                }
+              }
+              OKLIB_TEST_EQUAL(table_type(1000000).count(), 78498U);
+            }
+          }
+          void test(::OKlib::TestSystem::Extensive) {
+            const First_primes fp = First_primes();
+            const First_primes_ref fpr = First_primes_ref();
+            const uint_type N[] = {100000, 1000000};
+            for (unsigned int i = 0; i < sizeof(N)/sizeof(N[0]); ++i) {
+              const uint_type n = N[i];
+              std::clock_t t0 = std::clock();
+              const range_type P(fp(n));
+              const double t_sieve = double(std::clock() - t0) / CLOCKS_PER_SEC;
+              t0 = std::clock();
+              const range_type Pr(fpr(n));
+              const double t_ref = double(std::clock() - t0) / CLOCKS_PER_SEC;
+              OKLIB_TEST_EQUAL_RANGES(P, Pr);
+              log_stream() << "First_prime_numbers: n = " << n << ", sieve " << t_sieve << "s, mpz_nextprime " << t_ref << "s\n";
+            }
+          }
+        };
+
+        /*!
+          \class Test_GreenTao
+          \brief Testing the hyperedge-generation of GreenTao
+        */
+
+        template <class GreenTao, class First_primes_ref, class Execution>
+        OKLIB_TEST_CLASS(Test_GreenTao) {
+          OKLIB_TEST_CLASS_C(Test_GreenTao) {}
+        private :
+          typedef typename GreenTao::vertex_type vertex_type;
+          typedef typename GreenTao::set_system_type set_system_type;
+
+          void test(::OKlib::TestSystem::Basic) {
+            const First_primes_ref fpr = First_primes_ref();
+            OKLIB_TEST_EQUAL(GreenTao(3,100).hyperedge_set().size(), 579U);
+            OKLIB_TEST_EQUAL(GreenTao(4,2000).hyperedge_set().size(), 24070U);
+            OKLIB_TEST_EQUAL(GreenTao(5,5000).hyperedge_set().size(), 13235U);
+            for (vertex_type k = 0; k <= 6; ++k)
+              for (vertex_type n = 0; n <= 300; n += 30) {
+                const set_system_type H(GreenTao(k,n).hyperedge_set());
+                OKLIB_TEST_EQUAL_RANGES(GreenTao(k,n,fpr(n)).hyperedge_set(), H);
+                OKLIB_TEST_EQUAL_RANGES(GreenTao(k,n,Execution(2)).hyperedge_set(), H);
+              }
+          }
+        };
 
         }
       }
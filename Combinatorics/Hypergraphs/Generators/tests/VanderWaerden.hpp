@@ -0,0 +1,84 @@
+// Oliver Kullmann, 16.10.2026 (Swansea)
+/* Copyright 2026 Oliver Kullmann
+This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
+it and/or modify it under the terms of the GNU General Public License as published by
+the Free Software Foundation and included in this library; either version 3 of the
+License, or any later version. */
+
+/*!
+  \file OKlib/Combinatorics/Hypergraphs/Generators/tests/VanderWaerden.hpp
+  \brief Generic tests for algorithms generating van der Waerden hypergraphs
+
+  Test_Pd_arithprog_stream compares the streaming generation of
+  palindromic vdW-hypergraphs with the reference (which stores the
+  whole hypergraph), for different execution-policies.
+
+*/
+
+#ifndef VANDERWAERDEN_Uh4bTz8rLq
+#define VANDERWAERDEN_Uh4bTz8rLq
+
+#include <vector>
+
+#include <OKlib/TestSystem/TestBaseClass_DesignStudy.hpp>
+#include <OKlib/TestSystem/TestExceptions_DesignStudy.hpp>
+
+namespace OKlib {
+  namespace Combinatorics {
+    namespace Hypergraphs {
+      namespace Generators {
+        namespace tests {
+
+# define OKLIB_FILE_ID new ::OKlib::Messages::Utilities::FileIdentification \
+      (__FILE__, __DATE__, __TIME__, "$Date: 16.10.2026 12:00:00 $", "$Revision: 1 $")
+
+        /*!
+          \class Test_Pd_arithprog_stream
+          \brief Testing Pd_arithprog_stream against the reference Pd_ref
+
+          Execution is a parallel execution-policy, constructible from the
+          number of threads.
+        */
+
+        template <class Pd_arithprog_stream, class Pd_ref, class Execution>
+        OKLIB_TEST_CLASS(Test_Pd_arithprog_stream) {
+          OKLIB_TEST_CLASS_C(Test_Pd_arithprog_stream) {}
+        private :
+          typedef typename Pd_arithprog_stream::vertex_type vertex_type;
+          typedef typename Pd_ref::set_system_type set_system_type;
+          typedef typename Pd_ref::hyperedge_type hyperedge_type;
+
+          struct Collect {
+            set_system_type G;
+            void operator()(const hyperedge_type& H) { G.push_back(H); }
+          };
+
+          void test(::OKlib::TestSystem::Basic) {
+            for (vertex_type k = 1; k <= 6; ++k)
+              for (vertex_type n = (k == 1) ? 2 : k; n <= 60; ++n) {
+                const set_system_type G(Pd_ref()(k,n));
+                const Pd_arithprog_stream S(k,n);
+                OKLIB_TEST_EQUAL(S.nver(), (n+1)/2);
+                OKLIB_TEST_EQUAL(S.nhyp(), G.size());
+                {
+                  Collect c;
+                  S(c);
+                  OKLIB_TEST_EQUAL_RANGES(c.G, G);
+                }
+                for (unsigned int t = 2; t <= 3; ++t) {
+                  Collect c;
+                  S(c, Execution(t));
+                  OKLIB_TEST_EQUAL_RANGES(c.G, G);
+                }
+              }
+          }
+        };
+
+        }
+      }
+    }
+  }
+}
+
+# undef OKLIB_FILE_ID
+#endif
@@ -0,0 +1 @@
+QuineMcCluskey.cpp
\ No newline at end of file
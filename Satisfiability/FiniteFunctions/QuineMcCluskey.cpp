@@ -1,5 +1,5 @@
 // Oliver Kullmann, 22.5.2009 (Swansea)
-/* Copyright 2009, 2010, 2011 Oliver Kullmann
+/* Copyright 2009, 2010, 2011, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -14,6 +14,9 @@ License, or any later version. */
    format. </li>
    <li> The result is printed to standard output (again a clause-set in DIMACS
    format). </li>
+   <li> At most NUMBER_VARIABLES <= 20 variables are allowed, while the
+   computation only uses the variables up to the maximal variable occurring,
+   using as many threads as the hardware provides. </li>
   </ul>
 */
 
@@ -41,7 +44,7 @@ namespace {
   const std::string program = "QuineMcCluskey";
   const std::string err = "ERROR[" + program + "]: ";
 
-  const std::string version = "0.2.1";
+  const std::string version = "0.3.0";
 
 }
 
@@ -1,5 +1,5 @@
 // Oliver Kullmann, 22.5.2009 (Swansea)
-/* Copyright 2009, 2010, 2011, 2012 Oliver Kullmann
+/* Copyright 2009, 2010, 2011, 2012, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -16,17 +16,26 @@ License, or any later version. */
   combinatorial structures, we speak of the "prime clauses" of F.
 
   The function-template call FiniteFunctions::quine_mccluskey<n>(F) returns the
-  prime-clauses of F, using the same clause-set-type as F.
+  prime-clauses of F, using the same clause-set-type as F; here n <= 20 is
+  the maximal number of variables, while the computation only uses the
+  variables actually occurring (up to the maximal one). With
+  FiniteFunctions::quine_mccluskey(F, n) the number n of variables is given at
+  run-time.
 */
 
 #ifndef QUINEMCCLUSKEY_jdbVce4
 #define QUINEMCCLUSKEY_jdbVce4
 
 #include <vector>
+#include <array>
 #include <algorithm>
+#include <thread>
+#include <atomic>
 #include <cstdlib>
+#include <cstdint>
 #include <cassert>
 #include <limits>
+#include <bit>
 
 #include <boost/range.hpp>
 #include <boost/static_assert.hpp>
@@ -35,6 +44,254 @@ namespace OKlib {
   namespace Satisfiability {
     namespace FiniteFunctions {
 
+      /*!
+        \class BitParallelQuineMcCluskey
+        \brief Word-parallel computation of the prime clauses for clause-sets over n <= 20 variables
+
+        Clauses over the variables 1, ..., n are represented by their
+        hash-values (see QuineMcCluskey::hash_clause below), and sets of
+        clauses by bit-tables of length 3^n, stored in 64-bit words.
+
+        For a variable i (0 <= i < n, standing for variable i+1) with
+        w = 3^i, the indices split into blocks of length 3w, each consisting
+        of the three segments where variable i does not occur, occurs
+        negatively resp. positively. The 2-subsumption resolutions on i
+        are then S_0 |= S_1 & S_2 for all blocks, with the parent clauses
+        S_1 & S_2 marked in the table P --- done by shifts and masks on whole
+        words (for w < 64), resp. segment-wise on whole words (for w >= 64).
+
+        compute() repeats these passes over all variables until no new
+        clause is created, which yields the closure S under 2-subsumption
+        resolution, as computed by the level-wise algorithm (for full
+        clause-sets two passes are needed). The result are then the clauses
+        in S which are not in P, that is, which were not parent of a
+        2-subsumption resolution.
+
+        Each pass is split into independent units of whole words, processed by
+        threads() many threads; writes to words which a unit shares with
+        other units are deferred until all units of the pass are finished.
+      */
+      class BitParallelQuineMcCluskey {
+      public :
+
+        typedef std::uint64_t word_type;
+        typedef std::uint64_t hash_index_type;
+        typedef std::vector<word_type> table_type;
+
+        static constexpr int max_num_vars = 20;
+        static constexpr int word_bits = std::numeric_limits<word_type>::digits;
+        BOOST_STATIC_ASSERT(word_bits == 64);
+
+        //! pow3[i] = 3^i for 0 <= i <= max_num_vars
+        static constexpr std::array<hash_index_type, max_num_vars+1> pow3 = []{
+          std::array<hash_index_type, max_num_vars+1> a{};
+          a[0] = 1;
+          for (int i = 1; i <= max_num_vars; ++i) a[i] = 3 * a[i-1];
+          return a;
+        }();
+
+        static unsigned default_threads() {
+          return std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        //! threads = 0 means default_threads()
+        explicit BitParallelQuineMcCluskey(const int n, const unsigned threads = 0) :
+          n(n), T(threads == 0 ? default_threads() : threads),
+          size_(pow3[n]), num_words((size_ + word_bits - 1) / word_bits),
+          S(num_words + 1), P(num_words + 1) {
+          assert(n >= 0 and n <= max_num_vars);
+        }
+
+        int num_vars() const { return n; }
+        unsigned threads() const { return T; }
+        //! the number 3^n of all clauses
+        hash_index_type size() const { return size_; }
+
+        void insert(const hash_index_type h) {
+          assert(h < size_);
+          S[h / word_bits] |= word_type(1) << (h % word_bits);
+        }
+
+        //! Computes the closure under 2-subsumption resolution, and the parents
+        void compute() {
+          bool changed;
+          do {
+            changed = false;
+            for (int i = 0; i < n; ++i) changed |= resolve(i);
+          } while (changed);
+        }
+
+        //! Calls f(h) for the hash-values of the prime clauses (ascending)
+        template <class F>
+        void for_each_prime(F f) const {
+          for (hash_index_type j = 0; j < num_words; ++j)
+            for (word_type x = S[j] & ~P[j]; x != 0; x &= x - 1)
+              f(j * word_bits + std::countr_zero(x));
+        }
+
+      private :
+
+        const int n;
+        const unsigned T;
+        const hash_index_type size_, num_words;
+        table_type S, P; // current clauses, parent clauses
+        // (with one additional zero-word at the end)
+
+        // Unit-size (in words) for the small variables, and segment-length (in
+        // bits) for the large variables:
+        static constexpr hash_index_type unit_words = 4096;
+        static constexpr hash_index_type unit_bits = unit_words * word_bits;
+
+        struct Deferred {
+          table_type* t;
+          hash_index_type j;
+          word_type x;
+        };
+        // Per unit: the half-open interval of bit-indices it may access,
+        // the deferred writes, and whether new clauses were created:
+        struct Worker {
+          std::vector<Deferred> d;
+          bool changed = false;
+        };
+        struct Interval { hash_index_type b, e; };
+
+        static bool inside(const hash_index_type j, const Interval I) {
+          return j * word_bits >= I.b and (j+1) * word_bits <= I.e;
+        }
+        void write(table_type& t, const hash_index_type j, const word_type x,
+                   const Interval I, Worker& W) {
+          if (x == 0) return;
+          if (not inside(j, I)) { W.d.push_back({&t, j, x}); return; }
+          if (&t == &S and (x & ~S[j])) W.changed = true;
+          t[j] |= x;
+        }
+        // The len <= 64 bits of t from index pos on:
+        static word_type get(const table_type& t, const hash_index_type pos, const unsigned len) {
+          const hash_index_type j = pos / word_bits;
+          const unsigned r = pos % word_bits;
+          word_type x = t[j] >> r;
+          if (r + len > word_bits) x |= t[j+1] << (word_bits - r);
+          return len == word_bits ? x : x & ((word_type(1) << len) - 1);
+        }
+        void put(table_type& t, const hash_index_type pos, const word_type x,
+                 const unsigned len, const Interval I, Worker& W) {
+          const hash_index_type j = pos / word_bits;
+          const unsigned r = pos % word_bits;
+          write(t, j, x << r, I, W);
+          if (r + len > word_bits) write(t, j+1, x >> (word_bits - r), I, W);
+        }
+
+        // Runs f(u, W) for all units u < units, returns whether new clauses
+        // were created:
+        template <class F>
+        bool run(const hash_index_type units, F f) {
+          const unsigned k = std::min<hash_index_type>(T, units);
+          std::vector<Worker> workers(std::max(1u, k));
+          if (k <= 1)
+            for (hash_index_type u = 0; u < units; ++u) f(u, workers[0]);
+          else {
+            std::atomic<hash_index_type> next(0);
+            std::vector<std::thread> threads;
+            threads.reserve(k);
+            for (unsigned t = 0; t < k; ++t)
+              threads.emplace_back([&next, &workers, &f, units, t]{
+                for (hash_index_type u; (u = next++) < units;) f(u, workers[t]);
+              });
+            for (std::thread& t : threads) t.join();
+          }
+          bool changed = false;
+          for (const Worker& W : workers) {
+            changed |= W.changed;
+            for (const Deferred& d : W.d) {
+              if (d.t == &S and (d.x & ~S[d.j])) changed = true;
+              (*d.t)[d.j] |= d.x;
+            }
+          }
+          return changed;
+        }
+
+        bool resolve(const int i) {
+          assert(0 <= i and i < n);
+          const hash_index_type w = pow3[i], block = 3 * w;
+          if (w < word_bits) return resolve_small(w);
+          const hash_index_type blocks = size_ / block;
+          if (block <= unit_bits) {
+            // units of whole blocks:
+            const hash_index_type per_unit = unit_bits / block,
+              units = (blocks + per_unit - 1) / per_unit;
+            return run(units, [=, this](const hash_index_type u, Worker& W) {
+              const hash_index_type hb = u * per_unit,
+                he = std::min(blocks, hb + per_unit);
+              const Interval I{hb * block, he * block};
+              for (hash_index_type base = I.b; base < I.e; base += block)
+                for (hash_index_type lo = 0; lo < w; lo += word_bits)
+                  step(base, w, lo, std::min<hash_index_type>(word_bits, w-lo), I, I, I, W);
+            });
+          }
+          else {
+            // units of segments of single blocks:
+            const hash_index_type per_block = (w + unit_bits - 1) / unit_bits,
+              units = blocks * per_block;
+            return run(units, [=, this](const hash_index_type u, Worker& W) {
+              const hash_index_type base = (u / per_block) * block,
+                lb = (u % per_block) * unit_bits,
+                le = std::min(w, lb + unit_bits);
+              const Interval I0{base + lb, base + le},
+                I1{I0.b + w, I0.e + w}, I2{I1.b + w, I1.e + w};
+              for (hash_index_type lo = lb; lo < le; lo += word_bits)
+                step(base, w, lo, std::min<hash_index_type>(word_bits, le-lo), I0, I1, I2, W);
+            });
+          }
+        }
+
+        // The resolutions for the bits lo, ..., lo+len-1 of the segments of
+        // the block starting at base:
+        void step(const hash_index_type base, const hash_index_type w,
+                  const hash_index_type lo, const unsigned len,
+                  const Interval I0, const Interval I1, const Interval I2,
+                  Worker& W) {
+          const word_type x = get(S, base + w + lo, len) & get(S, base + 2*w + lo, len);
+          if (x == 0) return;
+          put(S, base + lo, x, len, I0, W);
+          put(P, base + w + lo, x, len, I1, W);
+          put(P, base + 2*w + lo, x, len, I2, W);
+        }
+
+        // For w in {1, 3, 9, 27}: units of 3w*k words start at block-borders,
+        // and within a word the positions of the first segments are given by
+        // the mask with index (word-index mod 3w):
+        bool resolve_small(const hash_index_type w) {
+          const hash_index_type period = 3 * w;
+          std::vector<word_type> mask(period);
+          for (hash_index_type t = 0; t < period; ++t)
+            for (unsigned b = 0; b < word_bits; ++b)
+              if ((t * word_bits + b) % period < w)
+                mask[t] |= word_type(1) << b;
+          const hash_index_type uw = std::max<hash_index_type>(1, unit_words / period) * period,
+            units = (num_words + uw - 1) / uw;
+          const unsigned r1 = w, r2 = 2*w;
+          return run(units, [&, uw, r1, r2](const hash_index_type u, Worker& W) {
+            const hash_index_type a = u * uw, e = std::min(num_words, a + uw);
+            word_type* const s = S.data(); word_type* const p = P.data();
+            word_type prev = 0, changed = 0;
+            for (hash_index_type j = a; j < e; ++j) {
+              const word_type s0 = s[j], s1 = j+1 < e ? s[j+1] : 0;
+              const word_type x = ((s0 >> r1) | (s1 << (word_bits-r1))) &
+                ((s0 >> r2) | (s1 << (word_bits-r2))) & mask[j % period];
+              changed |= x & ~s0;
+              s[j] = s0 | x;
+              p[j] |= (x << r1) | (x << r2) |
+                (prev >> (word_bits-r1)) | (prev >> (word_bits-r2));
+              prev = x;
+            }
+            assert((prev >> (word_bits-r2)) == 0);
+            if (changed) W.changed = true;
+          });
+        }
+
+      };
+
+
       /*!
         \class QuineMcCluskey
         \brief Functor, computing all prime implicates of a full clause-set
@@ -42,6 +299,11 @@ namespace OKlib {
         The Maxima input/output specification is min_2resolution_closure_cs in 
         ComputerAlgebra/Satisfiability/Lisp/Primality/PrimeImplicatesImplicants.mac.
 
+        The computation is performed by BitParallelQuineMcCluskey, where the
+        number of variables used is the maximal variable occurring in the
+        input (at most num_vars), and where the number of threads can be
+        given to the constructor (0 means the number of hardware threads).
+
         For ease of use the helper-function FiniteFunctions::quine_mccluskey
         is provided below.
       */
@@ -52,6 +314,7 @@ namespace OKlib {
         //! the number of variables
         static const int num_vars = n;
         BOOST_STATIC_ASSERT(num_vars >= 1);
+        BOOST_STATIC_ASSERT(num_vars <= BitParallelQuineMcCluskey::max_num_vars);
 
         //! boolean literals as integers
         typedef typename boost::range_value<typename boost::range_value<ClauseContainer>::type >::type literal_type;
@@ -65,28 +328,13 @@ namespace OKlib {
         typedef typename boost::range_const_iterator<const clause_type>::type const_clause_iterator_type;
         //! iterator for clause-sets
         typedef typename boost::range_const_iterator<const clause_set_type>::type const_clause_set_iterator_type;
-        //! hash-table to represent an arbitrary clause-set over n variables
-        // (using 3^n bits, for each possible clause)
-        typedef std::vector<bool> HashTable;
         //! hash-values used as indices for hash-tables
-        typedef HashTable::size_type hash_index_type;
-
-        //! pow3[i] = 3^i for 0 <= i <= num_vars
-        const hash_index_type* const pow3;
-        const hash_index_type* fill_pow3() {
-          hash_index_type* const pow3 = new hash_index_type[num_vars+1];
-          hash_index_type pow = 1;
-          for (int i = 0; i < num_vars; ++i, pow *= 3) {
-            pow3[i] = pow;
-            assert(std::numeric_limits<hash_index_type>::max() - pow >= pow);
-            assert(std::numeric_limits<hash_index_type>::max() - pow >= 2*pow);
-          }
-          pow3[num_vars] = pow;
-          return pow3;
-        }
+        typedef BitParallelQuineMcCluskey::hash_index_type hash_index_type;
 
-        QuineMcCluskey() : pow3(fill_pow3()) {}
-        ~QuineMcCluskey() { delete[] pow3; }
+        //! pow3[i] = 3^i for 0 <= i <= BitParallelQuineMcCluskey::max_num_vars
+        static constexpr const auto& pow3 = BitParallelQuineMcCluskey::pow3;
+
+        explicit QuineMcCluskey(const unsigned threads = 0) : threads(threads) {}
       
         /*!
           \brief Computes the hash-value of a clause
@@ -96,7 +344,7 @@ namespace OKlib {
           c is 0, 1 or 2 respectively if variable i does not occur or occurs
           negatively resp. positively in the clause.
         */
-        hash_index_type hash_clause(const clause_type& clause) {
+        hash_index_type hash_clause(const clause_type& clause) const {
           hash_index_type return_value = 0;
           const const_clause_iterator_type cend(boost::const_end(clause));
           for (const_clause_iterator_type iter = boost::const_begin(clause); iter != cend; ++iter)
@@ -107,7 +355,7 @@ namespace OKlib {
       
         //! From a hash-value for a clause compute the new hash-value where a
         // literal (which must occur in the clause) is negated.
-        hash_index_type flip_literal(const hash_index_type hash, const literal_type literal) {
+        hash_index_type flip_literal(const hash_index_type hash, const literal_type literal) const {
           assert(literal != 0);
           if (literal < 0) return hash + pow3[std::abs(literal) - 1];
           else return hash - pow3[std::abs(literal) - 1];
@@ -115,7 +363,7 @@ namespace OKlib {
       
         //! From a hash-value for a clause compute the new hash-value where
         // a literal (which must occur in the clause) has been removed.
-        hash_index_type remove_literal(const hash_index_type hash, const literal_type literal) {
+        hash_index_type remove_literal(const hash_index_type hash, const literal_type literal) const {
           assert(literal != 0);
           if (literal < 0) return hash - pow3[std::abs(literal) - 1];
           else return hash - 2 * pow3[std::abs(literal) - 1];
@@ -131,7 +379,7 @@ namespace OKlib {
           clause must be known (so that only clause[0], ..., clause[k-1] are
           to be used).
         */
-        unsigned int hash2clause(hash_index_type hash, int clause[]) {
+        unsigned int hash2clause(hash_index_type hash, int clause[]) const {
           literal_type num_lit = 0;
           for (int lit = num_vars; lit > 0; --lit) {
             const hash_index_type var_val = pow3[lit-1];
@@ -145,65 +393,53 @@ namespace OKlib {
           }
           return num_lit;
         }
-      
+
         /*!
           \brief Compute all prime clauses of a clause-set
 
-          Only variables v <= num_vars are allowed. Time and space complexity
-          are polynomial in the full truth table, but exponential in num_vars.
+          Only variables v <= max_var <= num_vars are allowed, and the
+          computation uses max_var many variables (by default the maximal
+          variable occurring). Time and space complexity are polynomial in
+          the full truth table, but exponential in max_var.
         */
-        clause_set_type  operator() (const clause_set_type& input_cs) {
-          hash_index_type num_clauses = pow3[num_vars];
-          // "curcls" contains (as hash-table) the current clauses, to be
-          // processed:
-          HashTable curcls(num_clauses);
-          // "rescls" contains the clauses of the final result (completed
-          // once a level is finished):
-          HashTable rescls(num_clauses);
-          // first mark input clauses:
+        clause_set_type operator() (const clause_set_type& input_cs) const {
+          return (*this)(input_cs, max_variable(input_cs));
+        }
+        clause_set_type operator() (const clause_set_type& input_cs, const int max_var) const {
+          assert(max_var >= max_variable(input_cs) and max_var <= num_vars);
+          BitParallelQuineMcCluskey qmc(max_var, threads);
           {const const_clause_set_iterator_type csend = boost::const_end(input_cs);
-           for (const_clause_set_iterator_type iter = boost::const_begin(input_cs); iter != csend; ++iter) {
-             const hash_index_type hash = hash_clause(*iter);
-             curcls[hash] = true;
-             rescls[hash] = true;
-           }
-          }
-          // perform algorithm:
-          int clause[num_vars];
-          for (variable_type level = num_vars; level > 0; --level) {
-            // run through all clauses:
-            for (hash_index_type citer = 0; citer < num_clauses; ++citer)
-              if (curcls[citer]) {
-                const variable_type clause_size = hash2clause(citer, clause);
-                if (clause_size == level) {
-                  // go through literals in clause:
-                  for (variable_type liter = 0; liter < clause_size; ++liter) {
-                    // if it's partner clause exists:
-                    const hash_index_type partner_hash =
-                      flip_literal(citer, clause[liter]);
-                    if (curcls[partner_hash]) {
-                      long new_hash = remove_literal(citer, clause[liter]);
-                      curcls[new_hash] = true;
-                      rescls[new_hash] = true;
-                      rescls[citer] = false;
-                      rescls[partner_hash] = false;
-                    }
-                  }
-                  curcls[citer] = false;
-                }
-              }
+           for (const_clause_set_iterator_type iter = boost::const_begin(input_cs); iter != csend; ++iter)
+             qmc.insert(hash_clause(*iter));
           }
+          qmc.compute();
           // extraction of the result:
           clause_set_type result_cs;
-          for (hash_index_type citer = 0; citer < num_clauses; ++citer)
-            if (rescls[citer]) {
-              const variable_type clause_size = hash2clause(citer, clause);
-              std::sort(clause, clause + clause_size);
-              result_cs.push_back(clause_type(clause, clause + clause_size));
-            }
+          int clause[num_vars];
+          qmc.for_each_prime([&](const hash_index_type h) {
+            const variable_type clause_size = hash2clause(h, clause);
+            std::sort(clause, clause + clause_size);
+            result_cs.push_back(clause_type(clause, clause + clause_size));
+          });
           return result_cs;
         }
 
+        //! The maximal variable occurring in a clause-set (0 if there is none)
+        static int max_variable(const clause_set_type& input_cs) {
+          int m = 0;
+          const const_clause_set_iterator_type csend = boost::const_end(input_cs);
+          for (const_clause_set_iterator_type iter = boost::const_begin(input_cs); iter != csend; ++iter) {
+            const const_clause_iterator_type cend(boost::const_end(*iter));
+            for (const_clause_iterator_type i = boost::const_begin(*iter); i != cend; ++i)
+              m = std::max(m, int(std::abs(*i)));
+          }
+          return m;
+        }
+
+      private :
+
+        const unsigned threads;
+
       };
 
       //! Helper function to ease usage of class QuineMcCluskey
@@ -211,6 +447,11 @@ namespace OKlib {
       inline ClauseContainer quine_mccluskey(const ClauseContainer& input_cs) {
         return QuineMcCluskey<num_vars, ClauseContainer>()(input_cs);
       }
+      //! Helper function for a run-time number of variables and of threads
+      template<class ClauseContainer>
+      inline ClauseContainer quine_mccluskey(const ClauseContainer& input_cs, const int max_var, const unsigned threads = 0) {
+        return QuineMcCluskey<BitParallelQuineMcCluskey::max_num_vars, ClauseContainer>(threads)(input_cs, max_var);
+      }
 
     }
   }
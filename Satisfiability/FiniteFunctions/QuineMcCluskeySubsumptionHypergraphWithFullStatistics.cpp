@@ -1,5 +1,5 @@
 // Matthew Gwynne, 11.1.2011 (Swansea)
-/* Copyright 2010, 2011 Oliver Kullmann
+/* Copyright 2010, 2011, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -53,7 +53,7 @@ namespace {
   const std::string program = "QuineMcCluskeySubsumptionHypergraphWithFullStatistics";
   const std::string err = "ERROR[" + program + "]: ";
 
-  const std::string version = "0.2.2";
+  const std::string version = "0.2.3";
 
   using namespace OKlib::InputOutput;
 
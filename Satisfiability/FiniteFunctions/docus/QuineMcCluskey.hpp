@@ -1,5 +1,5 @@
 // Matthew Gwynne, 2.6.2009 (Swansea)
-/* Copyright 2009 Oliver Kullmann
+/* Copyright 2009, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -32,7 +32,7 @@ License, or any later version. */
 
   <h1> Versions </h1>
   
-  There are four versions of the QuineMcCluskey application built by default
+  There are six versions of the QuineMcCluskey application built by default
   by the build system.
 
   <ul>
@@ -43,14 +43,24 @@ License, or any later version. */
    <li> QuineMcCluskey-n16 allows a maximum of 16 variables. </li>
    <li> QuineMcCluskey-n16-O3-DNDEBUG is the optimised version of 
    QuineMcCluskey-n16. </li>
+   <li> QuineMcCluskey-n20 allows a maximum of 20 variables (the largest
+   value possible). </li>
+   <li> QuineMcCluskey-n20-O3-DNDEBUG is the optimised version of 
+   QuineMcCluskey-n20. </li>
   </ul>
 
-  One can build other versions of QuineMcCluskey allowing larger numbers of 
-  variables by setting up a preprocessor variable when building like so:
+  The maximal number of variables only bounds the variables allowed in the
+  input: the computation itself uses the variables 1, ..., n, where n is the
+  maximal variable occurring in the input (so QuineMcCluskey-n20 is as fast as
+  QuineMcCluskey-n16 on inputs with 16 variables). The space used are two
+  bit-tables of length 3^n (for n = 20 around 870 MB).
+
+  One can build other versions of QuineMcCluskey (for NUMBER_VARIABLES <= 20)
+  by setting up a preprocessor variable when building like so:
   
   \verbatim
 > oklib clean
-> oklib all CXXFLAGS="-DNUMBER_VARIABLES=20"
+> oklib all CXXFLAGS="-DNUMBER_VARIABLES=18"
   \endverbatim
 
 
@@ -94,4 +104,25 @@ Level 1
    clauses of length k. </li>
   </ol>
 
+  The implementation (BitParallelQuineMcCluskey in
+  FiniteFunctions/QuineMcCluskey.hpp) computes the same sets, but does not
+  run through the levels:
+  <ol>
+   <li> The clauses are represented by the bit-table S of length 3^n,
+   indexed by the ternary hash-values, where the digit of variable i is 0, 1
+   or 2 (variable not occurring, occurring negatively, positively). </li>
+   <li> For variable i with w = 3^(i-1) the table splits into blocks of
+   length 3w, and all 2-subsumption resolutions on i are performed at once
+   by setting S_0 := S_0 or (S_1 and S_2) for the three segments of each
+   block; the parents (S_1 and S_2) are marked in a second table P. </li>
+   <li> For w < 64 this is done by shifting and masking whole 64-bit words,
+   for w >= 64 segment-wise on 64 bits at a time. </li>
+   <li> This is repeated for all variables until S does not change anymore
+   (for full clause-sets two rounds over all variables are needed). </li>
+   <li> The prime clauses are the clauses in S but not in P, output in
+   ascending order of their hash-values. </li>
+   <li> Each round for a variable is split into independent parts of the
+   table, processed by as many threads as the hardware provides. </li>
+  </ol>
+
 */
@@ -1,5 +1,5 @@
 // Oliver Kullmann, 22.5.2009 (Swansea)
-/* Copyright 2009, 2011, 2012 Oliver Kullmann
+/* Copyright 2009, 2011, 2012, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -64,6 +64,53 @@ License, or any later version. */
    <li> Also information is needed on the computer and on the version of
    Quine-McCluskey. At least in the Git-history we want to see how
    running-times evolve over time. </li>
+   <li> For the bit-parallel implementation see "Bit-parallel implementation"
+   below. </li>
+  </ul>
+
+
+  \todo Bit-parallel implementation
+  <ul>
+   <li> DONE (version 0.3.0 of QuineMcCluskey)
+   The levels are replaced by rounds over the variables, each performing all
+   2-subsumption resolutions on one variable by word-operations on the
+   bit-table of all 3^n clauses (see BitParallelQuineMcCluskey in
+   QuineMcCluskey.hpp, and the docus). </li>
+   <li> DONE The number n of variables is now the maximal variable of the input
+   (at most NUMBER_VARIABLES <= 20). </li>
+   <li> Timings (user-times in seconds; vm with g++ 12.2.0, one core),
+   for the full clause-sets of boolean functions {0,1}^8 -> {0,1}^8 (16
+   variables; reading and output included), comparing version 0.2.1 with
+   version 0.3.0:
+   \verbatim
+function      primes   0.2.1   0.3.0
+Sbox          136253   7.08    0.52
+mul02             58   6.73    0.23
+mul03           5048   5.87    0.25
+random        131327   6.42    0.36
+all clauses        1   8.31    0.42
+   \endverbatim
+   (the "all clauses" case is the full clause-set with all 2^16 clauses,
+   "mul02" resp. "mul03" is the multiplication with 02 resp. 03 in the AES
+   field). The output is identical. </li>
+   <li> QuineMcCluskey-n20, with all 2^n clauses with n variables:
+   \verbatim
+ n   time
+12   0.01
+14   0.08
+16   0.42
+18   1.87
+20  16.20
+   \endverbatim
+   and for a random boolean function {0,1}^10 -> {0,1}^10 (20 variables;
+   4609347 prime implicates) 21.7s. </li>
+   <li> Now reading the input and writing the output dominates for n <= 16.
+   </li>
+   <li> The threads (see "Parallelisation") could not be evaluated on the
+   above machine (one core). </li>
+   <li> The inner loop for w = 3^i >= 64 (reading and writing 64 bits at
+   arbitrary bit-positions) could be specialised further, e.g. by handling
+   segments with the same offset modulo 64 together. </li>
   </ul>
 
 
@@ -281,6 +328,9 @@ FiniteFunctions> oklib all CXXFLAGS="-DNUMBER_VARIABLES=15" programs=QuineMcClus
      </li>
     </ol>
    </li>
+   <li> DONE Since version 0.3.0 only the variables up to the maximal variable
+   of the input are used, so there is no overhead for smaller n, and the
+   versions n=4, 16, 20 are provided. </li>
    <li> DONE So for version 2.0 a todo needs to be created, making sure that
    for smaller n there is no space and time overhead, while for now
    we only provide two versions (which are then tested --- basic tests for
@@ -393,6 +443,8 @@ FiniteFunctions> oklib all CXXFLAGS="-DNUMBER_VARIABLES=15" programs=QuineMcClus
 
   \todo pow3 should be replaced by an array computed at compile-time
   <ul>
+   <li> DONE BitParallelQuineMcCluskey::pow3 is a constexpr std::array (for
+   max_num_vars = 20), also used by QuineMcCluskey. </li>
    <li> Once we use gcc version 4.5.2 with option "-std=c++0x", then we can
    simply using the following instead of the current initialisation of pow3:
    \code
@@ -505,6 +557,11 @@ struct QuineMcCluskey {
 
   \todo Parallelisation
   <ul>
+   <li> DONE Each round of BitParallelQuineMcCluskey (for one variable) is
+   split into independent units of the table, processed by
+   std::thread::hardware_concurrency() many threads (by default).
+   Writes to words shared between units are collected per unit and
+   performed after the round. </li>
    <li> Usage of Mpi (now supported by gcc) or of threads (according to
    C++09) is to be studied. </li>
    <li> So that tackling really big tasks becomes possible. </li>
@@ -1,5 +1,5 @@
 // Matthew Gwynne, 4.10.2010 (Swansea)
-/* Copyright 2010 Oliver Kullmann
+/* Copyright 2010, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -72,6 +72,15 @@ namespace OKlib {
               clause_set_type cls_output = qmc(cls_F);
               OKLIB_TEST_EQUAL_W2(cls_intended_output, cls_output);
             }
+            { // all full clauses (using fewer variables than num_vars)
+              clause_set_type cls_F;
+              for (int i = 0; i < 8; ++i)
+                cls_F.push_back(boost::assign::list_of
+                  ((i & 1) ? -1 : 1)((i & 2) ? -2 : 2)((i & 4) ? -3 : 3));
+              const clause_set_type cls_intended_output(1);
+              OKLIB_TEST_EQUAL_W2(cls_intended_output, qmc(cls_F));
+              OKLIB_TEST_EQUAL_W2(cls_intended_output, quine_mccluskey(cls_F, 3, 3));
+            }
           }
         };
       }
@@ -0,0 +1,459 @@
+// Oliver Kullmann, 16.10.2026 (Swansea)
+/* Copyright 2026 Oliver Kullmann
+This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
+it and/or modify it under the terms of the GNU General Public License as published by
+the Free Software Foundation and included in this library; either version 3 of the
+License, or any later version. */
+
+/*!
+  \file Interfaces/DistributedSolving/ConquerCubes.cpp
+  \brief Application for processing the binary cube-file of the OKsolver
+
+  The cube-file is created by "OKsolver2002 -SB -S=file" (the format is
+  documented in Solvers/OKsolver/SAT2002/OKsolver_2002_lnk.c), e.g. via
+  "cubes=binary SplittingViaOKsolver -D20 F.cnf", which creates file
+  "Cubes" in the splitting-directory.
+
+  <ul>
+   <li> <code>ConquerCubes data Cubes</code> prints the data-file (as
+   PreprocessSplitting for the directory-form): header " i n d", followed by
+   lines "c i n_i d_i", stably sorted by decreasing n_i, where c is a
+   counter (starting with 1). </li>
+   <li> <code>ConquerCubes cubes Cubes</code> resp.
+   <code>ConquerCubes decisions Cubes</code> print the partial assignments
+   resp. the decisions in the text-format (as for option -SF). </li>
+   <li> <code>ConquerCubes run SplitDir ProcessDir T "solver-call"
+   [begin [end]]</code> solves the sub-instances with counters
+   begin <= c <= end (default 1 and N) with T parallel solver-processes:
+    <ol>
+     <li> SplitDir is the directory created by SplittingViaOKsolver (with the
+     files F and Cubes). </li>
+     <li> ProcessDir is created if it does not exist; otherwise the
+     processing is continued (the counters already in SubinstanceStatistics
+     are skipped). </li>
+     <li> The sub-instances are processed in the order of the data-file;
+     each worker adds the cube as unit-clauses to the instance (as
+     InsertPassAsUnit.awk), writes it to "Temp_w.cnf", and calls the
+     solver (split at spaces, with the file-name appended; output to
+     "Temp_w.out"). </li>
+     <li> Expected return-values of the solver are 0 (unknown), 10 (sat) and
+     20 (unsat); otherwise the processing is stopped (after the running
+     calls have finished). </li>
+     <li> Per sub-instance, a line "c i npa d ret utime wtime E" is
+     appended to ProcessDir/SubinstanceStatistics (with header line
+     " i npa d ret utime wtime H"; utime is the user+system time of the
+     solver-process, wtime the wall-clock time, both in seconds). </li>
+     <li> As with ProcessSplitViaOKsolver, the extraction-tool for the
+     solver is determined by "SelectExtractionTool solver" (from
+     Experimentation/ExperimentSystem/SolverMonitoring); H is the output of
+     "tool header-only" (containing "sat"), and E the output of
+     "tool data-only" on the solver-output. If no tool is available (the
+     solver is unknown, or the scripts are not on the path), then H is
+     "sat", and E is 0, 1, 2 for unsat, sat, unknown. </li>
+     <li> For satisfiable sub-instances, "c i" is appended to
+     SatisfyingAssignments, and the solver-output is kept as "Sat_i.out".
+     </li>
+     <li> Upon completion the file Result is created (SATISFIABLE,
+     UNSATISFIABLE, or UNKNOWN if not all sub-instances have been decided,
+     followed by the totals). </li>
+    </ol>
+   </li>
+  </ul>
+
+*/
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <filesystem>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <set>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cassert>
+#include <ctime>
+
+#include <spawn.h>
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+
+extern char** environ;
+
+namespace {
+
+  enum {
+    errcode_parameter = 1,
+    errcode_file = 2,
+    errcode_solver = 3
+  };
+
+  const std::string program = "ConquerCubes";
+  const std::string err = "ERROR[" + program + "]: ";
+
+  const std::string version = "0.2.0";
+
+  typedef std::uint64_t uint_type;
+  typedef std::vector<std::int32_t> literals_t;
+  typedef std::vector<std::uint32_t> decisions_t;
+
+  constexpr std::array<char, 8> magic{'O','K','c','u','b','e','s','1'};
+
+  struct Cube {
+    decisions_t dec; // positions of the decisions in lits
+    literals_t lits;
+  };
+
+  // The index and the sizes of the cubes (not the cubes themselves):
+  struct CubeFile {
+    std::string name;
+    std::vector<uint_type> offsets;
+    std::vector<std::uint32_t> n, d;
+
+    explicit CubeFile(const std::string& file) : name(file) {
+      std::ifstream in(file, std::ios::binary);
+      if (not in) throw std::runtime_error("Can not open file \"" + file + "\".");
+      std::array<char, 8> m;
+      uint_type N, index;
+      read(in, m); read(in, N); read(in, index);
+      if (m != magic)
+        throw std::runtime_error("File \"" + file + "\" is not a cube-file.");
+      if (index + N * sizeof(uint_type) != std::filesystem::file_size(file))
+        throw std::runtime_error("File \"" + file + "\" is incomplete.");
+      offsets.resize(N); n.resize(N); d.resize(N);
+      in.seekg(index);
+      for (uint_type& o : offsets) read(in, o);
+      for (uint_type i = 0; i < N; ++i) {
+        in.seekg(offsets[i]);
+        read(in, d[i]); read(in, n[i]);
+      }
+    }
+    uint_type size() const noexcept { return offsets.size(); }
+
+    // Cube i (0-based), using stream in for file:
+    Cube cube(std::istream& in, const uint_type i) const {
+      assert(i < size());
+      in.seekg(offsets[i] + 2 * sizeof(std::uint32_t));
+      Cube C{decisions_t(d[i]), literals_t(n[i])};
+      for (auto& x : C.dec) read(in, x);
+      for (auto& x : C.lits) read(in, x);
+      return C;
+    }
+
+    // The 0-based indices in the order of the data-file:
+    std::vector<uint_type> order() const {
+      std::vector<uint_type> res(size());
+      for (uint_type i = 0; i < size(); ++i) res[i] = i;
+      std::ranges::stable_sort(res, [this](const uint_type a, const uint_type b){return n[a] > n[b];});
+      return res;
+    }
+
+    template <typename T>
+    void read(std::istream& in, T& x) const {
+      in.read(reinterpret_cast<char*>(&x), sizeof(T));
+      if (not in) throw std::runtime_error("Reading error with \"" + name + "\".");
+    }
+  };
+
+
+  // The instance, split at the p-line:
+  struct Instance {
+    std::string comments, body;
+    uint_type n, c;
+    explicit Instance(const std::string& file) {
+      std::ifstream in(file);
+      if (not in) throw std::runtime_error("Can not open file \"" + file + "\".");
+      std::string line;
+      while (std::getline(in, line) and not line.starts_with("p cnf "))
+        comments += line + "\n";
+      std::istringstream p(line.substr(6));
+      if (not (p >> n >> c))
+        throw std::runtime_error("No valid p-line in \"" + file + "\".");
+      std::ostringstream rest; rest << in.rdbuf();
+      body = rest.str();
+    }
+    void write(const std::string& file, const literals_t& units) const {
+      std::ofstream out(file);
+      out << comments << "p cnf " << n << " " << c + units.size() << "\n";
+      for (const auto x : units) out << x << " 0\n";
+      out << body;
+      if (not out)
+        throw std::runtime_error("Error writing file \"" + file + "\".");
+    }
+  };
+
+
+  struct SolverResult {
+    int ret;
+    double utime, wtime;
+  };
+  double seconds(const timeval& t) noexcept {
+    return t.tv_sec + t.tv_usec / 1e6;
+  }
+  // Running args + file, with output to out:
+  SolverResult run_solver(std::vector<std::string> args,
+                          const std::string& file, const std::string& out) {
+    args.push_back(file);
+    std::vector<char*> argv;
+    for (auto& a : args) argv.push_back(a.data());
+    argv.push_back(nullptr);
+    posix_spawn_file_actions_t fa;
+    posix_spawn_file_actions_init(&fa);
+    posix_spawn_file_actions_addopen(&fa, 1, out.c_str(),
+                                     O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    posix_spawn_file_actions_adddup2(&fa, 1, 2);
+    const auto start = std::chrono::steady_clock::now();
+    pid_t pid;
+    const int e = posix_spawnp(&pid, argv[0], &fa, nullptr, argv.data(), environ);
+    posix_spawn_file_actions_destroy(&fa);
+    if (e != 0)
+      throw std::runtime_error("Can not start solver \"" + args[0] + "\": " +
+                               std::strerror(e) + ".");
+    int status; rusage ru;
+    if (wait4(pid, &status, 0, &ru) != pid)
+      throw std::runtime_error("Waiting for the solver failed.");
+    const double wtime = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+    const int ret = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+    return {ret, seconds(ru.ru_utime) + seconds(ru.ru_stime), wtime};
+  }
+
+  // The standard output of the shell-command cmd, without final newlines:
+  std::string shell_output(const std::string& cmd) {
+    FILE* const p = popen(cmd.c_str(), "r");
+    if (not p) throw std::runtime_error("Can not run \"" + cmd + "\".");
+    std::string res;
+    std::array<char, 4096> buf;
+    for (std::size_t n; (n = std::fread(buf.data(), 1, buf.size(), p)) != 0;)
+      res.append(buf.data(), n);
+    pclose(p);
+    while (not res.empty() and res.back() == '\n') res.pop_back();
+    return res;
+  }
+  // The extraction-tool for the solver, or the empty string:
+  std::string extraction_tool(const std::string& solver) {
+    const std::string res =
+      shell_output("SelectExtractionTool '" + solver + "' 2>/dev/null");
+    return res == "UNKNOWN" or res.find_first_of(" \n") != std::string::npos ?
+      "" : res;
+  }
+
+  std::string timestamp() {
+    const std::time_t t = std::time(nullptr);
+    char buf[64];
+    std::strftime(buf, sizeof buf, "%c", std::localtime(&t));
+    return buf;
+  }
+
+
+  int data(const CubeFile& F) {
+    std::cout << " i n d\n";
+    uint_type c = 0;
+    for (const uint_type i : F.order())
+      std::cout << ++c << " " << i+1 << " " << F.n[i] << " " << F.d[i] << "\n";
+    return 0;
+  }
+  int text(const CubeFile& F, const bool decisions) {
+    std::ifstream in(F.name, std::ios::binary);
+    for (uint_type i = 0; i < F.size(); ++i) {
+      const Cube C = F.cube(in, i);
+      if (decisions) {
+        std::cout << C.dec.size() << " ";
+        for (const auto p : C.dec) std::cout << p << " ";
+      }
+      else {
+        std::cout << "v";
+        for (const auto x : C.lits) std::cout << " " << x;
+        std::cout << " 0";
+      }
+      std::cout << "\n";
+    }
+    return 0;
+  }
+
+
+  int run(const std::string& splitdir, const std::string& procdir,
+          const unsigned T, const std::string& solver_call,
+          uint_type begin, uint_type end) {
+    namespace fs = std::filesystem;
+    std::string fname;
+    {std::ifstream f(splitdir + "/F"); std::getline(f, fname);}
+    if (fname.empty())
+      throw std::runtime_error("File \"" + splitdir + "/F\" missing or empty.");
+    const Instance I(splitdir + "/" + fname);
+    const CubeFile F(splitdir + "/Cubes");
+    const uint_type N = F.size();
+    end = std::min(end, N);
+    const std::vector<uint_type> order = F.order();
+    std::vector<std::string> args;
+    {std::istringstream s(solver_call);
+     for (std::string a; s >> a;) args.push_back(a);}
+    if (args.empty()) throw std::runtime_error("Empty solver-call.");
+    const std::string tool = extraction_tool(args[0]);
+
+    const std::string stats = procdir + "/SubinstanceStatistics";
+    const bool cont = fs::exists(procdir);
+    std::set<uint_type> done;
+    if (cont) {
+      std::ifstream in(stats);
+      std::string line; std::getline(in, line);
+      for (uint_type c; in >> c; in.ignore(1024, '\n')) done.insert(c);
+    }
+    else {
+      fs::create_directory(procdir);
+      std::ofstream p(procdir + "/Parameter");
+      p << program << " version " << version << "\n" << splitdir << "\n"
+        << procdir << "\nSolver-call: " << solver_call << "\nT=" << T << "\n"
+        << "Extraction-tool: " << (tool.empty() ? "none" : tool) << "\n";
+      std::ofstream(stats) << " i npa d ret utime wtime "
+        << (tool.empty() ? "sat" : shell_output(tool + " header-only")) << "\n";
+    }
+    std::ofstream(procdir + "/Log", std::ios::app)
+      << (cont ? "Continuation: " : "Begin: ") << timestamp() << "\n"
+      << "Version = " << version << ", range = " << begin << " " << end
+      << ", T = " << T << "\n";
+
+    std::vector<uint_type> todo;
+    for (uint_type c = begin; c <= end; ++c)
+      if (not done.contains(c)) todo.push_back(c);
+    std::cout << "Processing " << todo.size() << " of " << N
+              << " sub-instances with T=" << T << "." << std::endl;
+
+    std::ofstream statsout(stats, std::ios::app);
+    std::mutex m;
+    std::atomic<uint_type> next = 0;
+    std::atomic<bool> failed = false;
+    std::string failure;
+    const auto work = [&](const unsigned w) {
+      std::ifstream in(F.name, std::ios::binary);
+      const std::string cnf = procdir + "/Temp_" + std::to_string(w) + ".cnf",
+        out = procdir + "/Temp_" + std::to_string(w) + ".out";
+      try {
+        for (uint_type j; not failed and (j = next++) < todo.size();) {
+          const uint_type c = todo[j], i = order[c-1];
+          I.write(cnf, F.cube(in, i).lits);
+          const SolverResult r = run_solver(args, cnf, out);
+          if (r.ret != 0 and r.ret != 10 and r.ret != 20) {
+            std::lock_guard l(m);
+            failure = "Unexpected return value " + std::to_string(r.ret) +
+              " for c=" + std::to_string(c) + ".";
+            failed = true; return;
+          }
+          const int sat = r.ret == 20 ? 0 : r.ret == 10 ? 1 : 2;
+          const std::string extracted = tool.empty() ? std::to_string(sat) :
+            shell_output(tool + " data-only < '" + out + "'");
+          std::lock_guard l(m);
+          if (sat == 1) {
+            fs::copy_file(out, procdir + "/Sat_" + std::to_string(i+1) + ".out",
+                          fs::copy_options::overwrite_existing);
+            std::ofstream(procdir + "/SatisfyingAssignments", std::ios::app)
+              << c << " " << i+1 << "\n";
+            std::cout << "\nFound a SATISFYING ASSIGNMENT: " << c << std::endl;
+          }
+          statsout << c << " " << i+1 << " " << F.n[i] << " " << F.d[i] << " "
+                   << r.ret << " " << r.utime << " " << r.wtime << " "
+                   << extracted << std::endl;
+          std::cout << c << " " << std::flush;
+        }
+      }
+      catch (const std::exception& e) {
+        std::lock_guard l(m);
+        failure = e.what(); failed = true;
+      }
+      fs::remove(cnf); fs::remove(out);
+    };
+    {std::vector<std::thread> workers;
+     for (unsigned w = 0; w < T; ++w) workers.emplace_back(work, w);
+     for (auto& t : workers) t.join();
+    }
+    std::cout << std::endl;
+    statsout.close();
+    if (failed) {
+      std::ofstream(procdir + "/Log", std::ios::app)
+        << "ERROR: " << timestamp() << "\n" << failure << "\n";
+      std::cerr << err << failure << "\n";
+      return errcode_solver;
+    }
+
+    // Evaluation of all results:
+    std::array<uint_type, 3> count{}; std::array<double, 3> time{};
+    {std::ifstream in(stats);
+     std::string line; std::getline(in, line);
+     while (std::getline(in, line)) {
+       std::istringstream l(line);
+       uint_type c, i, n, d; int ret; double ut, wt;
+       if (not (l >> c >> i >> n >> d >> ret >> ut >> wt)) break;
+       const int sat = ret == 20 ? 0 : ret == 10 ? 1 : 2;
+       ++count[sat]; time[sat] += ut;
+     }
+    }
+    const uint_type total = count[0] + count[1] + count[2];
+    std::ofstream res(procdir + "/Result");
+    const std::string result = count[1] != 0 ? "SATISFIABLE" :
+      count[2] == 0 and total == N ? "UNSATISFIABLE" : "UNKNOWN";
+    res << result << "\n"
+        << "unsat:" << count[0] << ", " << time[0] << "s; sat:" << count[1]
+        << ", " << time[1] << "s; unknown:" << count[2] << ", " << time[2]
+        << "s; open:" << N - total << "\n";
+    std::cout << "Instance " << result << ".\n";
+    std::ofstream(procdir + "/Log", std::ios::app)
+      << "Completed: " << timestamp() << "\n";
+    return 0;
+  }
+
+}
+
+int main(const int argc, const char* const argv[]) {
+  if (argc < 3) {
+    std::cerr << err << "At least two arguments are needed, the mode"
+      " (\"data\", \"cubes\", \"decisions\", \"run\") and the cube-file resp."
+      " the splitting-directory.\n";
+    return errcode_parameter;
+  }
+  const std::string mode = argv[1];
+
+  try {
+    if (mode == "data" or mode == "cubes" or mode == "decisions") {
+      if (argc != 3) {
+        std::cerr << err << "Mode \"" << mode << "\" needs exactly one"
+          " further argument, the cube-file.\n";
+        return errcode_parameter;
+      }
+      const CubeFile F(argv[2]);
+      return mode == "data" ? data(F) : text(F, mode == "decisions");
+    }
+    else if (mode == "run") {
+      if (argc < 6 or argc > 8) {
+        std::cerr << err << "Mode \"run\" needs the arguments SplitDir"
+          " ProcessDir T solver-call [begin [end]].\n";
+        return errcode_parameter;
+      }
+      const unsigned T = std::max(1ul, std::stoul(argv[4]));
+      const uint_type begin = argc >= 7 ? std::max(1ull, std::stoull(argv[6])) : 1;
+      const uint_type end = argc == 8 ? std::stoull(argv[7]) : uint_type(-1);
+      return run(argv[2], argv[3], T, argv[5], begin, end);
+    }
+    else {
+      std::cerr << err << "Unknown mode \"" << mode << "\".\n";
+      return errcode_parameter;
+    }
+  }
+  catch (const std::invalid_argument&) {
+    std::cerr << err << "Invalid numerical argument.\n";
+    return errcode_parameter;
+  }
+  catch (const std::exception& e) {
+    std::cerr << err << e.what() << "\n";
+    return errcode_file;
+  }
+}
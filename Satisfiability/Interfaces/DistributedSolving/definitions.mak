@@ -3,9 +3,9 @@
 General_options := -g
 Optimisation_options := -O3 -DNDEBUG
 
-programs := PreprocessSplitting CollectingPartialAssignments CollectingDecisions
+programs := PreprocessSplitting CollectingPartialAssignments CollectingDecisions ConquerCubes
 
 source_libraries = $(boost_include_option_okl)
 
-link_libraries := 
+link_libraries := -pthread
 
@@ -61,8 +61,8 @@ namespace CommandLine {
   using size_t = CD::size_t;
   using weights_t = OP::weights_t;
 
-  const std::string version_laMols = "0.105.2";
-  const std::string date_laMols = "12.2.2024";
+  const std::string version_laMols = "0.106.0";
+  const std::string date_laMols = "16.10.2026";
   constexpr int commandline_args_laMols = 15;
 
   typedef std::vector<size_t> list_size_t;
@@ -241,6 +241,40 @@ namespace CommandLine {
     if (x.empty()) return default_threads;
     else return FloatingPoint::to_float64(x);
   }
+  /* For la-solvers the threads-argument has the form "T" or "T,L",
+     where T is as above, and L >= 1 is the number of threads for the
+     probes of la-reduction:
+  */
+  constexpr unsigned default_lathreads = 1;
+  std::pair<double, unsigned> read_lathreads(const int argc,
+                      const char* const argv[], const int pos) {
+    assert(argc > pos);
+    const std::string x = argv[pos];
+    const auto find = x.find(',');
+    if (find == std::string::npos)
+      return {read_threads(argc, argv, pos), default_lathreads};
+    const std::string T = x.substr(0, find), L = x.substr(find+1);
+    const unsigned lathreads = L.empty() ? default_lathreads :
+      FloatingPoint::to_UInt(L);
+    if (lathreads == 0) {
+      std::ostringstream ss;
+      ss << "ERROR[CommandLine::read_lathreads]: the number of"
+        " la-threads must be at least 1.\n";
+      throw std::runtime_error(ss.str());
+    }
+    return {T.empty() ? default_threads : FloatingPoint::to_float64(T),
+            lathreads};
+  }
+
+  void lathreads_output(std::ostream& out, const unsigned lathreads) {
+    out << "# lathreads=" << lathreads << "\n";
+  }
+  // The sums over all runs of the parallel-probing counters:
+  void parprobes_output(std::ostream& out,
+                        const size_t parpasses, const size_t parprobes) {
+    out << "# la-parallel: parpasses=" << parpasses
+        << " parprobes=" << parprobes << "\n";
+  }
 
   constexpr unsigned default_comdist = 1;
   typedef std::vector<unsigned> list_unsigned_t;
@@ -42,16 +42,23 @@ License, or any later version. */
          in Solvers.hpp: GcStoppingData = StoppingData<OP::STO>
      - ListStoppingData, a wrapper for a vector of LRStoppingData
 
+     - class ThreadShards<T>: one object of type T per thread (created
+       on first access via local()), with merging via for_each
+
      - class rlaStats: contains
-       - an array S of size 2 of the extracted data from
-         LR::ReductionStatistics (for inner nodes and leaves)
+       - per thread an array S of size 2 of the extracted data from
+         LR::ReductionStatistics (for inner nodes and leaves), and the
+         list of solutions (merged by stats() and sols())
        - a member of type ListStoppingData
        - an atomic_bool (set by member-function activate_abort, read
          by the Gecode-DFS-handler)
-       - the list of solutions, and the counter of solutions
+       - atomic counters for nodes, leaves and solutions (relaxed)
+       - per thread the sums of parpasses and parprobes (merged by
+         parstats())
        - a pointer to the log-stream
        - a pointer to the Encoding-object.
-      The main member function is add(LR::ReductionStatistics).
+      The main member function is add(LR::ReductionStatistics); only
+      output to the log-streams is locked.
       Solvers::rlasolver creates one global (singleton) rlaStats-object,
       to aggregate the statistics (and handle abort).
 
@@ -60,7 +67,7 @@ License, or any later version. */
      - create_la: similar to create above, but now producing a const VVElim*
 
     - class RlaBranching, derived from GC::Brancher:
-       - choice calls the add-function of rlaStats (possibly locked)
+       - choice calls the add-function of rlaStats (lock-free)
        - commit calls commit0
        - commit0 calles update_clone() for the current node, and
          eliminates all values from the la-reduction.
@@ -123,6 +130,8 @@ TODOS:
 #include <map>
 #include <array>
 #include <numeric>
+#include <memory>
+#include <thread>
 
 #include <cassert>
 #include <cstdlib>
@@ -298,6 +307,7 @@ namespace LookaheadBranching {
     const OP::GBO bo;
     const bool parallel;
     const bool tree_logging;
+    const unsigned lathreads; // threads for the probes in la-reduction
   };
 
   template <typename STO>
@@ -343,6 +353,58 @@ namespace LookaheadBranching {
     map_t m;
   };
 
+  /* Per-thread objects of type T, to be merged (via for_each) when no
+     thread accesses them anymore; only the creation of a new shard is
+     locked.
+     The thread-local cache is keyed by a unique id (not by the address,
+     which might be reused by a later object); a thread switching between
+     several objects of the same type re-finds its shard.
+  */
+  template <class T>
+  class ThreadShards {
+    struct alignas(64) shard_t {
+      const std::thread::id owner;
+      T data;
+    };
+    inline static std::atomic<size_t> next_id = 1;
+    const size_t id_ = next_id.fetch_add(1, std::memory_order_relaxed);
+    mutable std::mutex m;
+    std::vector<std::unique_ptr<shard_t>> shards;
+
+  public :
+
+    ThreadShards() noexcept = default;
+    ThreadShards(const ThreadShards&) = delete;
+
+    T& local() {
+      thread_local size_t cache_id = 0;
+      thread_local T* cache = nullptr;
+      if (cache_id == id_) return *cache;
+      const auto owner = std::this_thread::get_id();
+      std::lock_guard<std::mutex> lock(m);
+      const auto find = std::ranges::find_if(shards,
+        [&owner](const auto& p){return p->owner == owner;});
+      if (find != shards.end()) cache = &(*find)->data;
+      else {
+        shards.emplace_back(new shard_t{owner, T{}});
+        cache = &shards.back()->data;
+      }
+      cache_id = id_;
+      return *cache;
+    }
+
+    size_t size() const noexcept {
+      std::lock_guard<std::mutex> lock(m); return shards.size();
+    }
+    // In the order of creation:
+    template <class F>
+    void for_each(F f) const {
+      std::lock_guard<std::mutex> lock(m);
+      for (const auto& p : shards) f(std::as_const(p->data));
+    }
+  };
+
+
   struct rlaStats {
     typedef GenStats::GStdStats<LR::ReductionStatistics::num_stats> stats0_t;
     typedef std::array<stats0_t, 2> stats_t;
@@ -362,14 +424,41 @@ namespace LookaheadBranching {
     }
     rlaStats(const rlaStats&) = delete;
 
-    size_t sol_count() const noexcept { return sol_counter; }
-    size_t inds() const noexcept { return S[0].N(); }
-    size_t lvs() const noexcept { return S[1].N(); }
-    size_t nds() const noexcept { return S[0].N() + S[1].N(); }
-
-    const stats_t& stats() const noexcept { return S; }
+    size_t sol_count() const noexcept {
+      return sol_counter.load(std::memory_order_relaxed);
+    }
+    size_t lvs() const noexcept {
+      return leaf_counter.load(std::memory_order_relaxed);
+    }
+    size_t nds() const noexcept {
+      return node_counter.load(std::memory_order_relaxed);
+    }
+    size_t inds() const noexcept {
+      return inode_counter.load(std::memory_order_relaxed);
+    }
 
-    const sollist_t& sols() const noexcept { return sols_; }
+    // The merged statistics (to be called after the search):
+    stats_t stats() const noexcept {
+      stats_t res;
+      shards.for_each([&res](const shard_t& sh){
+                        res[0] += sh.S[0]; res[1] += sh.S[1];});
+      return res;
+    }
+    // The sums of parpasses and parprobes (to be called after the search):
+    std::pair<size_t, size_t> parstats() const noexcept {
+      std::pair<size_t, size_t> res;
+      shards.for_each([&res](const shard_t& sh){
+                        res.first += sh.parpasses;
+                        res.second += sh.parprobes;});
+      return res;
+    }
+    sollist_t sols() const {
+      sollist_t res;
+      shards.for_each([&res](const shard_t& sh){
+                        res.insert(res.end(), sh.sols.begin(), sh.sols.end());
+                      });
+      return res;
+    }
 
     static void activate_abort([[maybe_unused]]int dummy=0) noexcept {
       abort.store(true, std::memory_order_relaxed);
@@ -384,21 +473,27 @@ namespace LookaheadBranching {
         case OP::LRST::inds :
           if (inds() > val) {activate_abort(); return;} else break;
         case OP::LRST::satc :
-          if (sol_counter > val) {activate_abort(); return;} else break;
+          if (sol_count() > val) {activate_abort(); return;} else break;
         case OP::LRST::none : assert(false); }
     }
 
     // changes s only by moving solutions; updates idref:
     void add(LR::ReductionStatistics& s, size_t& idref) noexcept {
-      S[s.leaf()] += s.extract();
-      idref = S[0].N() + S[1].N();
+      shard_t& sh = shards.local();
+      const bool leaf = s.leaf();
+      sh.S[leaf] += s.extract();
+      sh.parpasses += s.parpasses(); sh.parprobes += s.parprobes();
+      (leaf ? leaf_counter : inode_counter).fetch_add(1,
+                                                std::memory_order_relaxed);
+      idref = node_counter.fetch_add(1, std::memory_order_relaxed) + 1;
       const size_t solc = s.solc();
-      size_t old_sol_counter = sol_counter;
-      sol_counter += solc;
+      size_t old_sol_counter =
+        sol_counter.fetch_add(solc, std::memory_order_relaxed);
       handle_abort();
       if (solc == 0) return;
       assert(BS::alldiffelem(s.sollist()));
       if (log) {
+        std::lock_guard<std::mutex> lock(out_mutex);
         if (enc) {
           assert(solc == s.sollist().size());
           for (auto& sol : s.sollist()) {
@@ -414,15 +509,15 @@ namespace LookaheadBranching {
         else {
           assert(s.sollist().empty());
           *log << " "; if (solc > 1) *log << solc << ",";
-          *log << sol_counter;
+          *log << old_sol_counter + solc;
           log -> flush(); ;
         }
       }
       else {
         if (not s.sollist().empty()) {
           assert(s.sollist().size() == solc);
-          sols_.reserve(sols_.size() + solc);
-          for (auto& sol : s.sollist()) sols_.push_back(std::move(sol));
+          sh.sols.reserve(sh.sols.size() + solc);
+          for (auto& sol : s.sollist()) sh.sols.push_back(std::move(sol));
         }
       }
     }
@@ -434,6 +529,7 @@ namespace LookaheadBranching {
       const auto gecode_width = ValVec::width(ch->br);
       assert(gecode_width >= 1);
       const auto width = gecode_width==1 ? 0 : gecode_width;
+      std::lock_guard<std::mutex> lock(out_mutex);
       *tree_logging << "\n"
                     << s.nodedata() << " " << width << "\n"
                     << *ch << "\n"
@@ -441,9 +537,16 @@ namespace LookaheadBranching {
     }
 
   private :
-    sollist_t sols_;
-    stats_t S; // statistics for inner nodes (S[0]) resp. leaves (S[1])
-    size_t sol_counter;
+    struct shard_t {
+      stats_t S; // statistics for inner nodes (S[0]) resp. leaves (S[1])
+      sollist_t sols;
+      size_t parpasses = 0, parprobes = 0;
+    };
+    ThreadShards<shard_t> shards;
+    std::atomic<size_t> sol_counter;
+    std::atomic<size_t> node_counter = 0, inode_counter = 0,
+      leaf_counter = 0;
+    mutable std::mutex out_mutex; // for log and tree_logging
     std::ostream* const log;
     std::ostream* const tree_logging;
     const EC::EncCond* const enc;
@@ -483,7 +586,6 @@ namespace LookaheadBranching {
     const rlaParams P;
   private :
     rlaStats* const S;
-    inline static std::mutex stats_mutex;
 
     RlaBranching(GC::Space& home, RlaBranching& b)
       : GC::Brancher(home,b), P(b.P), S(b.S) {}
@@ -502,20 +604,13 @@ namespace LookaheadBranching {
 
     const GC::Choice* choice(GC::Space& s0) override {
       CT::GenericMols1& s = static_cast<CT::GenericMols1&>(s0);
-      auto stats = LR::lareduction(&s, P.rt, P.rdl, P.lar);
+      auto stats = LR::lareduction(&s, P.rt, P.rdl, P.lar, P.lathreads);
       VVElim* const res = stats.leaf() ? new VVElim(*this, {}, {}) :
         [this,&s,&stats]{const int v = GV::gcbv(s.V, P.bv);
           return create_la(v, GV::values(s.V, v), P.bt, P.bo, *this,
                            std::move(stats.elims()));}();
-      if (P.parallel) {
-        std::lock_guard<std::mutex> lock(stats_mutex);
-        S->add(stats, s.idref());
-        if (P.tree_logging) S->tree_data(s, stats, res);
-      }
-      else {
-        S->add(stats, s.idref());
-        if (P.tree_logging) S->tree_data(s, stats, res);
-      }
+      S->add(stats, s.idref());
+      if (P.tree_logging) S->tree_data(s, stats, res);
       res->id = s.nodedata().id;
       return res;
     }
@@ -572,6 +667,7 @@ namespace LookaheadBranching {
     const OP::RDL rdl;
     const OP::LAR lar;
     const bool parallel;
+    const unsigned lathreads; // threads for the probes in la-reduction
   };
 
   class BranchingStatistics {
@@ -715,8 +811,11 @@ namespace LookaheadBranching {
     typedef GenStats::GStdStats<BranchingStatistics::num_stats> bstats_t;
   private :
     rlaStats rla_;
-    mstats_t mS;
-    bstats_t bS;
+    struct shard_t {
+      mstats_t mS;
+      bstats_t bS;
+    };
+    ThreadShards<shard_t> shards;
   public :
 
     laStats(std::ostream* const log, std::ostream* const tlog,
@@ -725,20 +824,29 @@ namespace LookaheadBranching {
       : rla_(log, nullptr, enc, st) {} // tree-logging for rla not used
 
     const rlaStats& rla() const noexcept { return rla_; }
-    const mstats_t& mstats() const noexcept { return mS; }
-    const bstats_t& bstats() const noexcept { return bS; }
+    // The merged statistics (to be called after the search):
+    mstats_t mstats() const noexcept {
+      mstats_t res;
+      shards.for_each([&res](const shard_t& sh){res += sh.mS;});
+      return res;
+    }
+    bstats_t bstats() const noexcept {
+      bstats_t res;
+      shards.for_each([&res](const shard_t& sh){res += sh.bS;});
+      return res;
+    }
 
     void add(LR::ReductionStatistics& s0,
              const MeasureStatistics& s1,
              size_t& idref) noexcept {
       rla_.add(s0, idref);
-      mS += s1.extract();
+      shards.local().mS += s1.extract();
     }
     void add(LR::ReductionStatistics& s0,
              const BranchingStatistics& s2,
              size_t& idref) noexcept {
       rla_.add(s0, idref);
-      bS += s2.extract();
+      shards.local().bS += s2.extract();
     }
 
   };
@@ -771,7 +879,6 @@ namespace LookaheadBranching {
     typedef RandGen::RandGen_t* randgen_pt;
     const randgen_pt randgen;
     laStats* const S;
-    inline static std::mutex stats_mutex;
 
     LaBranching(GC::Space& home, LaBranching& b)
       : GC::Brancher(home,b), P(b.P), weights(b.weights),
@@ -800,15 +907,12 @@ namespace LookaheadBranching {
       const GV::domsizes_t V0 = GV::domsizes(s.V);
       const GV::degrees_t V0deg = GV::degrees(s.V);
 
-      auto stats0 = LR::lareduction(&s, P.rt, P.rdl, P.lar);
+      auto stats0 = LR::lareduction(&s, P.rt, P.rdl, P.lar, P.lathreads);
       {MeasureStatistics mstats(s);
        mstats.set_nodetype(stats0.leaf() ? NodeType::leaf : // XXX
                            NodeType::inode);
        if (mstats.nodetype() != NodeType::inode) {
-         if (P.parallel) {
-           std::lock_guard<std::mutex> lock(stats_mutex);
-           S->add(stats0, mstats, s.idref());
-         } else S->add(stats0, mstats, s.idref());
+         S->add(stats0, mstats, s.idref());
          return new VVElim(*this, {}, {});
        }
       }
@@ -939,10 +1043,7 @@ namespace LookaheadBranching {
         }
       }
       bstats.time(timing()-t0);
-      if (P.parallel) {
-        std::lock_guard<std::mutex> lock(stats_mutex);
-        S->add(stats0, bstats, s.idref());
-      } else S->add(stats0, bstats, s.idref());
+      S->add(stats0, bstats, s.idref());
       return create_la(bestv, std::move(values), P.bt, *this,
                        std::move(stats0.elims()), std::move(mv),
                        binfirsteq);
@@ -20,7 +20,10 @@ License, or any later version. */
     - sollist_t for a vector of solutions from GV
     - lit_t for a pair of int ("variable != value")
     - assignment_t for a vector of lit_t
-    - pruning_table_t for a set of lit_t
+
+   - class pruning_table_t for a set of lit_t, as an epoch-stamped array
+     indexed by v*width+val (lareduction uses two tables per thread, which
+     are only re-sized if the dimensions change)
 
    - class ReductionStatistics for the results of one reduction
 
@@ -32,8 +35,18 @@ License, or any later version. */
      - version probe(m, v, val, PV, stats, with_sols) updates the
        pruning table PV
 
-   - function lareduction(m, rt, lar) performs la-reduction for m,
-     and returns ReductionStatistics.
+   - struct ProbeResult: the result of one probe, as computed by
+     probe(m, v, val, with_fixed, with_sols)
+   - class ProbePool: helper-threads waiting for the jobs of the passes
+     (lareduction keeps one pool per thread)
+   - class ParallelProbes<SPA>: computing the probes of (the remainder of)
+     a round by the threads of a ProbePool, speculatively on the current
+     node
+
+   - function lareduction(m, rt, rdl, lar, threads=1) performs
+     la-reduction for m, and returns ReductionStatistics; for threads >= 2
+     the probes are performed via ParallelProbes, with the same result
+     as for threads=1 (only the parallel-statistics differ).
 
 
 BUGS:
@@ -47,13 +60,21 @@ TODOS:
 
 #include <vector>
 #include <memory>
-#include <set>
 #include <algorithm>
+#include <initializer_list>
 #include <utility>
 #include <array>
 #include <string>
 #include <exception>
 #include <ostream>
+#include <thread>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+#include <cstdint>
 
 #include <cassert>
 
@@ -85,6 +106,113 @@ namespace LookaheadReduction {
   typedef std::vector<lit_t> assignment_t;
 
 
+  /* Pruning tables */
+
+  /* A set of literals v=val (v a variable-index, val >= 0 a value), for
+     0 <= v < numvars and 0 <= val < width, stored as an array of stamps
+     (element i = v*width+val is contained iff its stamp is the current
+     epoch), together with the list of contained indices; clear() is O(1)
+     (besides the rare reset at epoch-overflow), and reset(V) only
+     re-allocates if the dimensions change.
+  */
+  class pruning_table_t {
+    typedef std::uint32_t epoch_t;
+    size_t width_ = 0;
+    std::vector<epoch_t> stamp_;
+    epoch_t epoch_ = 1;
+    std::vector<size_t> elems_; // in order of insertion
+
+    size_t index(const lit_t x) const noexcept {
+      assert(x.first >= 0 and x.second >= 0);
+      assert(size_t(x.second) < width_);
+      return size_t(x.first) * width_ + size_t(x.second);
+    }
+    void insert_index(const size_t i) {
+      assert(i < stamp_.size());
+      if (stamp_[i] != epoch_) { stamp_[i] = epoch_; elems_.push_back(i); }
+    }
+
+  public :
+
+    pruning_table_t() noexcept = default;
+    pruning_table_t(const size_t numvars, const size_t width) :
+      width_(width), stamp_(numvars * width) {}
+    // Sized for the variables of a space (all values must be >= 0):
+    explicit pruning_table_t(const GC::IntVarArray& V) :
+      pruning_table_t(V.size(), width(V)) {}
+    // Minimally sized (mostly for testing):
+    pruning_table_t(const std::initializer_list<lit_t> L) :
+      pruning_table_t(numvars(L), width(L)) {
+      for (const lit_t& x : L) insert(x);
+    }
+
+    static size_t width(const GC::IntVarArray& V) noexcept {
+      int max = -1;
+      for (int v = 0; v < V.size(); ++v) {
+        assert(V[v].min() >= 0);
+        max = std::max(max, V[v].max());
+      }
+      return max + 1;
+    }
+    static size_t numvars(const std::initializer_list<lit_t> L) noexcept {
+      int max = -1;
+      for (const lit_t& x : L) max = std::max(max, x.first);
+      return max + 1;
+    }
+    static size_t width(const std::initializer_list<lit_t> L) noexcept {
+      int max = -1;
+      for (const lit_t& x : L) max = std::max(max, x.second);
+      return max + 1;
+    }
+
+    size_t size() const noexcept { return elems_.size(); }
+    bool empty() const noexcept { return elems_.empty(); }
+    size_t capacity() const noexcept { return stamp_.size(); }
+
+    bool contains(const lit_t x) const noexcept {
+      const size_t i = index(x);
+      return i < stamp_.size() and stamp_[i] == epoch_;
+    }
+    void insert(const lit_t x) { insert_index(index(x)); }
+
+    void clear() noexcept {
+      elems_.clear();
+      if (++epoch_ == 0) {
+        std::ranges::fill(stamp_, epoch_t(0)); epoch_ = 1;
+      }
+    }
+    // Emptying the table, and sizing it for the variables of a space:
+    void reset(const GC::IntVarArray& V) {
+      const size_t w = width(V), n = V.size() * w;
+      if (w == width_ and n == stamp_.size()) { clear(); return; }
+      width_ = w; stamp_.assign(n, 0); epoch_ = 1; elems_.clear();
+    }
+    // Adding the elements of T (of the same dimensions):
+    void merge(const pruning_table_t& T) {
+      assert(T.width_ == width_ and T.stamp_.size() == stamp_.size());
+      for (const size_t i : T.elems_) insert_index(i);
+    }
+    void swap(pruning_table_t& T) noexcept {
+      std::swap(width_, T.width_); stamp_.swap(T.stamp_);
+      std::swap(epoch_, T.epoch_); elems_.swap(T.elems_);
+    }
+
+    // The elements, sorted:
+    assignment_t lits() const {
+      assignment_t res; res.reserve(elems_.size());
+      for (const size_t i : elems_)
+        res.emplace_back(i / width_, i % width_);
+      std::ranges::sort(res);
+      return res;
+    }
+    // Equality as sets (independent of the dimensions):
+    friend bool operator ==(const pruning_table_t& lhs,
+                            const pruning_table_t& rhs) {
+      return lhs.lits() == rhs.lits();
+    }
+  };
+
+
   /* Statistics */
 
 
@@ -112,6 +240,11 @@ namespace LookaheadReduction {
     size_t autarks_ = 0; // number of la-variables which yielded autarkies
     size_t finalmu0_ = 0, finalnumvars_ = 0, finalnumvals_ = 0;
 
+    size_t parpasses_ = 0; // number of parallel probing-passes
+    size_t parprobes_ = 0; // number of probes performed in these passes
+    /* parprobes_ - probes_ is the number of speculative probes which
+       have been discarded (for threads >= 2). */
+
     size_t solc_ = 0; // number of solutions found
     bool leaf_ = false;
 
@@ -137,6 +270,9 @@ namespace LookaheadReduction {
     void inc_probes() noexcept { ++probes_; }
     void inc_rounds() noexcept { ++rounds_; }
     void inc_elimfv() noexcept { ++elimfv_; }
+    void add_parpass(const size_t probes) noexcept {
+      ++parpasses_; parprobes_ += probes;
+    }
     void set_final(const GC::IntVarArray& V) noexcept {
       finalmu0_ = Measures::muap(V);
       finalnumvars_ = GV::numopenvars(V);
@@ -163,6 +299,8 @@ namespace LookaheadReduction {
     size_t rounds() const noexcept { return rounds_; }
     size_t elimfv() const noexcept { return elimfv_; }
     size_t autarks() const noexcept { return autarks_; }
+    size_t parpasses() const noexcept { return parpasses_; }
+    size_t parprobes() const noexcept { return parprobes_; }
     size_t finalmu0() const noexcept { return finalmu0_; }
     size_t finalnumvars() const noexcept { return finalnumvars_; }
     size_t finalnumvals() const noexcept { return finalnumvals_; }
@@ -247,9 +385,11 @@ namespace LookaheadReduction {
     }
 
     bool operator ==(const ReductionStatistics&) const noexcept = default;
-    // Equality without time:
+    // Equality without time and without the parallel-statistics:
     friend bool eqwt(ReductionStatistics lhs, ReductionStatistics rhs)
       noexcept {
+      lhs.parpasses_ = rhs.parpasses_ = 0;
+      lhs.parprobes_ = rhs.parprobes_ = 0;
       return lhs.time(0) == rhs.time(0);
     }
   };
@@ -265,7 +405,7 @@ namespace LookaheadReduction {
   // Make a copy of a given problem and assign var==val:
   template <class SPA>
   std::unique_ptr<SPA> child_node(SPA* const m,
-                                       const int v, const int val) noexcept {
+                                       const int v, const int val) {
     assert(v >= 0 and v < m->V.size());
     std::unique_ptr<SPA> c(static_cast<SPA*>(m->clone()));
     assert(c->V.size() == m->V.size());
@@ -274,13 +414,11 @@ namespace LookaheadReduction {
   }
 
 
-  typedef std::set<lit_t> pruning_table_t;
-
   template <class SPA>
   GC::SpaceStatus probe(SPA* const m,
                         const int v, const int val,
                         ReductionStatistics& stats,
-                        const bool with_sols) noexcept {
+                        const bool with_sols) {
     assert(m->V.size() > 0 and v < m->V.size());
     const auto chnode = child_node<SPA>(m, v, val);
     const auto status = chnode->status();
@@ -294,7 +432,7 @@ namespace LookaheadReduction {
                         const int v, const int val,
                         pruning_table_t& PV,
                         ReductionStatistics& stats,
-                        const bool with_sols) noexcept {
+                        const bool with_sols) {
     assert(v >= 0 and v < m->V.size());
     const auto V0 = m->V;
     const auto chnode = child_node<SPA>(m, v, val);
@@ -312,6 +450,246 @@ namespace LookaheadReduction {
   }
 
 
+  /* Parallel probing */
+
+  // The result of probing v=val, stored for later use:
+  struct ProbeResult {
+    GC::SpaceStatus status = GC::SS_BRANCH;
+    bool done = false; // whether the probe has been performed
+    GV::solutions_t sol; // if status is SS_SOLVED and with_sols
+    assignment_t fixed; // new assignments (only if status is SS_BRANCH
+                        // and with_fixed)
+  };
+
+  template <class SPA>
+  ProbeResult probe(SPA* const m,
+                    const int v, const int val,
+                    const bool with_fixed, const bool with_sols) {
+    assert(v >= 0 and v < m->V.size());
+    ProbeResult res;
+    const auto V0 = m->V;
+    const auto chnode = child_node<SPA>(m, v, val);
+    res.status = chnode->status(); res.done = true;
+    if (res.status == GC::SS_SOLVED and with_sols)
+      res.sol = GV::extract(chnode->V);
+    if (res.status != GC::SS_BRANCH or not with_fixed) return res;
+    const auto V1 = chnode->V;
+    assert(V0.size() == V1.size());
+    for (int w = 0; w < V1.size(); ++w)
+      if (V1[w].size() == 1 and V0[w].size() > 1)
+        for (GC::IntVarValues i(V1[w]); i(); ++i)
+          res.fixed.push_back({w, i.val()});
+    return res;
+  }
+
+  /* A pool of helper-threads, waiting on a condition-variable for the next
+     job: run(job, T) lets the helpers 1, ..., T-1 perform job(t), while
+     the calling thread performs job(0); it returns once all are finished,
+     re-throwing the exception of the caller or of some helper (if any).
+  */
+  class ProbePool {
+    typedef std::function<void(unsigned)> job_t;
+    std::mutex mtx;
+    std::condition_variable start_cv, done_cv;
+    const job_t* job = nullptr;
+    unsigned active = 0; // the helpers 1, ..., active take part
+    unsigned running = 0; // the helpers not finished with the job
+    size_t generation = 0; // the number of jobs so far
+    bool stop = false;
+    std::exception_ptr error;
+    std::vector<std::thread> helpers;
+
+    void loop(const unsigned t) {
+      size_t seen = 0;
+      std::unique_lock lock(mtx);
+      while (true) {
+        start_cv.wait(lock, [&]{return stop or generation != seen;});
+        if (stop) return;
+        seen = generation;
+        if (t > active) continue;
+        lock.unlock();
+        std::exception_ptr e;
+        try { (*job)(t); } catch (...) { e = std::current_exception(); }
+        lock.lock();
+        if (e and not error) error = e;
+        if (--running == 0) done_cv.notify_one();
+      }
+    }
+    void finish() noexcept {
+      {std::lock_guard lock(mtx); stop = true;}
+      start_cv.notify_all();
+      for (auto& h : helpers) h.join();
+    }
+
+  public :
+
+    explicit ProbePool(const unsigned num_helpers) {
+      try {
+        for (unsigned t = 1; t <= num_helpers; ++t)
+          helpers.emplace_back(&ProbePool::loop, this, t);
+      }
+      catch (...) { finish(); throw; }
+    }
+    ProbePool(const ProbePool&) = delete;
+    ~ProbePool() { finish(); }
+
+    unsigned size() const noexcept { return helpers.size(); }
+
+    void run(const job_t& f, const unsigned T) {
+      assert(T >= 1 and T <= size() + 1);
+      {std::lock_guard lock(mtx);
+       job = &f; active = T - 1; running = T - 1; error = nullptr;
+       ++generation;
+      }
+      if (T >= 2) start_cv.notify_all();
+      std::exception_ptr e;
+      try { f(0); } catch (...) { e = std::current_exception(); }
+      {std::unique_lock lock(mtx);
+       done_cv.wait(lock, [this]{return running == 0;});
+       if (not e) e = error;
+       job = nullptr;
+      }
+      if (e) std::rethrow_exception(e);
+    }
+  };
+
+  /* The probes of the remainder of a round, starting with variable v0,
+     are computed in one pass by the threads of a ProbePool (including the
+     calling thread), speculatively on the current node m; the results are
+     then used by lareduction in the sequential order.
+     The pass stops before the first formal variable (if these are set),
+     and at last_red, as the sequential loop does; values in the
+     pruning-table at the start of the pass, and values with a result
+     still available, are not probed. Once a thread finds a decision for
+     some variable, later variables are not probed anymore (m changes
+     there).
+     Cloning a Gecode-space is not possible concurrently (the original is
+     used for forwarding); so each helper clones m only once (per
+     lareduction), and then replays the changes of m (eliminations, and
+     settings of formal variables), before its next probes.
+     A change of m (reported by assigned resp. eliminated) keeps the results
+     of the failed probes (failing also for the smaller node, by the
+     monotonicity of the propagators), and discards the other results.
+  */
+  template <class SPA>
+  class ParallelProbes {
+    ProbePool& pool;
+    std::vector<std::vector<ProbeResult>> R; // R[v][val]
+
+    // The changes of m, each followed by propagation:
+    struct change_t { bool set; int v; GV::values_t vals; };
+    std::vector<change_t> changes;
+    std::vector<std::unique_ptr<SPA>> clones; // clones[t-1] for helper t
+    std::vector<size_t> applied; // the number of changes in clones[t-1]
+
+    struct task_t { int v; int val; };
+
+    void discard() noexcept {
+      for (auto& Rv : R)
+        for (ProbeResult& r : Rv)
+          if (r.done and r.status != GC::SS_FAILED) r = ProbeResult{};
+    }
+    // Bringing clones[i] up to date with m:
+    SPA* sync(const size_t i) {
+      SPA* const c = clones[i].get();
+      for (; applied[i] < changes.size(); ++applied[i]) {
+        const change_t& ch = changes[applied[i]];
+        for (const int val : ch.vals)
+          if (ch.set) GV::set_var(*c, c->V[ch.v], val);
+          else GV::unset_var(*c, c->V[ch.v], val);
+        [[maybe_unused]] const auto status = c->status();
+        assert(status == GC::SS_BRANCH);
+      }
+      return c;
+    }
+
+  public :
+
+    ParallelProbes(ProbePool& pool, const GC::IntVarArray& V) :
+      pool(pool),
+      R(V.size(), std::vector<ProbeResult>(pruning_table_t::width(V))) {
+      assert(pool.size() >= 1);
+    }
+
+    bool contains(const int v, const int val) const noexcept {
+      return R[v][val].done;
+    }
+
+    // m has been changed by v=val resp. by v!=val for val in vals:
+    void assigned(const int v, const int val) {
+      changes.push_back({true, v, {val}}); discard();
+    }
+    void eliminated(const int v, const GV::values_t& vals) {
+      changes.push_back({false, v, vals}); discard();
+    }
+
+    void compute(SPA* const m, const int v0, const int last_red,
+                 const pruning_table_t& PT,
+                 const OP::RDL rdl, const OP::LAR lar, const bool with_sols,
+                 ReductionStatistics& stats) {
+      const GC::IntVarArray V = m->V;
+      std::vector<task_t> tasks;
+      for (int v = v0; v < V.size(); ++v) {
+        if (v == last_red) {
+          if (eager(lar)) continue; else break;
+        }
+        if (V[v].size() == 1) continue;
+        if (V[v].degree() == 0 and efv(rdl)) break;
+        bool decided = false;
+        for (const int val : GV::values(V, v)) {
+          const ProbeResult& r = R[v][val];
+          if (r.done) decided = decided or r.status != GC::SS_BRANCH;
+          else if (not pruning(lar) or not PT.contains({v,val}))
+            tasks.push_back({v, val});
+        }
+        if (decided) break;
+      }
+      assert(not tasks.empty());
+
+      const unsigned T = std::min(size_t(pool.size()) + 1, tasks.size());
+      while (clones.size() + 1 < T) {
+        clones.emplace_back(static_cast<SPA*>(m->clone()));
+        applied.push_back(changes.size());
+      }
+      std::atomic<size_t> next = 0, done = 0;
+      std::atomic<int> first_dec = std::numeric_limits<int>::max();
+      pool.run([&](const unsigned t) {
+        SPA* const c = t == 0 ? m : sync(t - 1);
+        for (size_t j; (j = next.fetch_add(1, std::memory_order_relaxed)) <
+               tasks.size();) {
+          const task_t& task = tasks[j];
+          if (task.v > first_dec.load(std::memory_order_relaxed)) continue;
+          ProbeResult r = probe(c, task.v, task.val, pruning(lar), with_sols);
+          if (r.status != GC::SS_BRANCH) {
+            int old = first_dec.load(std::memory_order_relaxed);
+            while (task.v < old and not first_dec.compare_exchange_weak(old,
+                     task.v, std::memory_order_relaxed));
+          }
+          R[task.v][task.val] = std::move(r);
+          done.fetch_add(1, std::memory_order_relaxed);
+        }
+      }, T);
+      stats.add_parpass(done);
+    }
+
+    // Using the result for v=val (as probe above):
+    GC::SpaceStatus use(const int v, const int val,
+                        pruning_table_t& PV,
+                        ReductionStatistics& stats,
+                        const bool with_sols) {
+      assert(contains(v, val));
+      ProbeResult& r = R[v][val];
+      if (r.status == GC::SS_SOLVED) {
+        stats.inc_solc(); if (with_sols) stats.sollist(std::move(r.sol));
+      }
+      for (const lit_t& x : r.fixed) PV.insert(x);
+      const auto status = r.status;
+      r = ProbeResult{};
+      return status;
+    }
+  };
+
+
   /* The reduction */
 
 
@@ -323,16 +701,27 @@ namespace LookaheadReduction {
      a satisfying assignment is treated as a failure, after storing
      the solution in the return-object:
       - if rdl=laefv,  then for v having degree 0, v=eps1.
+     For threads >= 2 the probes are computed by ParallelProbes.
   */
   template <class SPA>
   ReductionStatistics lareduction(SPA* const m,
                         const OP::RT rt,
-                        const OP::RDL rdl, const OP::LAR lar) noexcept {
+                        const OP::RDL rdl, const OP::LAR lar,
+                        const unsigned threads = 1) {
     const GC::IntVarArray V = m->V;
     ReductionStatistics stats(V, m->nodedata().depth);
     Timing::UserTime timing;
     const Timing::Time_point t0 = timing();
-    pruning_table_t PT;
+    // Per thread (of the search, or of the caller), reused over the calls:
+    thread_local pruning_table_t PT, PV;
+    if (pruning(lar)) { PT.reset(V); PV.reset(V); }
+    else { PT.clear(); PV.clear(); }
+    // The helper-threads are kept over the calls (for the same threads):
+    thread_local std::unique_ptr<ProbePool> pool;
+    if (threads >= 2 and (not pool or pool->size() != threads - 1))
+      pool.reset(new ProbePool(threads - 1));
+    std::unique_ptr<ParallelProbes<SPA>> PP(threads >= 2 ?
+      new ParallelProbes<SPA>(*pool, V) : nullptr);
 
     {int last_red = -1;
     do {
@@ -351,6 +740,7 @@ namespace LookaheadReduction {
           if (efv(rdl)) {
             const int val = GV::first_value(V,v);
             GV::set_var(*m, V[v], val);
+            if (PP) PP->assigned(v, val);
             const auto status = m->status();
             assert(status != GC::SS_FAILED);
             if (status == GC::SS_SOLVED) {
@@ -367,12 +757,18 @@ namespace LookaheadReduction {
         const GV::values_t values = GV::values(V, v);
         GV::values_t elimvals;
 
-        pruning_table_t PV;
-        for (const int val : values) {
+        PV.clear();
+        for (size_t i = 0; i < values.size(); ++i) {
+          const int val = values[i];
           if (pruning(lar) and PT.contains({v,val})) {
             stats.inc_prunes(); continue;
           }
-          const auto status = pruning(lar) ?
+          if (PP and not PP->contains(v, val))
+            PP->compute(m, v, last_red, PT, rdl, lar, with_solutions(rt),
+                        stats);
+          const auto status = PP ?
+            PP->use(v, val, PV, stats, with_solutions(rt)) :
+            pruning(lar) ?
             probe(m, v, val, PV, stats, with_solutions(rt)) :
             probe(m, v, val,     stats, with_solutions(rt));
           stats.inc_probes();
@@ -387,6 +783,7 @@ namespace LookaheadReduction {
           [[maybe_unused]] const auto esize = elimvals.size();
           assert(esize <= vsize);
           last_red = v;
+          if (PP) PP->eliminated(v, elimvals);
           for (const int val : elimvals) {
             GV::unset_var(*m, V[v], val);
             stats.elim({v,val});
@@ -400,7 +797,7 @@ namespace LookaheadReduction {
             stats.set_leaf();
             goto END;
           }
-          stats.maxprune(PT.size()); PT = std::move(PV);
+          stats.maxprune(PT.size()); PT.swap(PV);
           if (eager(lar)) break;
         }
       }
@@ -51,6 +51,7 @@ License, or any later version. */
 
    - main function rlasolver, returns rlaSR
    - rlaSR is derived from GBasicSR, adding stats-data-member "S"
+     (and the parallel-probing counters parpasses, parprobes)
    - helper function solver_rla
 
 
@@ -75,6 +76,7 @@ TODOS:
 #include <ostream>
 #include <exception>
 #include <utility>
+#include <tuple>
 
 #include <cassert>
 
@@ -173,6 +175,7 @@ namespace Solvers {
     using GBasicSR::ut;
     typedef LB::rlaStats::stats_t stats_t;
     stats_t S;
+    size_t parpasses = 0, parprobes = 0; // parallel probing (lathreads >= 2)
 
     void outS(std::ostream& out, const bool with_header) const {
       const auto header = with_header ?
@@ -507,15 +510,18 @@ namespace Solvers {
                   const double threads,
                   LB::ListStoppingData st,
                   std::ostream* const log,
-                  std::ostream* const tree_logging) {
+                  std::ostream* const tree_logging,
+                  const unsigned lathreads = 1) {
     assert(valid(rt));
     assert(not with_log(rt) or log);
+    assert(lathreads >= 1);
 
     Timing::UserTime timing;
     const Timing::Time_point t0 = timing();
     CT::GenericMols1* const m = new CT::GenericMols1(enc);
     const LB::rlaParams P{
-      rt, rdl, lar, bv, bt, bo, threads != 1, tree_logging != nullptr};
+      rt, rdl, lar, bv, bt, bo, threads != 1, tree_logging != nullptr,
+      lathreads};
     if (with_stop(rt)) st += {OP::LRST::satc, with_stop(rt) - 1};
     std::unique_ptr<LB::rlaStats> stats(
       new LB::rlaStats(log, tree_logging,
@@ -552,13 +558,15 @@ namespace Solvers {
     res.update(s);
     res.b.sol_found = stats->sol_count();
     res.S = stats->stats();
+    std::tie(res.parpasses, res.parprobes) = stats->parstats();
     if (with_file_output(rt)) {
-      if (res.b.sol_found != stats->sols().size())
+      const auto sols = stats->sols();
+      if (res.b.sol_found != sols.size())
         std::cerr << "\nERROR[Solvers::rlasolver]: stated solution-count "
                   << res.b.sol_found << " != real solution-count "
-                  << stats->sols().size() << "\n";
+                  << sols.size() << "\n";
       for (size_t i = 0; i < res.b.sol_found; ++i) {
-        auto dsol = enc.decode(stats->sols()[i]);
+        auto dsol = enc.decode(sols[i]);
         if (not VR::correct(enc.ac, dsol))
           std::cerr << "\nERROR[Solvers::rlasolver]: "
             "correctness-checking failed for solution " << i
@@ -589,15 +597,17 @@ namespace Solvers {
                 RandGen::RandGen_t* const randgen,
                 LB::ListStoppingData st,
                 std::ostream* const log,
-                std::ostream* const tree_logging) {
+                std::ostream* const tree_logging,
+                const unsigned lathreads = 1) {
     assert(valid(rt));
     assert(not with_log(rt) or log);
     assert(weights);
+    assert(lathreads >= 1);
 
     Timing::UserTime timing;
     const Timing::Time_point t0 = timing();
     CT::GenericMols2* const m = new CT::GenericMols2(enc);
-    const LB::laParams P{rt, bt, dis, bo, rdl, lar, threads != 1};
+    const LB::laParams P{rt, bt, dis, bo, rdl, lar, threads != 1, lathreads};
     if (with_stop(rt)) st += {OP::LRST::satc, with_stop(rt) - 1};
     std::unique_ptr<LB::laStats> stats(
       new LB::laStats(log, tree_logging,
@@ -635,15 +645,17 @@ namespace Solvers {
     res.update(s);
     res.b.sol_found = stats->rla().sol_count();
     res.S = stats->rla().stats();
+    std::tie(res.parpasses, res.parprobes) = stats->rla().parstats();
     res.bS = stats->bstats();
     res.mS = stats->mstats();
     if (with_file_output(rt)) {
-      if (res.b.sol_found != stats->rla().sols().size())
+      const auto sols = stats->rla().sols();
+      if (res.b.sol_found != sols.size())
         std::cerr << "\nERROR[Solvers::lasolver]: stated solution-count "
                   << res.b.sol_found << " != real solution-count "
-                  << stats->rla().sols().size() << "\n";
+                  << sols.size() << "\n";
       for (size_t i = 0; i < res.b.sol_found; ++i) {
-        auto dsol = enc.decode(stats->rla().sols()[i]);
+        auto dsol = enc.decode(sols[i]);
         if (not VR::correct(enc.ac, dsol))
           std::cerr << "\nERROR[Solvers::lasolver]: "
             "correctness-checking failed for solution " << i
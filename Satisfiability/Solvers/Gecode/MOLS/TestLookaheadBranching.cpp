@@ -21,6 +21,7 @@ TODOS:
    - create_la() function
    - DONE LRStoppingData struct
    - ListStoppingDate struct
+   - DONE ThreadShards class
    - rlaStats struct
    - RlaBranching struct
    - BranchingStatistics class
@@ -31,6 +32,8 @@ TODOS:
 */
 
 #include <iostream>
+#include <thread>
+#include <vector>
 
 #include <cassert>
 
@@ -49,8 +52,8 @@ TODOS:
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.1.15",
-        "21.6.2022",
+        "0.1.16",
+        "16.10.2026",
         __FILE__,
         "Oleg Zaikin and Oliver Kullmann",
         "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Solvers/Gecode/MOLS/TestLookaheadBranching.cpp",
@@ -163,4 +166,26 @@ int main(const int argc, const char* const argv[]) {
      }
   }
 
+  {ThreadShards<size_t> T;
+   assert(T.size() == 0);
+   size_t& x = T.local();
+   assert(T.size() == 1);
+   assert(&T.local() == &x);
+   x = 1;
+   {ThreadShards<size_t> T2;
+    T2.local() = 7;
+    assert(&T.local() == &x);
+    assert(T2.size() == 1);
+   }
+   {std::vector<std::thread> W;
+    for (size_t i = 0; i < 4; ++i)
+      W.emplace_back([&T]{for (size_t j = 0; j < 1000; ++j) ++T.local();});
+    for (auto& w : W) w.join();
+   }
+   assert(T.size() == 5);
+   size_t sum = 0, count = 0;
+   T.for_each([&sum, &count](const size_t y){sum += y; ++count;});
+   assert(sum == 4001); assert(count == 5);
+  }
+
 }
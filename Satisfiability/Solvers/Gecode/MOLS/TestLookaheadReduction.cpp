@@ -11,6 +11,15 @@ Testing of look-ahead reduction for the Gecode library.
 
 BUG:
 
+Micro-benchmark:
+
+> ./TestLookaheadReduction_debug bench
+
+outputs (besides running the tests) the time per simulated reduction-round
+for the operations on pruning-tables (compared with std::set), and the time
+per round of lareduction for some Latin squares; better use an optimised
+build ("make TestLookaheadReduction_debug Optimisation_options=-O3").
+
 TODOS:
 
 1. DONE (A partially filled Latin square of order 4 fits this condition)
@@ -22,13 +31,16 @@ TODOS:
 #include <sstream>
 #include <string>
 #include <memory>
+#include <set>
 
 #include <cassert>
+#include <cstdint>
 
 #include <gecode/int.hh>
 #include <gecode/search.hh>
 
 #include <ProgramOptions/Environment.hpp>
+#include <SystemSpecifics/Timing.hpp>
 
 #include "LookaheadReduction.hpp"
 #include "Options.hpp"
@@ -41,8 +53,8 @@ TODOS:
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.8.3",
-        "7.2.2024",
+        "0.9.1",
+        "16.10.2026",
         __FILE__,
         "Oleg Zaikin and Oliver Kullmann",
         "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Solvers/Gecode/MOLS/TestLookaheadReduction.cpp",
@@ -69,6 +81,70 @@ namespace {
     return lhs == rhs;
   }
 
+
+  /* Simulating the pruning-table operations of one round of lareduction
+     (as for three MOLS of order N with pruning): for each variable, N
+     lookups in PT, and fixed new literals inserted into PV, which is
+     then merged into PT:
+  */
+  template <class TABLE>
+  TABLE sim_rounds(TABLE PT, TABLE PV, const int numvars, const int N,
+                   const int fixed, const int rounds) {
+    std::uint64_t x = 1;
+    const auto next = [&x]{x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+                           return x;};
+    size_t found = 0;
+    for (int r = 0; r < rounds; ++r) {
+      PT.clear();
+      for (int v = 0; v < numvars; ++v) {
+        PV.clear();
+        for (int val = 0; val < N; ++val) found += PT.contains({v,val});
+        for (int i = 0; i < fixed; ++i)
+          PV.insert({int(next() % numvars), int(next() % N)});
+        PT.merge(PV);
+      }
+    }
+    assert(found < size_t(numvars) * N * rounds);
+    return PT;
+  }
+  struct set_table : std::set<lit_t> {
+    using std::set<lit_t>::set;
+    void merge(set_table& PV) { std::set<lit_t>::merge(PV); }
+  };
+
+  void bench(std::ostream& out) {
+    Timing::UserTime timing;
+    const int N = 10, numvars = 6*N*N, fixed = 20, rounds = 100;
+    out << "Pruning-table, N=" << N << ", numvars=" << numvars
+        << ", fixed=" << fixed << ", rounds=" << rounds << ":\n";
+    {const auto t0 = timing();
+     const auto T = sim_rounds(pruning_table_t(numvars, N),
+                               pruning_table_t(numvars, N),
+                               numvars, N, fixed, rounds);
+     const auto t = timing() - t0;
+     out << "  pruning_table_t: " << 1e6 * t / rounds << " us/round, "
+         << "size=" << T.size() << "\n";
+    }
+    {const auto t0 = timing();
+     const auto T = sim_rounds(set_table{}, set_table{},
+                               numvars, N, fixed, rounds);
+     const auto t = timing() - t0;
+     out << "  std::set       : " << 1e6 * t / rounds << " us/round, "
+         << "size=" << T.size() << "\n";
+    }
+    out << "lareduction (rel_pr) on the Latin square of order N:\n";
+    for (size_t N = 6; N <= 9; ++N) {
+      const CS::Square A(N);
+      const std::unique_ptr<CS::GenericMolsNB> m = A.space();
+      const ReductionStatistics s = lareduction<CS::GenericMolsNB>(
+        m.get(), RT::count_solutions, RDL::basic, LAR::rel_pr);
+      out << "  N=" << N << ": rounds=" << s.rounds() << ", probes="
+          << s.probes() << ", " << 1e6 * s.time() / s.rounds()
+          << " us/round\n";
+    }
+    out.flush();
+  }
+
 }
 
 int main(const int argc, const char* const argv[]) {
@@ -129,7 +205,7 @@ int main(const int argc, const char* const argv[]) {
   {const CS::Square A(2);
    const std::unique_ptr<CS::GenericMolsNB> m = A.space();
    ReductionStatistics stats0(m->V, 0);
-   pruning_table_t PT;
+   pruning_table_t PT(m->V);
    assert(probe(m.get(), 0, 0, PT, stats0, false) == GC::SS_BRANCH);
    assert(eqp(PT, {{0,0}}));
    assert(probe(m.get(), 0, 1, PT, stats0, false) == GC::SS_BRANCH);
@@ -139,6 +215,20 @@ int main(const int argc, const char* const argv[]) {
    assert(probe(m.get(), 1, 1, PT, stats0, false) == GC::SS_BRANCH);
    assert(eqp(PT, {{0,0}, {0,1}, {1,0}, {1,1}}));
   }
+  {const CS::Square A(2), B(3);
+   const std::unique_ptr<CS::GenericMolsNB> m = A.space(), m2 = B.space();
+   pruning_table_t PT;
+   PT.reset(m->V);
+   assert(PT.empty() and PT.capacity() == 4*2);
+   PT.insert({3,1});
+   PT.reset(m->V);
+   assert(PT.empty() and PT.capacity() == 4*2);
+   assert(not PT.contains({3,1}));
+   PT.reset(m2->V);
+   assert(PT.empty() and PT.capacity() == 9*3);
+   PT.insert({8,2});
+   assert(eqp(PT, {{8,2}}));
+  }
 
   {const CS::LaSq A(2);
    const std::unique_ptr<CS::GenericMolsNB> m = A.space();
@@ -151,7 +241,7 @@ int main(const int argc, const char* const argv[]) {
   {const CS::LaSq A(2);
    const std::unique_ptr<CS::GenericMolsNB> m = A.space();
    ReductionStatistics stats0(m->V, 0);
-   pruning_table_t PT;
+   pruning_table_t PT(m->V);
    assert(probe(m.get(), 0, 0, PT, stats0, false) == GC::SS_SOLVED);
    assert(PT.empty());
    assert(probe(m.get(), 0, 1, PT, stats0, false) == GC::SS_SOLVED);
@@ -178,7 +268,7 @@ int main(const int argc, const char* const argv[]) {
   {const CS::Square A(3);
    const std::unique_ptr<CS::GenericMolsNB> m = A.space();
    ReductionStatistics stats0(m->V, 0);
-   pruning_table_t PT;
+   pruning_table_t PT(m->V);
    assert(probe(m.get(), 0, 0, PT, stats0, false) == GC::SS_BRANCH);
    assert(eqp(PT, {{0,0}}));
    assert(probe(m.get(), 0, 1, PT, stats0, false) == GC::SS_BRANCH);
@@ -216,7 +306,7 @@ int main(const int argc, const char* const argv[]) {
   {const CS::LaSq A(3, "A\n0 * *\n* * *\n* * *\n");
    const std::unique_ptr<CS::GenericMolsNB> m = A.space();
    ReductionStatistics stats0(m->V, 0);
-   pruning_table_t PT;
+   pruning_table_t PT(m->V);
    assert(probe(m.get(), 0, 0, PT, stats0, false) == GC::SS_BRANCH);
    assert(PT.empty());
    assert(probe(m.get(), 0, 1, PT, stats0, false) == GC::SS_FAILED);
@@ -253,7 +343,7 @@ int main(const int argc, const char* const argv[]) {
   {const CS::LaSq A(3, "A\n* * *\n* 1 *\n* * *\n");
    const std::unique_ptr<CS::GenericMolsNB> m = A.space();
    ReductionStatistics stats0(m->V, 0);
-   pruning_table_t PT;
+   pruning_table_t PT(m->V);
    assert(probe(m.get(), 0, 0, PT, stats0, false) == GC::SS_SOLVED);
    assert(PT.empty());
    assert(probe(m.get(), 0, 1, PT, stats0, false) == GC::SS_BRANCH);
@@ -285,6 +375,20 @@ int main(const int argc, const char* const argv[]) {
          assert(eqwt(stats, A.laredstats(rdl,lar,rt)));
        }
   }
+  {for (size_t N = 2; N <= 5; ++N)
+     for (const RDL rdl : ET::allvals<RDL>())
+     for (const LAR lar : ET::allvals<LAR>())
+       for (const RT rt : ET::allvals<RT>())
+         for (const unsigned threads : {2u, 3u, 7u}) {
+           const CS::Square A(N);
+           const std::unique_ptr<CS::GenericMolsNB> m = A.space();
+           const ReductionStatistics stats =
+             lareduction<CS::GenericMolsNB>(m.get(), rt, rdl, lar, threads);
+           assert(eqwt(stats, A.laredstats(rdl,lar,rt)));
+           assert(stats.parprobes() >= stats.probes());
+           assert((stats.parpasses() == 0) == (stats.probes() == 0));
+         }
+  }
 
   {const CS::Square A(3, "A\n0 * *\n* * *\n* * *\n");
    for (const RDL rdl : ET::allvals<RDL>())
@@ -429,6 +533,23 @@ int main(const int argc, const char* const argv[]) {
               {{{0,1,2},{2,0,1},{1,2,0}}}, {{{0,2,1},{1,0,2},{2,1,0}}}
             }));
   }
+  {for (const LAR lar : ET::allvals<LAR>())
+     for (const unsigned threads : {2u, 4u}) {
+       const CS::LaSq A(3, "A\n0 * *\n* * *\n* * *\n");
+       const std::unique_ptr<CS::GenericMolsNB> m0 = A.space(), m = A.space();
+       const ReductionStatistics s0 =
+         lareduction<CS::GenericMolsNB>(m0.get(), RT::enumerate_solutions,
+           RDL::basic, lar);
+       const ReductionStatistics s =
+         lareduction<CS::GenericMolsNB>(m.get(), RT::enumerate_solutions,
+           RDL::basic, lar, threads);
+       assert(eqwt(s, s0));
+       assert(eqp(s.sollist(), s0.sollist()));
+       assert(s0.parpasses() == 0 and s0.parprobes() == 0);
+       assert(s.parpasses() >= 1);
+       assert(s.parprobes() >= s.probes());
+     }
+  }
 
   {const CS::LaSq A(3, "A\n* * *\n* 1 *\n* * *\n");
    for (const RT rt : ET::allvals<RT>()) {
@@ -591,4 +712,6 @@ pelvals = 100 * 6 / 22 = 100 * 3 / 11 ~ 27.27273
    assert(s.sollist().empty());
   }
 
+  if (argc == 2 and std::string(argv[1]) == "bench") bench(std::cout);
+
 }
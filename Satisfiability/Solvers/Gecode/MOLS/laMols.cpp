@@ -780,7 +780,8 @@ namespace {
       " - la-reduction : " << Environment::WRPO<RDL>{} << "\n" <<
       " - la-algorithm : " << Environment::WRPO<LAR>{} << "\n" <<
       " - gcd          : Gecode commit-distance; list as for N\n"
-      " - threads      : floating-point for number of threads\n"
+      " - threads      : floating-point for number of threads, optionally\n"
+      "                  followed by \",L\" for L threads in la-reduction\n"
       " - weights      : either comma-separated list of weights for distance,"
       " possibly using\n"
       "   - variables  : " << Environment::WRPO<EXW>{} << "; or one of\n" <<
@@ -1029,7 +1030,7 @@ int main(const int argc, const char* const argv[]) {
     return res;}();
   const auto [brov, randgen, seeds] = read_lbro(argc, argv, 8, hash_seeds);
 
-  const double threads = read_threads(argc, argv, 12);
+  const auto [threads, lathreads] = read_lathreads(argc, argv, 12);
   if (threads != 1 and randgen) {
     std::cerr << error << "In the presence of branching-order rand the"
       " number of threads must be 1, but is " << threads << ".\n";
@@ -1087,6 +1088,7 @@ int main(const int argc, const char* const argv[]) {
                 list_N, ac, name_ac, ps0, name_ps, rt,
                 num_runs, threads, outfile, with_file_output,
                 hash_seeds);
+    lathreads_output(std::cout, lathreads);
     st_output(std::cout, stod);
     output_options(std::cout, outopt);
     algo_output(std::cout, std::make_tuple(pov, brtv, disv, brov, rdlv, larv));
@@ -1096,6 +1098,7 @@ int main(const int argc, const char* const argv[]) {
     std::cout.flush();
   }
 
+  size_t parpasses = 0, parprobes = 0; // sums over all runs
   for (const size_t N : list_N)
     for (const PropO po : pov) {
       const EncCond enc(ac, ps0 ? ps0.value() : PSquares(N,psquares_t{}),
@@ -1114,8 +1117,9 @@ int main(const int argc, const char* const argv[]) {
                     lasolver(enc, rt, brt, dis, bro, rdl, lar,
                              gcd, threads, weights,
                              needs_randgen(bro) ? randgen.get() : nullptr,
-                             stod, log, nullptr) :
+                             stod, log, nullptr, lathreads) :
                     laSR{};
+                  parpasses += res.parpasses; parprobes += res.parprobes;
                   if (with_log and
                       rt != RT::enumerate_with_log and
                       rt != RT::unique_s_with_log)
@@ -1196,5 +1200,7 @@ int main(const int argc, const char* const argv[]) {
           }
         }
     }
+  if (lathreads >= 2 and outopt.with_info())
+    parprobes_output(std::cout, parpasses, parprobes);
   delete out;
 }
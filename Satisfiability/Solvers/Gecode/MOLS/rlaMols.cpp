@@ -114,8 +114,8 @@ BUGS:
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "1.0.8",
-        "17.2.2024",
+        "1.1.0",
+        "16.10.2026",
         __FILE__,
         "Oliver Kullmann and Oleg Zaikin",
         "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Solvers/Gecode/MOLS/rlaMols.cpp",
@@ -155,7 +155,9 @@ namespace {
       " 11. gcd          : Gecode commit-distance; list as for N;"
       " default=" << default_comdist << "\n"
       " 12. threads      : floating-point for number of threads;"
-      " default=" << default_threads << "\n"
+      " default=" << default_threads << ",\n"
+      "                    optionally followed by \",L\" for L threads in"
+      " la-reduction\n"
       " 13. stop-type    : " << Environment::WRPO<LRST>{} << "\n" <<
       " 14. tree-logging : " << Environment::WRPO<TREE>{} << "\n\n" <<
       "Here\n"
@@ -237,7 +239,7 @@ int main(const int argc, const char* const argv[]) {
     list_N.size()*pov.size()*brtv.size()*bvarv.size()*gbov.size()
     *rdlv.size()*larv.size()*gcdv.size();
 
-  const double threads = read_threads(argc, argv, 12);
+  const auto [threads, lathreads] = read_lathreads(argc, argv, 12);
 
   const auto stod = read_rlast(argc, argv, 13);
 
@@ -286,6 +288,7 @@ int main(const int argc, const char* const argv[]) {
                 num_runs, threads, outfile,
                 withfiles ? with_file_output : false,
                 hash_seeds);
+    lathreads_output(out, lathreads);
     st_output(out, stod);
     if (withfiles)
       treelogging_output(out, to.value(), treeloggingfile);
@@ -309,6 +312,7 @@ int main(const int argc, const char* const argv[]) {
   }
 
 
+  size_t parpasses = 0, parprobes = 0; // sums over all runs
   for (const size_t N : list_N)
     for (const PropO po : pov) {
       const EncCond enc(ac, ps0 ? ps0.value() : PSquares(N,psquares_t{}),
@@ -321,7 +325,9 @@ int main(const int argc, const char* const argv[]) {
               for (unsigned gcd : gcdv) {
                 const rlaSR res =
                   rlasolver(enc, rt, brt, bvar, gbo, rdl, lar,
-                            gcd, threads, stod, log, tree_log);
+                            gcd, threads, stod, log, tree_log,
+                            lathreads);
+                parpasses += res.parpasses; parprobes += res.parprobes;
                 if (with_log and
                     rt != RT::enumerate_with_log and
                     rt != RT::unique_s_with_log)
@@ -336,4 +342,5 @@ int main(const int argc, const char* const argv[]) {
                   Environment::out_line(*out, res.b.list_sol, "\n");
               }
     }
+  if (lathreads >= 2) parprobes_output(std::cout, parpasses, parprobes);
 }
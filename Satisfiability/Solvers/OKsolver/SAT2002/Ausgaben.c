@@ -1,5 +1,5 @@
 // Oliver Kullmann, 19.1.2001 (Toronto)
-/* Copyright 2001 - 2007, 2008, 2009, 2011, 2015, 2019 Oliver Kullmann
+/* Copyright 2001 - 2007, 2008, 2009, 2011, 2015, 2019, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -29,7 +29,7 @@ License, or any later version. */
 
 
 
-const char* Meldungen[ANZSPRACHEN][63] =
+const char* Meldungen[ANZSPRACHEN][68] =
 {
   {"Fehler in der Definition der Konstanten! Abbruch.", /* 0 */
    "Kombination von BAUMRES mit LOKALLERNEN zur Zeit noch nicht moeglich.", /* 1 */
@@ -94,6 +94,11 @@ const char* Meldungen[ANZSPRACHEN][63] =
    "Die Datei fuer die Aufspaltungsinstanzen konnte nicht erzeugt werden:", /* 60 */
    "Vorzeitiger Abbruch des Aufspaltungsmodus.", /* 61 */
    "Die Datei fuer die Entscheidungen der Aufspaltungsinstanzen konnte nicht erzeugt werden:", /* 62 */
+   "Fuer die binaere Aufspaltungsdatei muessen die Variablennamen natuerliche Zahlen sein.", /* 63 */
+   "Fehler beim Schreiben der Aufspaltungsdatei:", /* 64 */
+   "Die Anzahl der Arbeitsprozesse (Option -W=) muss eine natuerliche Zahl sein.", /* 65 */
+   "Die Optionen -W und -S koennen nicht kombiniert werden.", /* 66 */
+   "Ein Arbeitsprozess konnte nicht erzeugt werden.", /* 67 */
   },
 
   {"Error in the definition of the constants! Abbort.", /* 0 */
@@ -159,13 +164,18 @@ const char* Meldungen[ANZSPRACHEN][63] =
    "Could not create the file for the splitting-instance:", /* 60 */
    "Abortion of splitting computation.", /* 61 */
    "Could not create the file for the decisions of the splitting-instance:", /* 62 */
+   "For the binary splitting-file the variable-names must be positive integers.", /* 63 */
+   "Error when writing the splitting-file:", /* 64 */
+   "The number of worker-processes (option -W=) must be a natural number.", /* 65 */
+   "The options -W and -S can not be combined.", /* 66 */
+   "Could not create a worker-process.", /* 67 */
   },
 };
 
 
 //! helper function for the messsage depending on the current language
 const char* Meldung(const unsigned int i) {
-  assert(i < 63);
+  assert(i < 68);
   return Meldungen[Sprache][i];
 }
 
@@ -1,5 +1,5 @@
 // Oliver Kullmann, 19.1.2001 (Toronto)
-/* Copyright 2001 - 2007, 2008, 2011, 2019, 2023 Oliver Kullmann
+/* Copyright 2001 - 2007, 2008, 2011, 2019, 2023, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -32,6 +32,7 @@ License, or any later version. */
 #include <limits.h>
 #include <string.h> /* fuer C++ (memset; 14.8.2001) */
 #include <assert.h>
+#include <stdint.h>
 
 
 #include "OK.h"
@@ -1467,3 +1468,41 @@ void AusgabeBelegung(FILE* const fp) {
     if (! Dateiausgabe) fprintf(fp, "</SAT-Solver.output>\n");
   }
 }
+
+
+unsigned int AnzahlBelegung(void) {
+  return ((EinerKlausel) ? InitEinerRed : 0) + (Tiefe - Pfad);
+}
+
+// Variablenname als DIMACS-Variable (0, falls keine solche):
+__inline__ static int32_t DimacsVar(const char* const name) {
+  char* end;
+  const long int v = strtol(name, &end, 10);
+  if (*end != '\0' || end == name || v <= 0 || v > INT32_MAX) return 0;
+  return (int32_t) v;
+}
+
+bool AusgabeBelegungBinaer(FILE* const fp) {
+  assert(fp);
+  if (EinerKlausel)
+    for (unsigned int i = 0; i < InitEinerRed; ++i) {
+      assert(Pfad0[i] > INT_MIN);
+      const unsigned int v = abs(Pfad0[i]);
+      const int32_t x = DimacsVar(Symbol1(v));
+      if (x == 0) return false;
+      const int32_t l = (Pfad0[i] > 0) ? -x : x;
+      if (fwrite(&l, sizeof l, 1, fp) != 1) return false;
+    }
+  {
+    const Pfadinfo* const Z = Tiefe;
+    bool ok = true;
+    for (Tiefe = Pfad; ok && Tiefe < Z; ++Tiefe) {
+      const LIT l = PfadLit(); const VAR v = Var(l);
+      const int32_t x = DimacsVar(Symbol(v));
+      const int32_t y = (l == Literal(v, Pos)) ? -x : x;
+      ok = x != 0 && fwrite(&y, sizeof y, 1, fp) == 1;
+    }
+    Tiefe = (Pfadinfo*) Z;
+    return ok;
+  }
+}
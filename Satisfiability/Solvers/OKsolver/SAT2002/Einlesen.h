@@ -1,5 +1,5 @@
 // Oliver Kullmann, 4.2.2001 (Toronto)
-/* Copyright 2001 - 2007, 2023 Oliver Kullmann
+/* Copyright 2001 - 2007, 2023, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -35,6 +35,19 @@ extern void AufraeumenEinlesen(void);
 */
 extern void AusgabeBelegung(FILE *fp);
 
+/*!
+  \brief The number of literals output by AusgabeBelegung
+*/
+extern unsigned int AnzahlBelegung(void);
+/*!
+  \brief Binary output of the assignment (for the splitting-file)
+
+  Writes the AnzahlBelegung() many literals as int32_t, in the order and
+  with the signs as AusgabeBelegung; returns false if a variable-name is
+  not a positive integer, or in case of a write-error.
+*/
+extern bool AusgabeBelegungBinaer(FILE *fp);
+
 extern void setzenStandard(void);
 
 #endif
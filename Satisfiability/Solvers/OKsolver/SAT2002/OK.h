@@ -1,5 +1,5 @@
 // Oliver Kullmann, 5.3.1998 (Frankfurt)
-/* Copyright 1998 - 2007, 2008, 2009, 2011, 2015, 2019, 2023 Oliver Kullmann
+/* Copyright 1998 - 2007, 2008, 2009, 2011, 2015, 2019, 2023, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -409,7 +409,8 @@ extern StatisticsCount
   FastAutarkien,
   InitEinerRed,
   neue2Klauseln,
-  maxneue2K;
+  maxneue2K,
+  Vorausbelegungen; /* Anzahl der Belegungen von Literalen in der Vorausschau von Reduktion1 */
 
 /*!
   \typedef StatisticsCount_short
@@ -1,5 +1,5 @@
 // Oliver Kullmann, 5.3.1998 (Frankfurt)
-/* Copyright 1998 - 2007, 2008, 2009, 2011, 2015, 2019, 2023 Oliver Kullmann
+/* Copyright 1998 - 2007, 2008, 2009, 2011, 2015, 2019, 2023, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -85,9 +85,14 @@ License, or any later version. */
 #include <setjmp.h>
 #include <assert.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include <sys/stat.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
 #include <unistd.h>
+#include <poll.h>
+#include <errno.h>
 
 #include "OK.h"
 #include "BaumRes.h"
@@ -137,6 +142,8 @@ bool splitting_only = false;
 bool splitting_n = true;
 //! whether the splittings are stored in a directory or a single file
 bool splitting_file = false;
+//! whether the splittings are stored in a single indexed binary file
+bool splitting_binary = false;
 //! true iff a splitting-only computation is aborted
 bool splitting_abortion = false;
 
@@ -198,7 +205,7 @@ unsigned int Runde;
 
 /* Statistik */
 
-StatisticsCount Knoten, SingleKnoten, VerSingleKnoten, QuasiSingleKnoten, PureL, Autarkien, V1KlRed, FastAutarkien, InitEinerRed, neue2Klauseln, maxneue2K;
+StatisticsCount Knoten, SingleKnoten, VerSingleKnoten, QuasiSingleKnoten, PureL, Autarkien, V1KlRed, FastAutarkien, InitEinerRed, neue2Klauseln, maxneue2K, Vorausbelegungen;
 
 StatisticsCount_short Suchbaumtiefe, Ueberschreitung2, init2Klauseln;
 
@@ -293,6 +300,29 @@ static char* splitting_decisions;
 //! the file for the splitting-decisions
 static FILE* fpsplitdec = NULL;
 
+/*!
+  \brief The binary cube-file (option -SB)
+
+  All numbers in the byte-order of the machine:
+  <ul>
+   <li> Header: magic "OKcubes1" (8 chars), then the number N of cubes and
+   the offset of the index (both uint64_t). </li>
+   <li> The records for the cubes 1, ..., N: the number d of decisions and
+   the number k of literals (both uint32_t), then the d 0-based positions of
+   the decisions in the literal-list (uint32_t; as in the decisions-file),
+   then the k literals of the partial assignment (int32_t, in DIMACS
+   convention; as for the text-output). </li>
+   <li> The index: N offsets (uint64_t) of the records. </li>
+  </ul>
+  Header and index are written by finish_cubes_binary(), the records are
+  streamed into the file as they are created.
+*/
+static const char cubes_magic[8] = {'O','K','c','u','b','e','s','1'};
+//! the offsets of the records
+static uint64_t* cube_offsets = NULL;
+//! the capacity of cube_offsets
+static unsigned int cube_offsets_size = 0;
+
 /*!
   \brief Helper array with Beobachtungsniveau many elements
 
@@ -425,6 +455,222 @@ __inline__ static void output_decision_levels(FILE* const fp) {
 }
 
 
+/*!
+  \brief Writing the record for the current splitting case into fpsplit
+*/
+static void output_cube_binary(void) {
+  assert(fpsplit); assert(splitting_cases >= 1);
+  if (splitting_cases > cube_offsets_size) {
+    cube_offsets_size = (cube_offsets_size == 0) ? 1024 : 2 * cube_offsets_size;
+    cube_offsets = (uint64_t*) xrealloc(cube_offsets, cube_offsets_size * sizeof(uint64_t));
+  }
+  cube_offsets[splitting_cases-1] = ftello(fpsplit);
+  const uint32_t h[2] = {Rekursionstiefe, AnzahlBelegung()};
+  bool ok = fwrite(h, sizeof(uint32_t), 2, fpsplit) == 2;
+  for (struct {const struct Sammlung* i; ptrdiff_t c;} l = {SatVar0, 0}; ok && l.c !=  (ptrdiff_t) Rekursionstiefe; l.i=l.i->danach, ++l.c) {
+    const uint32_t p = l.i->altTiefe - Pfad;
+    ok = fwrite(&p, sizeof p, 1, fpsplit) == 1;
+  }
+  if (ok && ! AusgabeBelegungBinaer(fpsplit)) {
+    if (! ferror(fpsplit)) { fprintf(stderr, "%s\n", Meldung(63)); exit(1); }
+    ok = false;
+  }
+  if (! ok) { fprintf(stderr, "%s %s\n", Meldung(64), splitting_store); exit(1); }
+}
+
+/*!
+  \brief Writing index and header of the binary cube-file, and closing it
+*/
+static void finish_cubes_binary(void) {
+  assert(fpsplit);
+  const uint64_t index = ftello(fpsplit);
+  const uint64_t N = splitting_cases;
+  bool ok = N == 0 || fwrite(cube_offsets, sizeof(uint64_t), N, fpsplit) == N;
+  ok = ok && fseeko(fpsplit, 0, SEEK_SET) == 0 &&
+    fwrite(cubes_magic, 1, 8, fpsplit) == 8 &&
+    fwrite(&N, sizeof N, 1, fpsplit) == 1 &&
+    fwrite(&index, sizeof index, 1, fpsplit) == 1;
+  ok = (fclose(fpsplit) == 0) && ok;
+  fpsplit = NULL;
+  free(cube_offsets); cube_offsets = NULL; cube_offsets_size = 0;
+  if (! ok) fprintf(stderr, "%s %s\n", Meldung(64), splitting_store);
+}
+
+/* ------------------------------------------------------------- */
+
+/*!
+  \brief Parallel processing of the monitoring nodes (option -W=T)
+
+  <ul>
+   <li> The search tree above the monitoring nodes (depth
+   Beobachtungsniveau) is processed by the main process (the "scheduler"),
+   while for each monitoring node reached a worker-process is created via
+   fork(), which inherits the reduced formula at this node, and which
+   makes this node the root of its search (so that it returns UNSAT when
+   the subtree is refuted). </li>
+   <li> The scheduler continues immediately with the next node (as in
+   splitting-mode), keeping at most T workers running; when all are busy,
+   it waits for one to finish, so that the remaining nodes are handed out
+   dynamically. </li>
+   <li> A worker reports through a pipe the result and its statistics (as a
+   struct worker_report), followed in the satisfiable case by the
+   satisfying assignment (in the output-format of AusgabeBelegung). </li>
+   <li> Once a satisfying assignment is found, all other workers are
+   killed. </li>
+   <li> A worker which does not deliver a complete report (e.g., due to
+   being killed) makes the result Unbestimmt (unless SAT is found). </li>
+  </ul>
+*/
+struct worker_report {
+  enum Ergebniswerte e;
+  StatisticsCount Knoten, SingleKnoten, VerSingleKnoten, QuasiSingleKnoten,
+    PureL, Autarkien, V1KlRed, FastAutarkien, neue2Klauseln, maxneue2K,
+    Vorausbelegungen;
+  StatisticsCount_short Suchbaumtiefe, Ueberschreitung2;
+  Probability proportion_searched, proportion_single;
+};
+
+struct worker {
+  pid_t pid;
+  int fd; // read-end of the pipe
+};
+//! the number of worker-processes (0 means sequential processing)
+static unsigned int parallel_workers = 0;
+//! the running workers (parallel_workers many places)
+static struct worker* workers = NULL;
+static struct pollfd* worker_fds = NULL;
+static unsigned int active_workers = 0;
+//! the number of workers created
+static unsigned int worker_cases;
+//! true iff the current process is a worker
+static bool is_worker = false;
+//! for a worker the write-end of its pipe
+static int report_fd;
+//! whether all finished workers refuted their subtree
+static bool workers_complete;
+//! the satisfying assignment (as text) found by a worker, or NULL
+static char* worker_assignment = NULL;
+//! the accumulated user-time of the finished workers (in seconds)
+static double worker_time;
+//! the maximal Suchbaumtiefe of the finished workers (the scheduler
+//! keeps its own value, since the workers inherit it)
+static StatisticsCount_short worker_depth;
+
+/*!
+  \brief Creating a worker for the current node; returns true in the worker
+*/
+static bool start_worker(void) {
+  assert(parallel_workers >= 1 && active_workers < parallel_workers);
+  int p[2];
+  fflush(NULL);
+  if (pipe(p) != 0) { fprintf(stderr, "%s\n", Meldung(67)); exit(1); }
+  const pid_t pid = fork();
+  if (pid < 0) { fprintf(stderr, "%s\n", Meldung(67)); exit(1); }
+  if (pid == 0) {
+    close(p[0]);
+    for (unsigned int i = 0; i < active_workers; ++i) close(workers[i].fd);
+    signal(SIGINT, SIG_DFL); signal(SIGALRM, SIG_DFL);
+    signal(SIGUSR1, SIG_IGN);
+    is_worker = true; report_fd = p[1];
+    Knoten = SingleKnoten = VerSingleKnoten = QuasiSingleKnoten = PureL = Autarkien = V1KlRed = FastAutarkien = neue2Klauseln = maxneue2K = Vorausbelegungen = Ueberschreitung2 = 0;
+    proportion_searched = proportion_single = 0;
+    SatVar -> davor = NULL; // the node becomes the root
+    return true;
+  }
+  close(p[1]);
+  workers[active_workers].pid = pid; workers[active_workers].fd = p[0];
+  ++active_workers; ++worker_cases;
+  return false;
+}
+
+/*!
+  \brief Called by the worker with its result (does not return)
+*/
+static void report_worker(const enum Ergebniswerte e) {
+  assert(is_worker);
+  FILE* const fp = fdopen(report_fd, "w");
+  if (fp == NULL) _exit(1);
+  const struct worker_report r = {e, Knoten, SingleKnoten, VerSingleKnoten,
+    QuasiSingleKnoten, PureL, Autarkien, V1KlRed, FastAutarkien,
+    neue2Klauseln, maxneue2K, Vorausbelegungen, Suchbaumtiefe, Ueberschreitung2,
+    proportion_searched, proportion_single};
+  fwrite(&r, sizeof r, 1, fp);
+  if (e == SAT && Belegung) AusgabeBelegung(fp);
+  _exit(fclose(fp) == 0 ? 0 : 1);
+}
+
+static void remove_worker(const unsigned int i) {
+  assert(i < active_workers);
+  close(workers[i].fd);
+  struct rusage ru;
+  if (wait4(workers[i].pid, NULL, 0, &ru) == workers[i].pid)
+    worker_time += ru.ru_utime.tv_sec + ru.ru_utime.tv_usec / 1e6;
+  workers[i] = workers[--active_workers];
+}
+
+/*!
+  \brief Waiting for some worker to finish, and adding its statistics;
+  returns true iff it found a satisfying assignment
+*/
+static bool collect_worker(void) {
+  assert(active_workers >= 1);
+  for (unsigned int i = 0; i < active_workers; ++i) {
+    worker_fds[i].fd = workers[i].fd; worker_fds[i].events = POLLIN;
+  }
+  while (poll(worker_fds, active_workers, -1) < 0)
+    if (errno != EINTR) { fprintf(stderr, "%s\n", Meldung(67)); exit(1); }
+  unsigned int i = 0;
+  while (worker_fds[i].revents == 0) ++i;
+  assert(i < active_workers);
+
+  FILE* const fp = fdopen(dup(workers[i].fd), "r");
+  struct worker_report r;
+  const bool complete = fp != NULL && fread(&r, sizeof r, 1, fp) == 1;
+  if (complete && r.e == SAT && Belegung) {
+    size_t size = 0, cap = 1024;
+    worker_assignment = (char*) xmalloc(cap);
+    for (size_t n; (n = fread(worker_assignment + size, 1, cap - size - 1, fp)) != 0;)
+      if ((size += n) == cap - 1)
+        worker_assignment = (char*) xrealloc(worker_assignment, cap *= 2);
+    worker_assignment[size] = '\0';
+  }
+  if (fp != NULL) fclose(fp);
+  remove_worker(i);
+  if (! complete) { workers_complete = false; return false; }
+
+  Knoten += r.Knoten; SingleKnoten += r.SingleKnoten;
+  VerSingleKnoten += r.VerSingleKnoten;
+  QuasiSingleKnoten += r.QuasiSingleKnoten; PureL += r.PureL;
+  Autarkien += r.Autarkien; V1KlRed += r.V1KlRed;
+  FastAutarkien += r.FastAutarkien; neue2Klauseln += r.neue2Klauseln;
+  Vorausbelegungen += r.Vorausbelegungen;
+  if (r.maxneue2K > maxneue2K) maxneue2K = r.maxneue2K;
+  if (r.Suchbaumtiefe > worker_depth) worker_depth = r.Suchbaumtiefe;
+  Ueberschreitung2 += r.Ueberschreitung2;
+  proportion_searched += r.proportion_searched;
+  proportion_single += r.proportion_single;
+  if (r.e == Unbestimmt) workers_complete = false;
+  return r.e == SAT;
+}
+
+//! Killing all running workers
+static void stop_workers(void) {
+  for (unsigned int i = 0; i < active_workers; ++i)
+    kill(workers[i].pid, SIGKILL);
+  while (active_workers != 0) remove_worker(active_workers-1);
+}
+
+/*!
+  \brief Combining the result e of the scheduler with the results of the
+  workers (waiting for all of them)
+*/
+static enum Ergebniswerte finish_workers(const enum Ergebniswerte e) {
+  if (e == SAT) { stop_workers(); return SAT; }
+  while (active_workers != 0)
+    if (collect_worker()) { stop_workers(); return SAT; }
+  return workers_complete ? e : Unbestimmt;
+}
+
 /* ------------------------------------------------------------- */
 
 typedef enum { gleich = 0, groesser = 1, kleiner = 2} VERGL;
@@ -484,6 +730,13 @@ void InitSat() {
   proportion_searched = 0;
   proportion_single = 0;
   if (splitting_only) splitting_cases = 0;
+  if (parallel_workers != 0) {
+    workers = (struct worker*) xmalloc(parallel_workers * sizeof(struct worker));
+    worker_fds = (struct pollfd*) xmalloc(parallel_workers * sizeof(struct pollfd));
+    active_workers = worker_cases = 0;
+    workers_complete = true;
+    worker_time = 0; worker_depth = 0;
+  }
 
   if (Monitor && (! nurVorreduktion)) {
     totalbeobachtet = 0;
@@ -501,7 +754,7 @@ void InitSat() {
 static void AufraeumenSat() {
   struct Sammlung* Z; struct Sammlung* Z0;
   
-  Knoten = SingleKnoten = VerSingleKnoten = QuasiSingleKnoten = PureL = Autarkien = V1KlRed = Suchbaumtiefe = Ueberschreitung2 = FastAutarkien = InitEinerRed = neue2Klauseln = maxneue2K = init2Klauseln = 0;
+  Knoten = SingleKnoten = VerSingleKnoten = QuasiSingleKnoten = PureL = Autarkien = V1KlRed = Suchbaumtiefe = Ueberschreitung2 = FastAutarkien = InitEinerRed = neue2Klauseln = maxneue2K = init2Klauseln = Vorausbelegungen = 0;
   proportion_searched = proportion_single = 0;
   Tiefe = NULL;
 
@@ -517,6 +770,10 @@ static void AufraeumenSat() {
 
   free(Zweiglast); Zweiglast = NULL;
   free(beobachtet); beobachtet = NULL;
+  free(workers); workers = NULL;
+  free(worker_fds); worker_fds = NULL;
+  free(worker_assignment); worker_assignment = NULL;
+  worker_cases = 0; worker_time = 0; worker_depth = 0;
 }
 
 
@@ -741,6 +998,8 @@ alleReduktionen:
       ((! splitting_n && Rekursionstiefe == Beobachtungsniveau) ||
        (splitting_n && N - aktN >= Beobachtungsniveau))) {
     ++splitting_cases;
+    if (splitting_binary) output_cube_binary();
+    else {
     output_decision_levels(fpsplitdec);
     if (splitting_file) AusgabeBelegung(fpsplit);
     else {
@@ -754,6 +1013,7 @@ alleReduktionen:
       AusgabeBelegung(file_sc);
       fclose(file_sc);
     }
+    }
     const enum Spruenge r = SatVar -> Ruecksprung;
     SatVar = SatVar -> davor;
     if (SatVar == NULL) {
@@ -781,6 +1041,27 @@ alleReduktionen:
   }
   assert(! splitting_only || Rekursionstiefe < Beobachtungsniveau);
 
+  // handling of parallel processing (only the scheduler reaches this with
+  // depth Beobachtungsniveau):
+  if (parallel_workers != 0 && ! is_worker &&
+      Rekursionstiefe == Beobachtungsniveau) {
+    if (active_workers == parallel_workers && collect_worker()) return SAT;
+    if (! start_worker()) {
+      const enum Spruenge r = SatVar -> Ruecksprung;
+      SatVar = SatVar -> davor;
+      if (SatVar == NULL) {
+        assert(Rekursionstiefe == 0);
+        return UNSAT;
+      }
+      assert(Rekursionstiefe >= 1);
+      --Rekursionstiefe;
+      switch (r) {
+      case SAT1 : goto nachSAT1;
+      case SAT2 : goto nachSAT2;
+      }
+    }
+  }
+
   /* Now branching. */
 
 #ifdef OUTPUTTREEDATAXML
@@ -1036,6 +1317,8 @@ void Statistikzeile(FILE* const fp) {
             "c number_of_1-autarkies                 %lu\n"
             "c number_of_new_2-clauses               %lu\n"
             "c maximal_number_of_added_2-clauses     %lu\n"
+            "c number_of_r2_propagations             %lu\n"
+            "c r2_propagations_per_node              %.1f\n"
             "c file_name                             %s\n",
 	    s, P0, N0, K0, L0,
             InitEinerRed, P0 - P, N0 - N, K0 - K, L0 - L, init2Klauseln,
@@ -1045,12 +1328,18 @@ void Statistikzeile(FILE* const fp) {
           (double) proportion_searched, (double) proportion_single, (double)(proportion_searched+proportion_single),
 	    Ueberschreitung2, 
 	    FastAutarkien, neue2Klauseln, maxneue2K,
+            Vorausbelegungen, (Knoten == 0) ? 0.0 : (double) Vorausbelegungen / Knoten,
 	    aktName);
           if (splitting_only)
             fprintf(fp,
             "c splitting_directory                   %s\n"
             "c splitting_cases                       %u\n",
             splitting_store, splitting_cases);
+          if (parallel_workers != 0)
+            fprintf(fp,
+            "c worker_processes                      %u\n"
+            "c worker_cases                          %u\n",
+            parallel_workers, worker_cases);
   }
   else {
     fprintf(fp, "<SAT-solver.output timestamp = \"%ld\" >\n", time(0));
@@ -1274,6 +1563,8 @@ int main(const int argc, const char* const argv[]) {
       splitting_n = ! splitting_n;
     else if (strcmp("-SF", argv[Argument]) == 0)
       splitting_file = ! splitting_file;
+    else if (strcmp("-SB", argv[Argument]) == 0)
+      splitting_binary = ! splitting_binary;
     else if (strcmp("-DO", argv[Argument]) == 0) {
       Format = Dimacs_Format;
       spezRueckgabe = true;
@@ -1407,6 +1698,18 @@ int main(const int argc, const char* const argv[]) {
         }
       Verhaeltnis = V;
     }
+    else if (strncmp("-W=", argv[Argument], 3) == 0) {
+#if defined BAUMRES || defined LOKALLERNEN || defined ALLSAT || defined OUTPUTTREEDATAXML
+      printf("NOT IMPLEMENTED: combination of -W with BAUMRES, LOKALLERNEN, ALLSAT or OUTPUTTREEDATAXML!\n");
+      return 1;
+#endif
+      int Nummer;
+      if (sscanf(argv[Argument] + 3, "%d", &Nummer) != 1 || Nummer < 0) {
+        fprintf(stderr, "%s\n", Meldung(65));
+        return 1;
+      }
+      parallel_workers = Nummer;
+    }
     else if (strncmp("-S=", argv[Argument], 3) == 0) {
       splitting_only = true;
       Belegung = true;
@@ -1421,8 +1724,22 @@ int main(const int argc, const char* const argv[]) {
       return 1;
     }
     else {
+      if (parallel_workers != 0) {
+        if (splitting_only) { fprintf(stderr, "%s\n", Meldung(66)); return 1; }
+        Monitor = false;
+      }
       if (splitting_only) {
         if (! Belegung) { fprintf(stderr, "%s\n", Meldung(58)); return 1; }
+        if (splitting_binary) {
+          const uint64_t header[2] = {0, 0}; // by finish_cubes_binary
+          if ((fpsplit = fopen(splitting_store, "wb")) == NULL ||
+              fwrite(cubes_magic, 1, 8, fpsplit) != 8 ||
+              fwrite(header, sizeof(uint64_t), 2, fpsplit) != 2) {
+            fprintf(stderr, "%s %s\n", Meldung(60), splitting_store);
+            return 1;
+          }
+        }
+        else {
         if (splitting_file) {
           if ((fpsplit = fopen(splitting_store, "w")) == NULL) {
             fprintf(stderr, "%s %s\n", Meldung(60), splitting_store);
@@ -1438,6 +1755,7 @@ int main(const int argc, const char* const argv[]) {
           fprintf(stderr, "%s %s\n", Meldung(62), splitting_decisions);
           return 1;
         }
+        }
       }
       aktName = argv[Argument];
       s = Unbestimmt;
@@ -1536,6 +1854,8 @@ int main(const int argc, const char* const argv[]) {
         }
         
         s = SATEntscheidung();
+        if (is_worker) report_worker(s);
+        if (parallel_workers != 0) s = finish_workers(s);
         if (splitting_only && splitting_cases != 0) s = Unbestimmt;
       }
       
@@ -1548,6 +1868,11 @@ int main(const int argc, const char* const argv[]) {
       times(Zeiger);
       Verbrauch = SysZeit.tms_utime - akkVerbrauch;
 #endif
+      if (parallel_workers != 0) {
+        stop_workers();
+        Verbrauch += worker_time * EPS;
+        if (worker_depth > Suchbaumtiefe) Suchbaumtiefe = worker_depth;
+      }
       if (Monitor) printf("\n");
       Statistikzeile(stdout);
       if (Dateiausgabe) Statistikzeile(fpaus);
@@ -1556,18 +1881,23 @@ int main(const int argc, const char* const argv[]) {
       /* Zeichen die SAT-Zugehoerigkeit (d.h.: 0 oder 1) angibt. */
       
       if (Belegung && (s == SAT)) {
-        if (! Dateiausgabe) AusgabeBelegung(stdout);
+        if (! Dateiausgabe) {
+          if (worker_assignment) fputs(worker_assignment, stdout);
+          else AusgabeBelegung(stdout);
+        }
         else {
           if ((fppa = fopen(NameBel, "w")) == NULL) {
             fprintf(stderr, "%s %s\n", Meldung(27), NameBel);
             return 1;
           }
-          AusgabeBelegung(fppa);
+          if (worker_assignment) fputs(worker_assignment, fppa);
+          else AusgabeBelegung(fppa);
         }
       }
     Aufraeumen :
       
       alarm(0);
+      if (splitting_binary && fpsplit != NULL) finish_cubes_binary();
       AufraeumenSat();
 #ifdef BAUMRES
       AufraeumenBaumRes();
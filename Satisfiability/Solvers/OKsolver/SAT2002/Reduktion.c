@@ -1,5 +1,5 @@
 // Oliver Kullmann, 1.11.1998 (Frankfurt)
-/* Copyright 1998 - 2007 Oliver Kullmann
+/* Copyright 1998 - 2007, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -120,6 +120,8 @@ __inline__ static bool La_belege( LIT x )
   LIT lz;
   KLN kn;
 
+  ++Vorausbelegungen;
+
   /* Durchlaufe alle x-Vorkommen und kuerze die aktiven Klauseln */
 
   for (y = erstesVork(x); echtesVork(y, x); y = naechstesVork(y))
@@ -422,6 +424,7 @@ void berechne_Huelle(LIT x) {
 #endif
   sp = H + 1; setzenRundeL(x);
   do {
+    ++Vorausbelegungen;
     for (LITV y = erstesVork(x); echtesVork(y, x); y = naechstesVork(y))
       if (RundeK( kn = KlnVk(y) ) != Runde) {
         /* Klausel von y noch nicht angefasst? */
@@ -1,5 +1,5 @@
 // Oliver Kullmann, 13.9.2007 (Swansea)
-/* Copyright 2007, 2008, 2009, 2011, 2012, 2013, 2024 Oliver Kullmann
+/* Copyright 2007, 2008, 2009, 2011, 2012, 2013, 2024, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -358,12 +358,18 @@ CFLAGS="-UMACHINE_BITS_OKL"
      instances created by "-S" (see below) in a (single) file; default is OFF,
      storing the partial assignments each in its own file.
      </li>
+     <li> <code>-SB</code> for saving the partial assignments together with
+     the decisions in a single indexed binary file (the format is documented
+     in OKsolver_2002_lnk.c; no decisions-file is created); default is OFF.
+     Via <code>ConquerCubes</code> (Interfaces/DistributedSolving) the
+     data-file, the text-forms, and the parallel solving of the
+     sub-instances are available. </li>
     </ul>
    </li>
    <li> <code>-S=directory</code> resp. <code>-S=file</code>:
     <ol>
      <li> Whether the directory- or the file-form is active depends on "-SF"
-     (see above). </li>
+     and "-SB" (see above; "-SB" has precedence). </li>
      <li> The directory must already exist and must be writable. </li>
      <li> The file will be created if needed. </li>
      <li> Uses the depth-parameter "-D=d" (as above for monitoring). </li>
@@ -415,6 +421,29 @@ CFLAGS="-UMACHINE_BITS_OKL"
      </li>
     </ol>
    </li>
+   <li> <code>-W=T</code> for processing the monitoring nodes (at depth d, as
+   given by "-D") by at most T parallel worker-processes (default T=0, i.e.,
+   sequential processing):
+    <ol>
+     <li> The tree above depth d is processed by the main process, which
+     for every node at depth d reached creates a worker via fork(), and
+     continues immediately with the next node; if T workers are running,
+     then it waits for one of them to finish. </li>
+     <li> The workers report their results and statistics to the main
+     process (so the statistics are the same as for sequential processing,
+     except for the number of nodes in the satisfiable case); the running
+     time is the sum of the times of all processes. </li>
+     <li> Once a worker found a satisfying assignment, all other workers are
+     killed. </li>
+     <li> Monitoring ("-M") is switched off, and "-S" can not be used
+     together with "-W". </li>
+     <li> Not available in combination with the macros BAUMRES (so only for
+     OKsolver2002_NTP), LOKALLERNEN, ALLSAT and OUTPUTTREEDATAXML. </li>
+     <li> Statistics-output (Dimacs-form) additionally shows T as
+     "worker_processes", and the number of created workers as
+     "worker_cases". </li>
+    </ol>
+   </li>
    <li> To be completed. </li>
   </ul>
 
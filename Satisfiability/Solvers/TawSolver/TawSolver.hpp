@@ -0,0 +1,424 @@
+// Oliver Kullmann, 16.10.2026 (Swansea)
+/* Copyright 2026 Oliver Kullmann
+This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
+it and/or modify it under the terms of the GNU General Public License as published by
+the Free Software Foundation and included in this library; either version 3 of the
+License, or any later version. */
+
+/*
+
+  The tawSolver-algorithm (as in tawSolver.cpp, with the default options)
+  as a library-component, with the whole state in the solver-object
+
+   - var_t (std::uint32_t), lit_t (std::int32_t), clause_t (vector of lit_t)
+   - var(lit_t) -> var_t
+
+   - scoped enum Result (unsat=20, sat=10, as the return-values of tawSolver)
+
+   - struct Statistics :
+    - formula: n, c (clauses, without tautologies), taut (tautological
+      clauses), l (literal-occurrences), maxk (maximal clause-length)
+    - search: result, nodes, binary_nodes, units (number of 1-reductions),
+      evaluations (of the heuristics)
+    - operator += (adding the search-statistics)
+
+   - class Solver :
+    - Solver() (no variables, no clauses), Solver(n)
+    - add_clause(clause_t) : reduces the clause (tautologies are ignored,
+      repeated literals are contracted); the empty clause and unit-clauses
+      are allowed
+    - add_clauses(clauses)
+    - solve(clause_t assumptions = {}) -> Statistics
+      (can be called repeatedly, and clauses can be added in-between)
+    - solution() -> const clause_t& : after a satisfiable solve, the
+      satisfying partial assignment, as list of literals (sorted by variable)
+    - last() -> const Statistics& (for the last solve)
+    - total() -> const Statistics& (accumulated over all solve's).
+
+  Several solver-objects can be used at the same time, also from different
+  threads. The cost of clause-reading (and process-creation) is thus avoided
+  for many small instances; setting-up of the algorithmic data structures
+  happens (only) for the first solve after adding clauses.
+
+  Remarks on the relation to tawSolver.cpp:
+   - Unit-clauses (and then the assumptions) are handled at the root like
+     decisions, each followed by unit-clause-propagation (the 1-reductions
+     are counted).
+   - Unlike with tawSolver (which exits after having found a satisfying
+     assignment), the search is always completely undone.
+   - For formulas without unit-clauses and with no assumptions, the
+     number of nodes etc. is the same as for tawSolver.
+
+*/
+
+#ifndef TAWSOLVER_ziWt8Y9Lq2
+#define TAWSOLVER_ziWt8Y9Lq2
+
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <limits>
+#include <ostream>
+#include <initializer_list>
+#include <utility>
+
+#include <cstdint>
+#include <cstdlib>
+#include <cassert>
+#include <cmath>
+
+namespace TawSolver {
+
+  typedef std::uint32_t var_t;
+  typedef std::int32_t lit_t;
+  typedef std::vector<lit_t> clause_t;
+  typedef std::vector<clause_t> clauselist_t;
+  typedef std::uint64_t count_t;
+
+  inline constexpr var_t var(const lit_t x) noexcept { return std::abs(x); }
+
+  enum class Result { unsat = 20, sat = 10 };
+  inline std::ostream& operator <<(std::ostream& out, const Result r) {
+    return out << (r == Result::sat ? "SATISFIABLE" : "UNSATISFIABLE");
+  }
+
+  struct Statistics {
+    var_t n = 0;
+    count_t c = 0, taut = 0, l = 0;
+    var_t maxk = 0;
+    Result result = Result::unsat;
+    count_t nodes = 0, binary_nodes = 0, units = 0, evaluations = 0;
+
+    Statistics& operator +=(const Statistics& s) noexcept {
+      n = s.n; c = s.c; taut = s.taut; l = s.l; maxk = s.maxk;
+      result = s.result;
+      nodes += s.nodes; binary_nodes += s.binary_nodes; units += s.units;
+      evaluations += s.evaluations;
+      return *this;
+    }
+    friend std::ostream& operator <<(std::ostream& out, const Statistics& s) {
+      return out << s.result << " " << s.n << " " << s.c << " " << s.l
+                 << " " << s.nodes << " " << s.binary_nodes << " "
+                 << s.units << " " << s.evaluations;
+    }
+  };
+
+
+  class Solver {
+  public :
+
+    typedef double weight_t;
+    // As the defaults in tawSolver.cpp:
+    static constexpr std::array<weight_t, 7> predetermined_weights
+      {0, 0, 4.85, 1, 0.354, 0.11, 0.0694};
+    static constexpr weight_t basis_open = 1.46;
+
+  private :
+
+    struct Clause {
+      const lit_t* b;
+      const lit_t* e;
+      var_t length, old_length; // length = 0 iff satisfied
+      const lit_t* begin() const noexcept { return b; }
+      const lit_t* end() const noexcept { return e; }
+    };
+    typedef Clause* ClauseP;
+    struct Occurrences {
+      const ClauseP* b;
+      const ClauseP* e;
+      const ClauseP* begin() const noexcept { return b; }
+      const ClauseP* end() const noexcept { return e; }
+    };
+    static constexpr int pos = 0, neg = 1;
+    static constexpr int sign(const lit_t x) noexcept { return x >= 0 ? pos : neg; }
+
+    // The formula (as added):
+    clause_t arena; // the literals of the clauses, one after another
+    std::vector<count_t> starts; // starts[i] is the index of clause i in arena
+    clause_t units_; // the unit-clauses
+    bool empty_clause = false;
+    Statistics fstats;
+    std::vector<count_t> round_table; // for reduction of added clauses
+    count_t round = 0;
+
+    // The algorithmic data structures (set by init()):
+    bool valid = false;
+    std::vector<Clause> clauses;
+    std::vector<ClauseP> all_occurrences;
+    std::vector<std::array<Occurrences,2>> occ; // occ[v][pos/neg]
+    std::vector<weight_t> weights;
+    clause_t pass; // pass[v] = 0 (unassigned), v or -v
+    std::vector<ClauseP> changes;
+    ClauseP* next_change;
+    clause_t main_stack, input_stack;
+    lit_t* end_main;
+    lit_t* end_input;
+    bool contradiction_;
+    count_t r_clauses;
+
+    clause_t solution_;
+    Statistics last_, total_;
+
+  public :
+
+    Solver() noexcept = default;
+    explicit Solver(const var_t n) { fstats.n = n; }
+
+    var_t n() const noexcept { return fstats.n; }
+    count_t c() const noexcept { return fstats.c + units_.size() + empty_clause; }
+
+    void add_clause(const clause_t& C) {
+      valid = false;
+      for (const lit_t x : C) fstats.n = std::max(fstats.n, var(x));
+      if (round_table.size() <= fstats.n) round_table.resize(fstats.n + 1);
+      ++round;
+      const auto begin = arena.size();
+      for (const lit_t x : C) {
+        const var_t v = var(x);
+        assert(v != 0);
+        const count_t t = round_table[v];
+        const count_t comp = 2*round + sign(x);
+        if (t == (comp ^ 1)) { // tautology
+          arena.resize(begin); ++fstats.taut; return;
+        }
+        if (t != comp) { arena.push_back(x); round_table[v] = comp; }
+      }
+      const var_t k = arena.size() - begin;
+      if (k == 0) { empty_clause = true; return; }
+      if (k == 1) {
+        units_.push_back(arena.back()); arena.pop_back(); return;
+      }
+      starts.push_back(begin);
+      ++fstats.c; fstats.l += k;
+      fstats.maxk = std::max(fstats.maxk, k);
+    }
+    void add_clause(const std::initializer_list<lit_t> C) {
+      add_clause(clause_t(C));
+    }
+    void add_clauses(const clauselist_t& F) {
+      for (const clause_t& C : F) add_clause(C);
+    }
+
+    const clause_t& solution() const noexcept { return solution_; }
+    const Statistics& last() const noexcept { return last_; }
+    const Statistics& total() const noexcept { return total_; }
+
+    Statistics solve(const clause_t& assumptions = {}) {
+      for (const lit_t x : assumptions)
+        if (var(x) > fstats.n) {
+          fstats.n = var(x); valid = false;
+        }
+      if (not valid) init();
+      last_ = fstats;
+      solution_.clear();
+      ++last_.nodes;
+      if (empty_clause) last_.result = Result::unsat;
+      else last_.result = root(assumptions) ? Result::sat : Result::unsat;
+      total_ += last_;
+      return last_;
+    }
+
+  private :
+
+    void init() {
+      const var_t n = fstats.n;
+      const count_t c = fstats.c;
+      starts.push_back(arena.size());
+      clauses.resize(c);
+      std::vector<std::array<count_t,2>> count(n+1);
+      for (count_t i = 0; i < c; ++i) {
+        Clause& C = clauses[i];
+        C.b = arena.data() + starts[i]; C.e = arena.data() + starts[i+1];
+        C.length = C.e - C.b; C.old_length = 0;
+        for (const lit_t x : C) ++count[var(x)][sign(x)];
+      }
+      starts.pop_back();
+      all_occurrences.resize(fstats.l);
+      occ.assign(n+1, {});
+      {const ClauseP* p = all_occurrences.data();
+       for (var_t v = 1; v <= n; ++v)
+         for (int s = pos; s <= neg; ++s) {
+           occ[v][s].b = p; p += count[v][s]; occ[v][s].e = p;
+         }
+      }
+      for (Clause& C : clauses)
+        for (const lit_t x : C) {
+          auto& cnt = count[var(x)][sign(x)];
+          *const_cast<ClauseP*>(occ[var(x)][sign(x)].e - cnt--) = &C;
+        }
+      weights.assign(predetermined_weights.begin(), predetermined_weights.end());
+      if (weights.size() <= fstats.maxk) weights.resize(fstats.maxk + 1);
+      for (var_t k = predetermined_weights.size(); k <= fstats.maxk; ++k)
+        weights[k] = std::max(std::numeric_limits<weight_t>::min(),
+          predetermined_weights.back() *
+            std::pow(basis_open, -weight_t(k) + predetermined_weights.size()-1));
+      pass.assign(n+1, 0);
+      changes.resize(fstats.l + 3 * (count_t(n) + 1));
+      next_change = changes.data();
+      main_stack.resize(n+1); input_stack.resize(n+1);
+      end_main = main_stack.data(); end_input = input_stack.data();
+      contradiction_ = false;
+      r_clauses = c;
+      valid = true;
+    }
+
+    // Change-management:
+    void start_new() noexcept { *(next_change++) = nullptr; }
+    void push_change(const ClauseP C) noexcept { *(next_change++) = C; }
+    void reactivate_0() noexcept {
+      while (const ClauseP C = *(--next_change)) ++C->length;
+    }
+    void reactivate_1() noexcept {
+      while (const ClauseP C = *(--next_change)) {
+        C->length = C->old_length; ++r_clauses;
+      }
+    }
+
+    // Unit-clause-propagation (DFS-processing of the unit-clauses):
+    void push_unit(const lit_t x) noexcept { *(end_input++) = x; }
+    lit_t pop_unit() noexcept { return *(end_main++) = *(--end_input); }
+    bool open_units() const noexcept { return end_input != input_stack.data(); }
+    // Returns false iff contradiction found:
+    bool push_unit_clause(const Clause& C) noexcept {
+      for (const lit_t y : C) {
+        lit_t& val = pass[var(y)];
+        if (val == 0) { push_unit(y); val = y; return true; }
+        else if (val == y) return true;
+      }
+      contradiction_ = true;
+      return false;
+    }
+    bool contradiction() noexcept {
+      if (contradiction_) { contradiction_ = false; return true; }
+      else return false;
+    }
+    // Undoing the assignments of the current node:
+    void reset_units(lit_t* const begin_main) noexcept {
+      for (lit_t* p = begin_main; p != end_main; ++p) pass[var(*p)] = 0;
+      for (lit_t* p = input_stack.data(); p != end_input; ++p)
+        pass[var(*p)] = 0;
+      end_main = begin_main; end_input = input_stack.data();
+    }
+
+    void assign_0(const lit_t x) noexcept {
+      const var_t v = var(x);
+      pass[v] = x;
+      for (const ClauseP C : occ[v][sign(-x)]) {
+        if (C->length == 0) continue;
+        push_change(C);
+        --C->length;
+        if (C->length == 1 and not push_unit_clause(*C)) return;
+      }
+    }
+    void assign_1(const lit_t x) noexcept {
+      const var_t v = var(x);
+      for (const ClauseP C : occ[v][sign(x)]) {
+        if (C->length == 0) continue;
+        C->old_length = C->length; C->length = 0; --r_clauses;
+        push_change(C);
+      }
+    }
+
+    // Branching_product from tawSolver.cpp:
+    lit_t branching_literal() noexcept {
+      ++last_.evaluations;
+      lit_t x = 0;
+      weight_t max1 = 0, max2 = 0;
+      const var_t n = fstats.n;
+      for (var_t v = 1; v <= n; ++v) {
+        if (pass[v]) continue;
+        weight_t pd = 0, nd = 0;
+        for (const ClauseP C : occ[v][pos]) pd += weights[C->length];
+        for (const ClauseP C : occ[v][neg]) nd += weights[C->length];
+        if (pd == 0 or nd == 0) {
+          if (pd == 0 and nd == 0) continue;
+          if (max1 != 0) continue;
+          const weight_t sum = pd + nd;
+          if (sum <= max2) continue;
+          max2 = sum; x = pd >= nd ? lit_t(v) : -lit_t(v);
+          continue;
+        }
+        const weight_t prod = pd * nd;
+        if (prod < max1) continue;
+        const weight_t sum = pd + nd;
+        if (prod > max1) max1 = prod;
+        else if (sum <= max2) continue;
+        max2 = sum; x = pd >= nd ? lit_t(v) : -lit_t(v);
+      }
+      return x;
+    }
+
+    void save_solution() {
+      solution_.clear();
+      for (var_t v = 1; v <= fstats.n; ++v)
+        if (pass[v]) solution_.push_back(pass[v]);
+    }
+
+    // Propagating x (and the literals already on the input-stack):
+    bool dll(const lit_t x) {
+      ++last_.nodes;
+      assert(x);
+      bool result = false;
+      lit_t* const begin_main = end_main;
+      start_new();
+      push_unit(x); pass[var(x)] = x;
+      assign_0(pop_unit());
+      while (open_units()) {
+        if (contradiction()) goto only_neg_units;
+        ++last_.units;
+        assign_0(pop_unit());
+      }
+      start_new();
+      for (const lit_t* p = begin_main; p != end_main; ++p) assign_1(*p);
+      if (r_clauses == 0) { save_solution(); result = true; }
+      else {
+        const lit_t y = branching_literal();
+        result = dll(y);
+        if (not result) { ++last_.binary_nodes; result = dll(-y); }
+      }
+      reactivate_1();
+    only_neg_units :
+      reactivate_0();
+      reset_units(begin_main);
+      return result;
+    }
+
+    // The root, with unit-clauses and assumptions:
+    bool root(const clause_t& assumptions) {
+      assert(valid);
+      bool result = false;
+      lit_t* const begin_main = end_main;
+      start_new();
+      for (const clause_t* const U : {&std::as_const(units_), &assumptions})
+        for (const lit_t x : *U) {
+          lit_t& val = pass[var(x)];
+          if (val == -x) goto only_neg_units;
+          if (val == x) continue;
+          val = x; push_unit(x);
+          assign_0(pop_unit());
+          while (open_units()) {
+            if (contradiction()) goto only_neg_units;
+            ++last_.units;
+            assign_0(pop_unit());
+          }
+        }
+      start_new();
+      for (const lit_t* p = begin_main; p != end_main; ++p) assign_1(*p);
+      if (r_clauses == 0) { save_solution(); result = true; }
+      else {
+        const lit_t x = branching_literal();
+        result = dll(x);
+        if (not result) { ++last_.binary_nodes; result = dll(-x); }
+      }
+      reactivate_1();
+    only_neg_units :
+      reactivate_0();
+      reset_units(begin_main);
+      return result;
+    }
+
+  };
+
+}
+
+#endif
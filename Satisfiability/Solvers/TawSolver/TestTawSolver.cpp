@@ -0,0 +1,124 @@
+// Oliver Kullmann, 16.10.2026 (Swansea)
+/* Copyright 2026 Oliver Kullmann
+This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
+it and/or modify it under the terms of the GNU General Public License as published by
+the Free Software Foundation and included in this library; either version 3 of the
+License, or any later version. */
+
+#include <iostream>
+
+#include <cassert>
+
+#include <ProgramOptions/Environment.hpp>
+
+#include "TawSolver.hpp"
+
+namespace {
+
+  const Environment::ProgramInfo proginfo{
+        "0.1.0",
+        "16.10.2026",
+        __FILE__,
+        "Oliver Kullmann",
+        "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Solvers/TawSolver/TestTawSolver.cpp",
+        "GPL v3"};
+
+  using namespace TawSolver;
+
+  template <class X>
+  constexpr bool eqp(const X& lhs, const X& rhs) noexcept {
+    return lhs == rhs;
+  }
+
+  // The pigeonhole-formula with p pigeons and h holes:
+  clauselist_t php(const var_t p, const var_t h) {
+    const auto v = [h](const var_t i, const var_t j){return lit_t(i*h+j+1);};
+    clauselist_t F;
+    for (var_t i = 0; i < p; ++i) {
+      clause_t C;
+      for (var_t j = 0; j < h; ++j) C.push_back(v(i,j));
+      F.push_back(C);
+    }
+    for (var_t j = 0; j < h; ++j)
+      for (var_t i = 0; i < p; ++i)
+        for (var_t k = i+1; k < p; ++k)
+          F.push_back({-v(i,j), -v(k,j)});
+    return F;
+  }
+
+}
+
+int main(const int argc, const char* const argv[]) {
+  if (Environment::version_output(std::cout, proginfo, argc, argv))
+  return 0;
+
+  {Solver S;
+   assert(S.n() == 0); assert(S.c() == 0);
+   const Statistics st = S.solve();
+   assert(st.result == Result::sat);
+   assert(st.nodes == 1);
+   assert(S.solution().empty());
+   S.add_clause({});
+   assert(S.c() == 1);
+   assert(S.solve().result == Result::unsat);
+   assert(S.total().nodes == 2);
+  }
+
+  {Solver S;
+   S.add_clause({1,2}); S.add_clause({-1,2,2}); S.add_clause({1,1,-2});
+   assert(S.n() == 2); assert(S.c() == 3);
+   assert(S.solve().result == Result::sat);
+   assert(S.last().taut == 0);
+   assert(eqp(S.solution(), {1,2}));
+   assert(S.solve({-2}).result == Result::unsat);
+   assert(S.solve({-1}).result == Result::unsat);
+   assert(S.solve({1}).result == Result::sat);
+   assert(eqp(S.solution(), {1,2}));
+   assert(S.solve({1,-1}).result == Result::unsat);
+   assert(S.solve({3}).result == Result::sat);
+   assert(S.n() == 3);
+   assert(eqp(S.solution(), {1,2,3}));
+   const count_t nodes = S.total().nodes;
+   S.add_clause({-1,-2});
+   assert(S.solve().result == Result::unsat);
+   assert(S.total().nodes == nodes + S.last().nodes);
+  }
+
+  {Solver S;
+   S.add_clause({1,2,-2}); S.add_clause({-3});
+   assert(S.c() == 1);
+   const Statistics st = S.solve();
+   assert(st.taut == 1); assert(st.c == 0);
+   assert(st.result == Result::sat);
+   assert(eqp(S.solution(), {-3}));
+   S.add_clause({3,4}); S.add_clause({-4,5});
+   assert(S.solve().result == Result::sat);
+   assert(eqp(S.solution(), {-3,4,5}));
+   assert(S.last().units == 2);
+   assert(S.solve({-5}).result == Result::unsat);
+  }
+
+  {Solver S;
+   S.add_clauses(php(5,4));
+   const Statistics st = S.solve();
+   // As tawSolver:
+   assert(st.result == Result::unsat);
+   assert(st.n == 20); assert(st.c == 45); assert(st.l == 100);
+   assert(st.maxk == 4);
+   assert(st.nodes == 47);
+   assert(st.binary_nodes == 23);
+   assert(st.units == 147);
+   assert(st.evaluations == 23);
+   const Statistics st2 = S.solve();
+   assert(st2.nodes == st.nodes); assert(st2.units == st.units);
+   assert(S.solve({1}).result == Result::unsat);
+  }
+  {Solver S;
+   S.add_clauses(php(4,4));
+   assert(S.solve().result == Result::sat);
+   assert(S.solution().size() == 16);
+   assert(S.solve({1,6,11}).result == Result::sat);
+   assert(S.solve({1,5}).result == Result::unsat);
+  }
+
+}
@@ -43,6 +43,10 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
   contains some historical inaccuracies (e.g., "DLL" is the only correct name
   for this special algorithm), but is otherwise reasonable.
 
+  A library-version of the solver (for the default options), with the whole
+  state in solver-objects, accepting clauses in memory and allowing repeated
+  solving under assumptions, is given by TawSolver.hpp in this directory.
+
 
   COMPILE with
 
@@ -109,7 +113,15 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
      if VAR_MARGINALS is defined (which includes ALL_SOLUTIONS), then at
      the end of the statistics for the variables the pairs "v:count" are
      output, where count is the number of satisfying assignments with v=true;
-     if argument3 is not given, then the default is -cout.
+     if argument3 is not given, then the default is -cout;
+   - if PARALLEL is defined, then argument4 is the number of threads
+     (default 0, which means the number of hardware threads), and
+     argument5 is the splitting-depth (default see below);
+   - otherwise argument4 is the checkpoint-file (default "-nil", which
+     means no checkpoints), argument5 the checkpoint-period in seconds
+     (default 0, which means no periodic checkpoints), and with
+     argument6 = "-resume" the computation continues from the checkpoint
+     in the checkpoint-file.
 
   Output to file means appending.
 
@@ -123,6 +135,16 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
   is aborted. When sending SIGUSR1, then the statistics is output, and the
   computation is continued.
 
+  If a checkpoint-file is given (not for PARALLEL), then on SIGUSR2 (and
+  periodically, if a checkpoint-period is given) a checkpoint is written to
+  that file (replacing the old content), containing the decisions leading
+  to the current node and all statistics (including counts and marginals),
+  while on SIGTERM after writing the checkpoint the computation is aborted
+  (as for SIGINT). Resuming from a checkpoint yields the same final
+  statistics (except of times) as an uninterrupted computation, while
+  solutions (if output) found after the checkpoint and before the abortion
+  are output again.
+
   There are the following macros to control compilation:
 
    - LIT_TYPE (default std::int32_t)
@@ -152,6 +174,34 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
      namely modulo 2^count_bits);
      can also be defined as e.g. "double" or "long double", in which case the
      result may become "inf".
+   - PARALLEL: if defined (default is undefined), then the search tree is
+     split ("cube-and-conquer"): the branching-literals of the nodes at depth
+     < d (the splitting-depth) are computed as usual (by the main thread),
+     yielding the "cubes" (the decision-paths of length d), which are
+     then solved by a pool of worker threads, each with its own copy of the
+     algorithmic data structures (only the literal-arrays of the clauses are
+     shared), and with work-stealing for the distribution of the cubes.
+     The default for d is ceil(log_2(T)) + split_surplus, where T is the
+     number of threads, and split_surplus = 6.
+     Counts of solutions and the statistics of the search tree (number of
+     nodes etc.) are then the same as for the sequential version (in case of
+     ALL_SOLUTIONS, where the whole tree is traversed), while the order of
+     solutions output is arbitrary, and in the SAT-mode the first satisfying
+     assignment found stops the search.
+     Incompatible with PURE_LITERALS (and thus with FIRST_VARIABLE).
+     Signals are only handled by the main thread; the statistics-output
+     caused by them only contains the cube-generation phase.
+   - COMPACT_CLAUSES: if defined (default is undefined), then the clauses
+     only contain their (current and old) lengths, while the literals of
+     all clauses are stored in one array, accessed via 32-bit offsets; and
+     the literal-occurrences are stored as 32-bit clause-indices, all in one
+     array, grouped by variable (first the positive, then the negative
+     occurrences). So the number of literal-occurrences must be less
+     than 2^32. The search is exactly the same as without this macro.
+   - NO_MMAP: if defined (default is undefined), then input-files are read
+     via streams (as for "-cin"); otherwise regular files are memory-mapped,
+     and the clauses are read directly from the mapping, with the literals
+     of all clauses stored contiguously.
 
   To provide further version-information, there are two macros, which are
   only relevant if they are defined:
@@ -270,6 +320,11 @@ TawSolver> for N in {5..13}; do echo -n "$N: "; Pandiagonal $N "" | UnitClausePr
 #include <exception>
 #include <algorithm>
 #include <chrono>
+#ifdef PARALLEL
+# include <thread>
+# include <mutex>
+# include <atomic>
+#endif
 
 #include <cstdlib>
 #include <cmath>
@@ -277,14 +332,21 @@ TawSolver> for N in {5..13}; do echo -n "$N: "; Pandiagonal $N "" | UnitClausePr
 #include <cassert>
 #include <csignal>
 
+#ifndef NO_MMAP
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <fcntl.h>
+# include <unistd.h>
+#endif
+
 namespace {
 
 #define is_pod(X) std::is_standard_layout_v<X> and std::is_trivial_v<X>
 
 // --- General input and output ---
 
-const std::string version = "2.20.3";
-const std::string date = "25.2.2024";
+const std::string version = "2.24.0";
+const std::string date = "16.10.2026";
 
 #if defined WEIGHT_2 | defined WEIGHT_4 | defined WEIGHT_5 | defined WEIGHT_6 | defined WEIGHT_BASIS_OPEN | defined TWEIGHT_2 | defined TWEIGHT_4 | defined TWEIGHT_5 | defined TWEIGHT_6 | defined TWEIGHT_BASIS_OPEN
 # define WEIGHT_DEFINED
@@ -299,6 +361,17 @@ const std::string date = "25.2.2024";
 # endif
 #endif
 
+#ifdef PARALLEL
+# ifdef PURE_LITERALS
+#  error "PARALLEL not compatible with PURE_LITERALS.\n"
+# endif
+// The variables of the search-state are thread-local:
+# define TLS thread_local
+#else
+# define TLS
+# define CHECKPOINTING
+#endif
+
 const std::string program =
 #if defined ALL_SOLUTIONS
   "c"
@@ -321,6 +394,12 @@ const std::string program =
 #ifdef ALPHA
   "_alpha"
 #endif
+#ifdef PARALLEL
+  "_par"
+#endif
+#ifdef COMPACT_CLAUSES
+  "_compact"
+#endif
 #ifndef NDEBUG
   "_debug"
 #endif
@@ -336,7 +415,10 @@ enum Error_codes {
   variable_value_error=7,
   number_clauses_error=8,
   empty_clause_error=9,
-  unit_clause_error=11
+  unit_clause_error=11,
+  parameter_error=12,
+  offset_error=13,
+  checkpoint_error=14
 };
 
 // The following three return-values are not errors:
@@ -508,6 +590,10 @@ typedef std::vector<Lit> Lit_vec;
   Clauses are typically handled via pointers, and ClauseP is the typedef
   for pointers to Clause.
 
+  If COMPACT_CLAUSES is defined, then a clause only stores the two lengths,
+  while begin() and end() are obtained via the index of the clause (relative
+  to clause_base) from the offsets in clause_begin into literal_arena.
+
 */
 
 typedef double Weight_t; // weights and their sums
@@ -522,16 +608,36 @@ typedef std::uint_fast64_t Count_clauses;
 // Used for input-reading and initialisation:
 typedef std::vector<std::array<Count_clauses,2>> Count_vec;
 
-Count_clauses r_clauses; // "r" = "remaining"
+TLS Count_clauses r_clauses; // "r" = "remaining"
+
+// The literals of all clauses (if COMPACT_CLAUSES is defined or the input
+// is memory-mapped), contiguously (shared by all threads):
+Lit_vec literal_arena;
+
+#ifdef COMPACT_CLAUSES
+typedef std::uint32_t Offset; // offsets into literal_arena or clauses
+constexpr std::uint64_t max_offset = std::numeric_limits<Offset>::max();
+typedef std::vector<Offset> Offset_vec;
+// The clause with index i has literals literal_arena[clause_begin[i]] to
+// literal_arena[clause_begin[i+1]-1]:
+Offset_vec clause_begin;
+class Clause;
+TLS const Clause* clause_base; // the first clause (of the thread)
+#endif
 
 class Clause {
+#ifndef COMPACT_CLAUSES
   const Lit* b; // the array of literals in the clause (as in the input)
   const Lit* e; // one past-the-end
+#endif
   Clause_index length_; // the current length, or 0 iff clause is satisfied
   Clause_index old_length; // if satisfied, the length before satisfaction
   // The following function (for initialisation) sets these data members
   // (while not using the private member functions below):
   friend void add_a_clause_to_formula(const Lit_vec&, Count_vec&);
+#ifndef NO_MMAP
+  friend bool read_formula_mapped(const std::string&, Count_vec&);
+#endif
 
   // The friends below (for updating the length) only access the following
   // member functions:
@@ -553,8 +659,17 @@ class Clause {
   friend void assign_0(Lit) noexcept;
   friend void assign_1(Lit) noexcept;
 public :
+#ifndef COMPACT_CLAUSES
   const Lit* begin() const noexcept { return b; }
   const Lit* end() const noexcept { return e; }
+#else
+  const Lit* begin() const noexcept {
+    return literal_arena.data() + clause_begin[this - clause_base];
+  }
+  const Lit* end() const noexcept {
+    return literal_arena.data() + clause_begin[this - clause_base + 1];
+  }
+#endif
   Clause_index length() const noexcept { return length_; }
   explicit operator bool() const noexcept { return length_; }
 };
@@ -573,6 +688,7 @@ typedef std::vector<ClauseP> ClauseP_vec;
 
 // --- Data structures for literal occurrences ---
 
+#ifndef COMPACT_CLAUSES
 class LiteralOccurrences {
 
   class Literal_occurrences {
@@ -615,6 +731,27 @@ static_assert(is_pod(Literal_occurrences), "Literal_occurrences is not POD.");
      }
     }
   }
+#ifdef PARALLEL
+  // Copying L, where the clause-pointers are relocated from old to cl:
+  void copy(const LiteralOccurrences& L, const Clause_vec& old, const Clause_vec& cl) {
+    if (L.all_lit_occurrences.empty()) return;
+    all_lit_occurrences.resize(L.all_lit_occurrences.size());
+    const ClauseP new_cl = const_cast<ClauseP>(cl.data());
+    const Clause* const old_cl = old.data();
+    for (size_type i = 0; i < all_lit_occurrences.size(); ++i)
+      all_lit_occurrences[i] = new_cl + (L.all_lit_occurrences[i] - old_cl);
+    varocc = L.varocc;
+    const ClauseP* const new_occ = all_lit_occurrences.data();
+    const ClauseP* const old_occ = L.all_lit_occurrences.data();
+    for (auto& V : varocc)
+      for (auto& O : V) {
+        if (not O.b) continue;
+        O.b = new_occ + (O.b - old_occ);
+        O.e = new_occ + (O.e - old_occ);
+      }
+  }
+  friend void copy_formula();
+#endif
   LiteralOccurrences(const LiteralOccurrences&) = delete;
   LiteralOccurrences(const LiteralOccurrences&&) = delete;
   friend void read_formula(const std::string&);
@@ -624,6 +761,95 @@ public :
   const Variable_occurrences& operator[](const Var i) const noexcept {return varocc[i];}
 };
 
+#else
+
+/* The occurrences of literal (v,p) are the clause-indices
+     occ[start[2*v+p]], ..., occ[start[2*v+p+1]-1],
+   which via iteration are translated into pointers (relative to
+   clause_base).
+*/
+class LiteralOccurrences {
+
+  class Literal_occurrences {
+    const Offset* b;
+    const Offset* e;
+    ClauseP base;
+  public :
+    class iterator {
+      const Offset* p;
+      ClauseP base;
+    public :
+      iterator(const Offset* const p, const ClauseP base) noexcept :
+        p(p), base(base) {}
+      ClauseP operator *() const noexcept { return base + *p; }
+      iterator& operator ++() noexcept { ++p; return *this; }
+      bool operator !=(const iterator& other) const noexcept {
+        return p != other.p;
+      }
+    };
+    Literal_occurrences(const Offset* const b, const Offset* const e,
+                        const ClauseP base) noexcept : b(b), e(e), base(base) {}
+    iterator begin() const noexcept { return {b, base}; }
+    iterator end() const noexcept { return {e, base}; }
+  };
+
+  class Variable_occurrences {
+    const Offset* s;
+    const Offset* o;
+    ClauseP base;
+  public :
+    Variable_occurrences(const Offset* const s, const Offset* const o,
+                         const ClauseP base) noexcept : s(s), o(o), base(base) {}
+    Literal_occurrences operator[](const Polarity p) const noexcept {
+      return {o + s[p], o + s[p+1], base};
+    }
+  };
+
+  Offset_vec start;
+  Offset_vec occ;
+
+  void init(const Count_clauses s, const Var n, [[maybe_unused]] const Clause_vec& clauses, Count_vec& count) {
+    if (s == 0) return;
+    start.resize(2*(Count_clauses(n)+1) + 1);
+    occ.resize(s);
+    Offset pos_occ = 0;
+    for (Var v = 1; v <= n; ++v)
+      for (int p = 0; p <= 1; ++p) {
+        start[2*v+p] = pos_occ;
+        pos_occ += count[v][p];
+      }
+    start[2*Count_clauses(n)+2] = pos_occ;
+    assert(pos_occ == s);
+    assert(clause_begin.size() >= 1);
+    const Offset c = clause_begin.size() - 1;
+    assert(c <= clauses.size());
+    for (Offset i = 0; i < c; ++i) {
+      const Lit* const end = literal_arena.data() + clause_begin[i+1];
+      for (const Lit* x = literal_arena.data() + clause_begin[i]; x != end; ++x) {
+        const Var v = var(*x); const Polarity p = sign(*x);
+        occ[start[2*v+p+1] - count[v][p]--] = i;
+      }
+    }
+  }
+#ifdef PARALLEL
+  // The occurrences are independent of the addresses of the clauses:
+  void copy(const LiteralOccurrences& L, const Clause_vec&, const Clause_vec&) {
+    start = L.start; occ = L.occ;
+  }
+  friend void copy_formula();
+#endif
+  LiteralOccurrences(const LiteralOccurrences&) = delete;
+  LiteralOccurrences(const LiteralOccurrences&&) = delete;
+  friend void read_formula(const std::string&);
+
+public :
+  LiteralOccurrences() = default;
+  Variable_occurrences operator[](const Var i) const noexcept {
+    return {start.data() + 2*i, occ.data(), const_cast<ClauseP>(clause_base)};
+  }
+};
+#endif
+
 
 // --- Basic global variables ---
 
@@ -633,6 +859,13 @@ class Clauses {
   friend void read_formula_header(std::istream&);
   friend void add_a_clause_to_formula(const Lit_vec&, Count_vec&);
   friend void read_formula(const std::string&);
+#ifndef NO_MMAP
+  friend bool read_formula_mapped(const std::string&, Count_vec&);
+#endif
+#ifdef PARALLEL
+  friend void copy_formula();
+  friend DLL_return_t dll_par(Lit);
+#endif
 
   Clauses(const Clauses&) = delete;
   Clauses(Clauses&&) = delete;
@@ -643,11 +876,13 @@ public :
     for (const Clause& C : F.cl) out << C;
     return out;
   }
-} clauses; /* After construction no direct access anymore to variable "clauses"
-  (the clauses are handled via pointers to the elements of cl); "clauses" is
-  the only instance of class Clauses. */
+};
+TLS Clauses clauses; /* After construction no direct access anymore to
+  variable "clauses" (the clauses are handled via pointers to the elements of
+  cl); "clauses" is the only instance of class Clauses (per thread, if
+  PARALLEL is defined). */
 
-LiteralOccurrences lits;
+TLS LiteralOccurrences lits;
 // via lits[v][pos/neg] the sequence of literal-occurrences is obtained
 
 Count_clauses n_header_clauses, n_clauses, n_taut; // r_clauses see above
@@ -657,16 +892,16 @@ Clause_index max_clause_length;
 
 typedef std::uint_fast64_t Count_statistics;
 
-Count_statistics n_nodes;
-Count_statistics n_backtracks;
-Count_statistics n_units;
+TLS Count_statistics n_nodes;
+TLS Count_statistics n_backtracks;
+TLS Count_statistics n_units;
 
-  Count_statistics n_evaluations;
+TLS Count_statistics n_evaluations;
 #ifndef FIRST_VARIABLE
-  Count_statistics n_proj, n_proj2zero, n_proj1zero,
-    n_nofirst, n_withfirst, n_nosecond, n_withsecond;
+TLS Count_statistics n_proj, n_proj2zero, n_proj1zero,
+  n_nofirst, n_withfirst, n_nosecond, n_withsecond;
 
-Weight_t sum_first, sum_second, sumsq_first, sumsq_second,
+TLS Weight_t sum_first, sum_second, sumsq_first, sumsq_second,
   min_first = std::numeric_limits<Weight_t>::infinity(),
   min_second = min_first,
   max_first = -std::numeric_limits<Weight_t>::infinity(),
@@ -693,7 +928,7 @@ Count_statistics n_pure_literals;
 #endif
 
 #ifdef TAU_ITERATION
-Count_statistics wtau_calls, tau_iterations;
+TLS Count_statistics wtau_calls, tau_iterations;
 #endif
 
 #ifdef ALL_SOLUTIONS
@@ -715,7 +950,7 @@ template <typename CT> struct Pow2<CT,false> {
   }
 };
 Pow2<Count_solutions,floating_count> pow2;
-Count_solutions n_solutions;
+TLS Count_solutions n_solutions;
 #endif
 #ifdef VAR_MARGINALS
 typedef std::vector<Count_solutions> SolCount_vec;
@@ -818,7 +1053,13 @@ void read_formula_header(std::istream& f) {
     errout << "Parameter number-of-clauses too big for round-counter.";
     std::exit(file_pline_error);
   }
-  try { clauses.cl.resize(n_header_clauses); }
+  try {
+    clauses.cl.resize(n_header_clauses);
+#ifdef COMPACT_CLAUSES
+    clause_begin.reserve(n_header_clauses+1);
+    clause_begin.assign(1, 0);
+#endif
+  }
   catch (const std::bad_alloc&) {
     errout << "Allocation error for clauses-vector of size " <<
       n_header_clauses << " (the number-of-clauses).";
@@ -883,6 +1124,28 @@ inline bool read_a_clause_from_file(std::istream& f, Lit_vec& C) {
   return true;
 }
 
+// Allocating the counts of literal-occurrences:
+void init_count(Count_vec& count) {
+  try { count.resize(n_vars+1); }
+  catch (const std::bad_alloc&) {
+    errout << "Allocation error for counting-vector of size " <<
+      n_vars << " (the maximal-variable-index).";
+    std::exit(allocation_error);
+  }
+}
+
+#ifdef COMPACT_CLAUSES
+// Completing the current clause in literal_arena:
+inline void push_clause_end() {
+  if (literal_arena.size() > max_offset) {
+    errout << "More than " << max_offset << " literal-occurrences, "
+      "not possible with COMPACT_CLAUSES.";
+    std::exit(offset_error);
+  }
+  clause_begin.push_back(literal_arena.size());
+}
+#endif
+
 // Error only if announced number of clauses too small (but may be too big):
 inline void add_a_clause_to_formula(const Lit_vec& D, Count_vec& count) {
   const auto n = D.size();
@@ -896,12 +1159,19 @@ inline void add_a_clause_to_formula(const Lit_vec& D, Count_vec& count) {
   }
   auto& C = clauses.cl[n_clauses];
   C.length_ = n;
+#ifndef COMPACT_CLAUSES
   C.b = new Lit[n];
   C.e = C.b + n;
+#else
+  literal_arena.insert(literal_arena.end(), D.begin(), D.end());
+  push_clause_end();
+#endif
   if (n > max_clause_length) max_clause_length = n;
   for (Clause_index i = 0; i < n; ++i) {
     const Lit x = D[i];
+#ifndef COMPACT_CLAUSES
     const_cast<Lit*>(C.b)[i] = x;
+#endif
     const Var v = var(x);
     ++count[v][sign(x)];
     max_occ_var = std::max(v, max_occ_var);
@@ -910,6 +1180,164 @@ inline void add_a_clause_to_formula(const Lit_vec& D, Count_vec& count) {
   n_lit_occurrences += n;
 }
 
+#ifndef NO_MMAP
+/* Reading from a memory-mapped file: the header is read as above (by
+   read_formula_header, applied to the comment-lines and the p-line), while
+   the clauses are read directly from the mapping by a hand-written scanner,
+   with the same semantics as read_a_clause_from_file (including that a
+   first literal of a clause running up to the end of the file, without
+   a following space, ends the input); the literals of all clauses
+   are placed in literal_arena (whose capacity is an upper bound on the
+   number of literals, computed from the file-size, so that no reallocation
+   happens).
+*/
+
+class MappedFile {
+  int fd = -1;
+  const char* b = nullptr;
+  std::size_t size_ = 0;
+  MappedFile(const MappedFile&) = delete;
+  MappedFile(MappedFile&&) = delete;
+public :
+  // Only for (non-empty) regular files, otherwise conversion to false:
+  explicit MappedFile(const std::string& name) noexcept {
+    fd = ::open(name.c_str(), O_RDONLY);
+    if (fd == -1) return;
+    struct stat st;
+    if (::fstat(fd, &st) != 0 or not S_ISREG(st.st_mode) or st.st_size == 0)
+      return;
+    void* const m = ::mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (m == MAP_FAILED) return;
+    ::madvise(m, st.st_size, MADV_SEQUENTIAL);
+    b = static_cast<const char*>(m); size_ = st.st_size;
+  }
+  ~MappedFile() {
+    if (b) ::munmap(const_cast<char*>(b), size_);
+    if (fd != -1) ::close(fd);
+  }
+  explicit operator bool() const noexcept { return b; }
+  const char* begin() const noexcept { return b; }
+  const char* end() const noexcept { return b + size_; }
+  std::size_t size() const noexcept { return size_; }
+};
+
+inline constexpr bool is_space(const char c) noexcept {
+  return c == ' ' or c == '\n' or c == '\t' or c == '\r' or c == '\v' or
+    c == '\f';
+}
+
+// Returns false iff the file can not be mapped (then nothing has been read):
+bool read_formula_mapped(const std::string& filename, Count_vec& count) {
+  const MappedFile file(filename);
+  if (not file) return false;
+  const char* p = file.begin();
+  const char* const e = file.end();
+  {const char* h = p; // the lines up to the first non-comment-line:
+   while (h != e) {
+     const char c = *h;
+     h = std::find(h, e, '\n');
+     if (h != e) ++h;
+     if (c != 'c') break;
+   }
+   std::istringstream header(std::string(p, h));
+   read_formula_header(header);
+   p = h;
+  }
+  init_count(count);
+  try { literal_arena.reserve(file.size() / 2 + 1); }
+  catch (const std::bad_alloc&) {
+    errout << "Allocation error for literal-arena of size " <<
+      file.size() / 2 + 1 << " (half the file-size).";
+    std::exit(allocation_error);
+  }
+  std::vector<Rounds> literal_table(n_vars+1,0);
+  Rounds round = 0;
+  while (true) {
+    while (p != e and is_space(*p)) ++p;
+    if (p == e or std::find_if(p, e, is_space) == e) break;
+    const Lit_vec::size_type begin = literal_arena.size();
+    bool tautology = false;
+    assert(round != std::numeric_limits<Rounds>::max());
+    ++round;
+    while (true) { // reading literals
+      if (p == e) {
+        errout << (tautology ? "Invalid literal-read in tautological clause." :
+                   "Invalid literal-read.");
+        std::exit(literal_read_error);
+      }
+      const bool negative = *p == '-';
+      if (negative or *p == '+') ++p;
+      const char* const digits = p;
+      Var val = 0;
+      bool overflow = false;
+      while (p != e and *p >= '0' and *p <= '9') {
+        const Var d = *p++ - '0';
+        if (val > (Var(max_lit) - d) / 10) { overflow = true; break; }
+        val = 10 * val + d;
+      }
+      if (p == digits or overflow or (p != e and not is_space(*p))) {
+        errout << (tautology ? "Invalid literal-read in tautological clause." :
+                   "Invalid literal-read.");
+        std::exit(literal_read_error);
+      }
+      while (p != e and is_space(*p)) ++p;
+      if (val == 0) break; // end of clause
+      if (tautology) continue;
+      const Lit x(negative ? -Lit_int(val) : Lit_int(val));
+      const Var v = val;
+      if (v > n_vars) {
+        errout << "Literal " << x << " contradicts n=" << n_vars << ".";
+        std::exit(variable_value_error);
+      }
+      const auto t = literal_table[v];
+      const auto comp = negative ? -round : round;
+      if (t == -comp) tautology = true;
+      else if (t != comp) {
+        assert(literal_arena.size() < literal_arena.capacity());
+        literal_arena.push_back(x);
+        literal_table[v] = comp;
+      }
+    }
+    if (tautology) {
+      literal_arena.resize(begin);
+      ++n_taut;
+      continue;
+    }
+    const Clause_index n = literal_arena.size() - begin;
+    if (n == 0) {
+      errout << "Found empty clause in input.";
+      std::exit(empty_clause_error);
+    }
+    if (n == 1) {
+      errout << "Found unit-clause in input.";
+      std::exit(unit_clause_error);
+    }
+    if (n_clauses >= n_header_clauses) {
+      errout << "More than " << n_header_clauses << " clauses, contradicting cnf-header.";
+      std::exit(number_clauses_error);
+    }
+    auto& C = clauses.cl[n_clauses];
+    C.length_ = n;
+#ifndef COMPACT_CLAUSES
+    C.b = literal_arena.data() + begin;
+    C.e = C.b + n;
+#else
+    push_clause_end();
+#endif
+    if (n > max_clause_length) max_clause_length = n;
+    for (auto i = begin; i != literal_arena.size(); ++i) {
+      const Lit x = literal_arena[i];
+      const Var v = var(x);
+      ++count[v][sign(x)];
+      max_occ_var = std::max(v, max_occ_var);
+    }
+    ++n_clauses;
+    n_lit_occurrences += n;
+  }
+  return true;
+}
+#endif
+
 void read_formula(const std::string& filename) {
   class Input {
     const std::string& f;
@@ -927,18 +1355,19 @@ void read_formula(const std::string& filename) {
     ~Input() { if (del) delete p; }
     std::istream& operator *() const { return *p; }
   };
-  const Input in(filename);
-  read_formula_header(*in);
   Count_vec count;
-  try { count.resize(n_vars+1); }
-  catch (const std::bad_alloc&) {
-    errout << "Allocation error for counting-vector of size " <<
-      n_vars << " (the maximal-variable-index).";
-    std::exit(allocation_error);
-  }
-  {Lit_vec C;
+#ifndef NO_MMAP
+  if (filename == "-cin" or not read_formula_mapped(filename, count))
+#endif
+  {const Input in(filename);
+   read_formula_header(*in);
+   init_count(count);
+   Lit_vec C;
    while (read_a_clause_from_file(*in,C)) add_a_clause_to_formula(C,count);
   }
+#ifdef COMPACT_CLAUSES
+  clause_base = clauses.cl.data();
+#endif
   if (not (r_clauses = n_clauses)) return;
   try { lits.init(n_lit_occurrences, max_occ_var, clauses.cl, count); }
   catch (const std::bad_alloc&) {
@@ -957,7 +1386,7 @@ void read_formula(const std::string& filename) {
 class Pass {
   Lit_vec pass;
   void init() { pass.resize(max_occ_var+1); }
-  friend void initialisation();
+  friend void thread_initialisation();
 public :
   Lit operator[] (const Var v) const noexcept { return pass[v]; }
   Lit& operator[] (const Var v) noexcept { return pass[v]; }
@@ -974,12 +1403,12 @@ public :
     return out << "0" << std::endl;
   }
 };
-Pass pass;
+TLS Pass pass;
 #ifdef VAR_MARGINALS
 class VarMarginals {
   SolCount_vec sc;
   void init() { sc.resize(n_vars+1); }
-  friend void initialisation();
+  friend void thread_initialisation();
   friend DLL_return_t dll0();
 public :
   Count_solutions operator[] (const Var v) const noexcept { return sc[v]; }
@@ -991,7 +1420,7 @@ public :
     return out << std::endl;
   }
 };
-VarMarginals marginals;
+TLS VarMarginals marginals;
 #endif
 
 class ChangeManagement {
@@ -1004,7 +1433,7 @@ class ChangeManagement {
     changes.resize(s);
     begin = next = &*changes.begin();
   }
-  friend void initialisation();
+  friend void thread_initialisation();
 public :
   void start_new() noexcept { *(next++) = nullptr; }
   void push(const ClauseP C) noexcept { *(next++) = C; }
@@ -1015,7 +1444,7 @@ public :
     while (const ClauseP C = *(--next)) C->activate();
   }
 };
-ChangeManagement changes;
+TLS ChangeManagement changes;
 
 /* Buffers for unit-clauses (to be processed), either
     - first-in first-out (BFS), or
@@ -1028,16 +1457,16 @@ ChangeManagement changes;
 #if UCP_STRATEGY == 0 // BFS
 class Unit_stack {
   typedef Lit_vec stack_t;
-  static stack_t stack;
-  static Lit* end_;
-  static Lit* open_;
+  static TLS stack_t stack;
+  static TLS Lit* end_;
+  static TLS Lit* open_;
   const Lit* const begin_;
   static void init() {
     stack.resize(max_occ_var);
     assert(max_occ_var);
     end_ = &stack[0];
   }
-  friend void initialisation();
+  friend void thread_initialisation();
 public :
   static void push(const Lit x) noexcept {
     assert(end_ - &stack[0] < max_occ_var);
@@ -1057,19 +1486,19 @@ public :
   const Lit* begin() const noexcept { return begin_; }
   static const Lit* end() noexcept { return end_; }
 };
-Unit_stack::stack_t Unit_stack::stack;
-Lit* Unit_stack::end_;
-Lit* Unit_stack::open_;
+TLS Unit_stack::stack_t Unit_stack::stack;
+TLS Lit* Unit_stack::end_;
+TLS Lit* Unit_stack::open_;
 
 #else // DFS
 
 class Unit_stack {
   typedef Lit_vec stack_t;
-  static stack_t main_stack;
-  static stack_t input_stack;
-  static Lit* begin_input;
-  static Lit* end_input;
-  static Lit* end_main;
+  static TLS stack_t main_stack;
+  static TLS stack_t input_stack;
+  static TLS Lit* begin_input;
+  static TLS Lit* end_input;
+  static TLS Lit* end_main;
   const Lit* const begin_main;
   static Lit push_main(const Lit x) noexcept {
     assert(end_main - &main_stack[0] < max_occ_var);
@@ -1086,7 +1515,7 @@ class Unit_stack {
     end_main = &main_stack[0];
     begin_input = end_input = &input_stack[0];
   }
-  friend void initialisation();
+  friend void thread_initialisation();
 public :
   static void push(const Lit x) noexcept {
     assert(end_input - begin_input < max_occ_var);
@@ -1105,11 +1534,11 @@ public :
   const Lit* begin() const noexcept { return begin_main; }
   static const Lit* end() noexcept { return end_main; }
 };
-Unit_stack::stack_t Unit_stack::main_stack;
-Unit_stack::stack_t Unit_stack::input_stack;
-Lit* Unit_stack::begin_input;
-Lit* Unit_stack::end_input;
-Lit* Unit_stack::end_main;
+TLS Unit_stack::stack_t Unit_stack::main_stack;
+TLS Unit_stack::stack_t Unit_stack::input_stack;
+TLS Lit* Unit_stack::begin_input;
+TLS Lit* Unit_stack::end_input;
+TLS Lit* Unit_stack::end_main;
 #endif
 
 class Push_unit_clause {
@@ -1136,7 +1565,7 @@ public :
     else return false;
   }
 };
-Push_unit_clause push_unit_clause;
+TLS Push_unit_clause push_unit_clause;
 
 #ifdef PURE_LITERALS
 void assign_1(Lit) noexcept;
@@ -1157,7 +1586,7 @@ class PureLiterals {
     assert(max_occ_var);
     end_ = &stack[0];
   }
-  friend void initialisation();
+  friend void thread_initialisation();
 public :
   static void clear() noexcept { new_begin = end_; }
   static bool set(const Var v, const Polarity s) noexcept {
@@ -1331,19 +1760,24 @@ Weights weight;
 
 // --- Initialisation of algorithmic data structures ---
 
-void initialisation() {
+// The data structures local to a thread (if PARALLEL is defined):
+void thread_initialisation() {
   pass.init();
 #ifdef VAR_MARGINALS
   marginals.init();
 #endif
   changes.init();
   Unit_stack::init();
-  weight.init();
 #ifdef PURE_LITERALS
   PureLiterals::init();
 #endif
 }
 
+void initialisation() {
+  thread_initialisation();
+  weight.init();
+}
+
 
 // --- Assignments to variables ---
 
@@ -1604,9 +2038,403 @@ inline Lit branching_literal() noexcept {
 
 // --- The main (backtracking) algorithm ---
 
+#define S(x) #x
+#define STR(x) S(x)
+
+const std::string options = ""
+#if UCP_STRATEGY == 0
+"B"
+#endif
+#ifdef PURE_LITERALS
+"P"
+#endif
+#ifdef TAU_ITERATION
+"T"
+#endif
+#ifdef FIRST_VARIABLE
+"fv"
+#endif
+#ifdef ALL_SOLUTIONS
+# ifdef VAR_MARGINALS
+"M"
+# else
+"A"
+# endif
+    + std::string(floating_count ? "F" : "") + std::to_string(count_digits)
+#endif
+#ifdef LAMBDA
+    + std::string("L" STR(LAMBDA))
+#endif
+#ifdef ALPHA
+    + std::string("AL" STR(ALPHA))
+#endif
+;
+
 Pass sat_pass;
 
+#ifdef PARALLEL
+std::atomic_bool sat_found;
+std::mutex solout_mutex;
+#endif
+
+inline void set_sat_pass() {
+#ifdef PARALLEL
+  if (sat_found.exchange(true)) return;
+#endif
+  sat_pass = pass;
+}
+
+#ifdef ALL_SOLUTIONS
+# ifdef CHECKPOINTING
+bool solution_found = false; // whether count_solutions has been called
+# endif
+// Handling the satisfying (partial) assignment pass:
+inline void count_solutions() {
+# ifdef PARALLEL
+  if (solout.active()) {
+    const std::lock_guard<std::mutex> lock(solout_mutex);
+    solout << pass;
+  }
+# else
+  solout << pass;
+# endif
+# ifdef CHECKPOINTING
+  solution_found = true;
+# endif
+# ifndef VAR_MARGINALS
+  n_solutions += pow2(n_vars - pass.n());
+# else
+  const Var rem_n = n_vars - pass.n();
+  assert(marginals.size() == n_vars+1);
+  if (rem_n == 0) {
+    ++n_solutions;
+    for (Var i=1; i <= n_vars; ++i)
+      marginals[i] += sign(pass[i]) == Polarity::pos;
+  } else {
+    const auto total = pow2(rem_n);
+    n_solutions += total;
+    const auto totald2 = total / 2;
+    for (Var i=1; i <= n_vars; ++i) {
+      const Lit x = pass[i];
+      Count_solutions& m = marginals[i];
+      if (not x) m += totald2;
+      else if (sign(x) == Polarity::pos) m += total;
+    }
+  }
+# endif
+}
+#endif
+
+#ifdef CHECKPOINTING
+
+// --- Checkpoints ---
+
+/* Via SIGUSR2, and periodically via SIGALRM (if a period has been set),
+   a checkpoint is requested, which is written at the beginning of the next
+   node of dll (before anything else is done there) to checkpoint_file,
+   replacing its old content (via renaming a temporary file); via SIGTERM
+   additionally the computation is aborted after writing the checkpoint
+   (with the statistics output as for SIGINT).
+   A checkpoint contains the decisions leading to the current node, and all
+   statistics (including the count of solutions and the marginals; floating-
+   point values are written in hexadecimal notation).
+   When resuming from a checkpoint, the decisions are replayed, recomputing
+   the branching-literals (and checking them against the decisions); a first
+   branch is skipped if the decision is the second branch. At the node of
+   the checkpoint all statistics are restored, and the search proceeds as
+   usual.
+*/
+
+std::string checkpoint_file; // empty iff no checkpointing
+unsigned checkpoint_period; // in seconds; 0 means no periodic checkpoints
+bool resume;
+
+// 1 means write checkpoint, 2 means write checkpoint and abort:
+volatile std::sig_atomic_t checkpoint_request = 0;
+
+Lit_vec decisions; // the decisions leading to the current node of dll
+
+const std::string checkpoint_header = "c tawSolver-checkpoint";
+
+// The data of a checkpoint besides the decisions:
+struct Checkpoint_data {
+  DLL_return_t found; // whether a solution has been found before
+  Count_statistics nodes, backtracks, units, evaluations;
+# ifndef FIRST_VARIABLE
+  Count_statistics proj, proj2zero, proj1zero,
+    nofirst, withfirst, nosecond, withsecond;
+  Weight_t sumf, sums, sumsqf, sumsqs, minf, mins, maxf, maxs;
+# endif
+# ifdef PURE_LITERALS
+  Count_statistics pure;
+# endif
+# ifdef TAU_ITERATION
+  Count_statistics wtau, tau_it;
+# endif
+# ifdef ALL_SOLUTIONS
+  Count_solutions solutions;
+# endif
+};
+
+Checkpoint_data current_data() noexcept {
+  return {
+# ifdef ALL_SOLUTIONS
+      solution_found,
+# else
+      false,
+# endif
+      n_nodes, n_backtracks, n_units, n_evaluations
+# ifndef FIRST_VARIABLE
+      , n_proj, n_proj2zero, n_proj1zero,
+      n_nofirst, n_withfirst, n_nosecond, n_withsecond,
+      sum_first, sum_second, sumsq_first, sumsq_second,
+      min_first, min_second, max_first, max_second
+# endif
+# ifdef PURE_LITERALS
+      , n_pure_literals
+# endif
+# ifdef TAU_ITERATION
+      , wtau_calls, tau_iterations
+# endif
+# ifdef ALL_SOLUTIONS
+      , n_solutions
+# endif
+  };
+}
+void restore_data(const Checkpoint_data& D) noexcept {
+# ifdef ALL_SOLUTIONS
+  solution_found = D.found;
+# endif
+  n_nodes = D.nodes; n_backtracks = D.backtracks; n_units = D.units;
+  n_evaluations = D.evaluations;
+# ifndef FIRST_VARIABLE
+  n_proj = D.proj; n_proj2zero = D.proj2zero; n_proj1zero = D.proj1zero;
+  n_nofirst = D.nofirst; n_withfirst = D.withfirst;
+  n_nosecond = D.nosecond; n_withsecond = D.withsecond;
+  sum_first = D.sumf; sum_second = D.sums;
+  sumsq_first = D.sumsqf; sumsq_second = D.sumsqs;
+  min_first = D.minf; min_second = D.mins;
+  max_first = D.maxf; max_second = D.maxs;
+# endif
+# ifdef PURE_LITERALS
+  n_pure_literals = D.pure;
+# endif
+# ifdef TAU_ITERATION
+  wtau_calls = D.wtau; tau_iterations = D.tau_it;
+# endif
+# ifdef ALL_SOLUTIONS
+  n_solutions = D.solutions;
+# endif
+}
+
+// Writing the checkpoint for the node with decision x:
+void write_checkpoint(const Lit x) {
+  const std::string tmp = checkpoint_file + ".tmp";
+  {std::ofstream out(tmp);
+   out << std::hexfloat;
+   out << checkpoint_header << "\n"
+     "program " << program << "\n"
+     "version " << version << "\n"
+     "options \"" << options << "\"\n"
+     "formula " << n_vars << " " << n_clauses << " " << n_lit_occurrences << "\n"
+     "decisions " << decisions.size() + 1;
+   for (const Lit y : decisions) out << " " << y;
+   out << " " << x << "\n";
+   const Checkpoint_data D = current_data();
+   out << "found " << D.found << "\n"
+     "counts " << D.nodes << " " << D.backtracks << " " << D.units << " "
+       << D.evaluations << "\n";
+# ifndef FIRST_VARIABLE
+   out << "projections " << D.proj << " " << D.proj2zero << " " <<
+     D.proj1zero << " " << D.nofirst << " " << D.withfirst << " " <<
+     D.nosecond << " " << D.withsecond << "\n"
+     "measures " << D.sumf << " " << D.sums << " " << D.sumsqf << " " <<
+     D.sumsqs << " " << D.minf << " " << D.mins << " " << D.maxf << " " <<
+     D.maxs << "\n";
+# endif
+# ifdef PURE_LITERALS
+   out << "pure " << D.pure << "\n";
+# endif
+# ifdef TAU_ITERATION
+   out << "tau " << D.wtau << " " << D.tau_it << "\n";
+# endif
+# ifdef ALL_SOLUTIONS
+   out << "solutions " << D.solutions << "\n";
+# endif
+# ifdef VAR_MARGINALS
+   out << "marginals";
+   for (Var i = 1; i < marginals.size(); ++i) out << " " << marginals[i];
+   out << "\n";
+# endif
+   out << "end\n";
+   if (not out) {
+     errout << "Error when writing checkpoint-file \"" << tmp << "\".";
+     std::exit(file_writing_error);
+   }
+  }
+  if (std::rename(tmp.c_str(), checkpoint_file.c_str()) != 0) {
+    errout << "Error when renaming \"" << tmp << "\" to \"" <<
+      checkpoint_file << "\".";
+    std::exit(file_writing_error);
+  }
+}
+
+void abortion(int);
+// Handling a checkpoint-request at the node with decision x:
+void checkpoint(const Lit x) {
+  const bool abort = checkpoint_request == 2;
+  checkpoint_request = 0;
+  write_checkpoint(x);
+  if (abort) abortion(SIGTERM);
+}
+
+// Resumption:
+Lit_vec resume_path;
+Lit_vec::size_type resume_pos;
+Checkpoint_data resume_data;
+bool replay = false;
+
+void read_checkpoint() {
+  std::ifstream in(checkpoint_file);
+  const auto error = [](const std::string& m) {
+    errout << "Invalid checkpoint-file \"" << checkpoint_file << "\": " << m;
+    std::exit(checkpoint_error);
+  };
+  if (not in) error("can not be opened.");
+  std::string line;
+  std::getline(in, line);
+  if (line != checkpoint_header) error("wrong header.");
+  const auto key = [&in, &error](const std::string& k) {
+    std::string s;
+    if (not (in >> s) or s != k) error("expected \"" + k + "\".");
+  };
+  const auto token = [&in, &error]() {
+    std::string s;
+    if (not (in >> s)) error("premature end.");
+    return s;
+  };
+  const auto count = [&token, &error]() -> Count_statistics {
+    const std::string s = token();
+    try { std::size_t pos; const auto res = std::stoull(s, &pos);
+      if (pos == s.size()) return res; }
+    catch (const std::exception&) {}
+    error("invalid number \"" + s + "\".");
+    return 0;
+  };
+  [[maybe_unused]] const auto floating = [&token, &error]() -> long double {
+    const std::string s = token();
+    char* end;
+    const long double res = std::strtold(s.c_str(), &end);
+    if (s.empty() or *end != '\0') error("invalid number \"" + s + "\".");
+    return res;
+  };
+  key("program"); if (token() != program) error("different program.");
+  key("version"); if (token() != version) error("different version.");
+  key("options"); if (token() != "\"" + options + "\"")
+    error("different options.");
+  key("formula");
+  if (count() != n_vars or count() != n_clauses or
+      count() != n_lit_occurrences) error("different formula.");
+  key("decisions");
+  {const auto k = count();
+   if (k == 0 or k > n_vars) error("invalid number of decisions.");
+   resume_path.resize(k);
+   for (Lit& x : resume_path) {
+     const std::string s = token();
+     std::istringstream ss(s);
+     if (not (ss >> x) or not ss.eof() or not x or var(x) > n_vars)
+       error("invalid decision \"" + s + "\".");
+   }
+  }
+  Checkpoint_data& D = resume_data;
+  key("found"); D.found = count();
+  key("counts");
+  D.nodes = count(); D.backtracks = count(); D.units = count();
+  D.evaluations = count();
+# ifndef FIRST_VARIABLE
+  key("projections");
+  D.proj = count(); D.proj2zero = count(); D.proj1zero = count();
+  D.nofirst = count(); D.withfirst = count();
+  D.nosecond = count(); D.withsecond = count();
+  key("measures");
+  D.sumf = floating(); D.sums = floating();
+  D.sumsqf = floating(); D.sumsqs = floating();
+  D.minf = floating(); D.mins = floating();
+  D.maxf = floating(); D.maxs = floating();
+# endif
+# ifdef PURE_LITERALS
+  key("pure"); D.pure = count();
+# endif
+# ifdef TAU_ITERATION
+  key("tau"); D.wtau = count(); D.tau_it = count();
+# endif
+# ifdef ALL_SOLUTIONS
+  key("solutions");
+  if constexpr (floating_count) D.solutions = floating();
+  else D.solutions = count();
+# endif
+# ifdef VAR_MARGINALS
+  key("marginals");
+  assert(marginals.size() == n_vars+1);
+  for (Var i = 1; i <= n_vars; ++i)
+    if constexpr (floating_count) marginals[i] = floating();
+    else marginals[i] = count();
+# endif
+  key("end");
+  resume_pos = 0;
+  replay = true;
+}
+
+// Replaying the node with decision x:
+void replay_node(const Lit x) {
+  assert(resume_pos < resume_path.size());
+  if (x != resume_path[resume_pos]) {
+    errout << "Checkpoint does not fit: decision " << x << " at depth " <<
+      resume_pos << " instead of " << resume_path[resume_pos] << ".";
+    std::exit(checkpoint_error);
+  }
+  if (++resume_pos == resume_path.size()) {
+    restore_data(resume_data);
+    replay = false;
+    resume_path.clear(); resume_path.shrink_to_fit();
+  }
+}
+
+// Whether the first branch (with decision y) is to be skipped:
+inline bool skip_first(const Lit y) {
+  if (not replay) return false;
+  assert(resume_pos < resume_path.size());
+  const Lit z = resume_path[resume_pos];
+  if (z == y) return false;
+  if (z == -y) return true;
+  errout << "Checkpoint does not fit: decision " << z << " at depth " <<
+    resume_pos << ", while the branching-literal is " << y << ".";
+  std::exit(checkpoint_error);
+}
+
+DLL_return_t dll(Lit);
+// The first branch (with decision y), where for a skipped branch its result
+// is taken as the saved result:
+inline DLL_return_t first_branch(const Lit y) {
+  return skip_first(y) ? resume_data.found : dll(y);
+}
+
+#else
+
+DLL_return_t dll(Lit);
+inline DLL_return_t first_branch(const Lit y) { return dll(y); }
+
+#endif
+
 DLL_return_t dll(const Lit x) {
+#if defined PARALLEL and not defined ALL_SOLUTIONS
+  if (sat_found.load(std::memory_order_relaxed)) return true;
+#endif
+#ifdef CHECKPOINTING
+  if (replay) replay_node(x);
+  if (checkpoint_request) checkpoint(x);
+  decisions.push_back(x);
+#endif
   ++n_nodes;
   assert(x);
   DLL_return_t result = false;
@@ -1625,32 +2453,11 @@ DLL_return_t dll(const Lit x) {
   for (const Lit y : unit_stack) assign_1(y);
   if (not r_clauses) {
 #ifdef ALL_SOLUTIONS
-    solout << pass;
+    count_solutions();
     result = true;
-# ifndef VAR_MARGINALS
-    n_solutions += pow2(n_vars - pass.n());
-# else
-    const Var rem_n = n_vars - pass.n();
-    assert(marginals.size() == n_vars+1);
-    if (rem_n == 0) {
-      ++n_solutions;
-      for (Var i=1; i <= n_vars; ++i)
-        marginals[i] += sign(pass[i]) == Polarity::pos;
-    } else {
-      const auto total = pow2(rem_n);
-      n_solutions += total;
-      const auto totald2 = total / 2;
-      for (Var i=1; i <= n_vars; ++i) {
-        const Lit x = pass[i];
-        Count_solutions& m = marginals[i];
-        if (not x) m += totald2;
-        else if (sign(x) == Polarity::pos) m += total;
-      }
-    }
-# endif
     goto only_units;
 #else
-    sat_pass = pass;
+    set_sat_pass();
     return true;
 #endif
   }
@@ -1661,11 +2468,11 @@ DLL_return_t dll(const Lit x) {
    if (not r_clauses) {sat_pass = pass; return true;}
 #endif
 #ifdef ALL_SOLUTIONS
-   result = dll(y);
+   result = first_branch(y);
    ++n_backtracks;
    result = dll(-y) or result;
 #else
-   if (dll(y)) return true;
+   if (first_branch(y)) return true;
    ++n_backtracks;
    if (dll(-y)) return true;
 #endif
@@ -1680,9 +2487,280 @@ only_units :
   changes.reactivate_1();
 only_neg_units :
   changes.reactivate_0();
+#ifdef CHECKPOINTING
+  decisions.pop_back();
+#endif
+  return result;
+}
+
+
+#ifdef PARALLEL
+
+// --- Cube-and-conquer ---
+
+/* The nodes of the search tree at depth < split_depth are processed by the
+   main thread (via dll_split), where the branchings at depth split_depth-1
+   yield the cubes, the sequences of decision-literals (starting with the
+   first decision at the root); the subtrees given by the cubes are then
+   processed by the worker threads (via dll_cube).
+*/
+
+typedef unsigned Thread_index;
+Thread_index n_threads;
+Var split_depth;
+constexpr Var split_surplus = 6;
+
+typedef std::vector<Lit_vec> Cube_vec;
+typedef Cube_vec::size_type Cube_index;
+Cube_vec cubes;
+Lit_vec split_path; // the decisions for the current node of dll_split
+
+DLL_return_t dll_split(Lit);
+// Branching on y at the current node of dll_split:
+DLL_return_t branch_split(const Lit y) {
+  if (split_path.size() + 1 == split_depth) {
+    split_path.push_back(y); cubes.push_back(split_path);
+    split_path.back() = -y; cubes.push_back(split_path);
+    split_path.pop_back();
+    ++n_backtracks;
+    return false;
+  }
+  const DLL_return_t res1 = dll_split(y);
+#ifndef ALL_SOLUTIONS
+  if (res1) return true;
+#endif
+  ++n_backtracks;
+  const DLL_return_t res2 = dll_split(-y);
+  return res1 or res2;
+}
+// As dll(x), but with branching via branch_split:
+DLL_return_t dll_split(const Lit x) {
+  ++n_nodes;
+  assert(x);
+  DLL_return_t result = false;
+  split_path.push_back(x);
+
+  changes.start_new();
+  const Unit_stack unit_stack;
+  Unit_stack::push(x);
+  assign_0(Unit_stack::pop());
+  while (unit_stack) {
+    if (push_unit_clause.contradiction()) goto only_neg_units;
+    ++n_units;
+    assign_0(Unit_stack::pop());
+  }
+
+  changes.start_new();
+  for (const Lit y : unit_stack) assign_1(y);
+  if (not r_clauses) {
+#ifdef ALL_SOLUTIONS
+    count_solutions();
+    result = true;
+    goto only_units;
+#else
+    set_sat_pass();
+    return true;
+#endif
+  }
+
+  result = branch_split(branching_literal());
+#ifndef ALL_SOLUTIONS
+  if (result) return true;
+#else
+only_units :
+#endif
+  changes.reactivate_1();
+only_neg_units :
+  changes.reactivate_0();
+  split_path.pop_back();
+  return result;
+}
+
+// Processing the subtree given by the cube [b,e) (the decisions before the
+// last one are only replayed, without statistics):
+DLL_return_t dll_cube(const Lit* const b, const Lit* const e) {
+  assert(b != e);
+  if (e - b == 1) return dll(*b);
+  changes.start_new();
+  const Unit_stack unit_stack;
+  Unit_stack::push(*b);
+  assign_0(Unit_stack::pop());
+  while (unit_stack) {
+    [[maybe_unused]] const bool contr = push_unit_clause.contradiction();
+    assert(not contr);
+    assign_0(Unit_stack::pop());
+  }
+  changes.start_new();
+  for (const Lit y : unit_stack) assign_1(y);
+  assert(r_clauses);
+  const DLL_return_t result = dll_cube(b+1, e);
+#ifndef ALL_SOLUTIONS
+  if (result) return true;
+#endif
+  changes.reactivate_1();
+  changes.reactivate_0();
+  return result;
+}
+
+// The clauses and literal-occurrences of the main thread:
+const Clause_vec* main_clauses;
+const LiteralOccurrences* main_lits;
+// Copying them to the current thread (the literal-arrays are shared):
+void copy_formula() {
+  clauses.cl = *main_clauses;
+#ifdef COMPACT_CLAUSES
+  clause_base = clauses.cl.data();
+#endif
+  lits.copy(*main_lits, *main_clauses, clauses.cl);
+  r_clauses = n_clauses;
+}
+
+// The results of a thread (to be added to those of the main thread):
+struct Statistics {
+  DLL_return_t result;
+  Count_statistics nodes, backtracks, units, evaluations,
+    proj, proj2zero, proj1zero, nofirst, withfirst, nosecond, withsecond;
+  Weight_t sumf, sums, sumsqf, sumsqs, minf, mins, maxf, maxs;
+#ifdef TAU_ITERATION
+  Count_statistics wtau, tau_it;
+#endif
+#ifdef ALL_SOLUTIONS
+  Count_solutions solutions;
+#endif
+#ifdef VAR_MARGINALS
+  VarMarginals marg;
+#endif
+};
+Statistics thread_statistics(const DLL_return_t result) {
+  return {result, n_nodes, n_backtracks, n_units, n_evaluations,
+      n_proj, n_proj2zero, n_proj1zero,
+      n_nofirst, n_withfirst, n_nosecond, n_withsecond,
+      sum_first, sum_second, sumsq_first, sumsq_second,
+      min_first, min_second, max_first, max_second
+#ifdef TAU_ITERATION
+      , wtau_calls, tau_iterations
+#endif
+#ifdef ALL_SOLUTIONS
+      , n_solutions
+#endif
+#ifdef VAR_MARGINALS
+      , marginals
+#endif
+  };
+}
+void add_statistics(const Statistics& S) {
+  n_nodes += S.nodes; n_backtracks += S.backtracks; n_units += S.units;
+  n_evaluations += S.evaluations;
+  n_proj += S.proj; n_proj2zero += S.proj2zero; n_proj1zero += S.proj1zero;
+  n_nofirst += S.nofirst; n_withfirst += S.withfirst;
+  n_nosecond += S.nosecond; n_withsecond += S.withsecond;
+  sum_first += S.sumf; sum_second += S.sums;
+  sumsq_first += S.sumsqf; sumsq_second += S.sumsqs;
+  min_first = std::min(min_first, S.minf);
+  min_second = std::min(min_second, S.mins);
+  max_first = std::max(max_first, S.maxf);
+  max_second = std::max(max_second, S.maxs);
+#ifdef TAU_ITERATION
+  wtau_calls += S.wtau; tau_iterations += S.tau_it;
+#endif
+#ifdef ALL_SOLUTIONS
+  n_solutions += S.solutions;
+#endif
+#ifdef VAR_MARGINALS
+  for (Var i=1; i <= n_vars; ++i) marginals[i] += S.marg[i];
+#endif
+}
+
+/* Distribution of the cubes: each thread has its own range of cube-indices,
+   initially consecutive blocks of the same size; a thread with empty range
+   steals the upper half of the range of another thread.
+*/
+class CubeQueues {
+  struct Range {
+    std::mutex m;
+    Cube_index b, e;
+  };
+  std::vector<Range> ranges;
+  typedef std::lock_guard<std::mutex> lock_t;
+public :
+  CubeQueues(const Thread_index T, const Cube_index N) : ranges(T) {
+    assert(T >= 1);
+    for (Thread_index i = 0; i < T; ++i) {
+      ranges[i].b = (N * i) / T; ranges[i].e = (N * (i+1)) / T;
+    }
+  }
+  // Sets c to the next cube for thread i, returning false iff nothing left:
+  bool next(const Thread_index i, Cube_index& c) {
+    Range& own = ranges[i];
+    {const lock_t l(own.m);
+     if (own.b != own.e) { c = own.b++; return true; }
+    }
+    const Thread_index T = ranges.size();
+    for (Thread_index j = 1; j < T; ++j) {
+      Range& other = ranges[(i+j) % T];
+      Cube_index b, e;
+      {const lock_t l(other.m);
+       if (other.b == other.e) continue;
+       b = other.b + (other.e - other.b) / 2; e = other.e;
+       other.e = b;
+      }
+      c = b;
+      const lock_t l(own.m);
+      own.b = b+1; own.e = e;
+      return true;
+    }
+    return false;
+  }
+};
+
+void worker(const Thread_index i, CubeQueues& Q, Statistics& S) {
+  {sigset_t sigs; sigfillset(&sigs);
+   pthread_sigmask(SIG_BLOCK, &sigs, nullptr);
+  }
+  try { copy_formula(); thread_initialisation(); }
+  catch (const std::bad_alloc&) {
+    errout << "Allocation error with initialisation of data structures for"
+      " thread " << i << ".";
+    std::exit(allocation_error);
+  }
+  DLL_return_t result = false;
+  Cube_index c;
+  while (Q.next(i, c)) {
+    const Lit_vec& C = cubes[c];
+    result = dll_cube(C.data(), C.data() + C.size()) or result;
+#ifndef ALL_SOLUTIONS
+    if (result) break;
+#endif
+  }
+  S = thread_statistics(result);
+}
+
+// Splitting the root (branching on x), and solving the cubes in parallel:
+DLL_return_t dll_par(const Lit x) {
+  assert(split_depth >= 1);
+  const DLL_return_t res0 = branch_split(x);
+#ifndef ALL_SOLUTIONS
+  if (res0) return true;
+#endif
+  if (cubes.empty()) return res0;
+  main_clauses = &clauses.cl; main_lits = &lits;
+  const Thread_index T = std::min(Cube_index(n_threads), cubes.size());
+  CubeQueues Q(T, cubes.size());
+  std::vector<Statistics> stats(T);
+  std::vector<std::thread> threads; threads.reserve(T);
+  for (Thread_index i = 0; i < T; ++i)
+    threads.emplace_back(worker, i, std::ref(Q), std::ref(stats[i]));
+  for (auto& t : threads) t.join();
+  DLL_return_t result = res0;
+  for (const Statistics& S : stats) {
+    add_statistics(S);
+    result = result or S.result;
+  }
   return result;
 }
 
+#endif
+
 DLL_return_t dll0() { // without unit-clauses
   ++n_nodes;
 #ifdef ALL_SOLUTIONS
@@ -1707,7 +2785,10 @@ DLL_return_t dll0() { // without unit-clauses
 #ifdef PURE_LITERALS
   if (not r_clauses) {sat_pass = pass; return true;}
 #endif
-  const DLL_return_t res1 = dll(x);
+#ifdef PARALLEL
+  if (split_depth != 0) return dll_par(x);
+#endif
+  const DLL_return_t res1 = first_branch(x);
 #ifndef ALL_SOLUTIONS
   if (res1) return true;
 #endif
@@ -1719,7 +2800,6 @@ DLL_return_t dll0() { // without unit-clauses
 #endif
 }
 
-
 // --- Output ---
 
 void show_usage() {
@@ -1743,45 +2823,24 @@ void show_usage() {
     "> " << program << " In Out Out\n"
     "the input comes from file In, and both statistics and assignments are appended to Out "
 #ifndef ALL_SOLUTIONS
-      "(first the statistics).\n";
+      "(first the statistics).\n"
 #else
-      "(first the solutions).\n";
+      "(first the solutions).\n"
 #endif
+#ifdef PARALLEL
+    "> " << program << " (-cin | filename) (-cout | -cerr | filename2 | -nil) (-cout | -cerr | filename3 | -nil) T [D]\n"
+    " uses T threads (T=0 means the number of hardware threads) and splitting-depth D\n"
+    " (default ceil(log_2(T)) + " << split_surplus << "; D=0 means no splitting).\n"
+#else
+    "> " << program << " (-cin | filename) (-cout | -cerr | filename2 | -nil) (-cout | -cerr | filename3 | -nil) (checkpoint | -nil) [P] [-resume]\n"
+    " writes checkpoints to file checkpoint on SIGUSR2, on SIGTERM (then aborting),\n"
+    " and every P seconds (default P=0 means never); with -resume the computation\n"
+    " continues from the checkpoint in file checkpoint.\n"
+#endif
+    ;
   std::exit(0);
 }
 
-#define S(x) #x
-#define STR(x) S(x)
-
-const std::string options = ""
-#if UCP_STRATEGY == 0
-"B"
-#endif
-#ifdef PURE_LITERALS
-"P"
-#endif
-#ifdef TAU_ITERATION
-"T"
-#endif
-#ifdef FIRST_VARIABLE
-"fv"
-#endif
-#ifdef ALL_SOLUTIONS
-# ifdef VAR_MARGINALS
-"M"
-# else
-"A"
-# endif
-    + std::string(floating_count ? "F" : "") + std::to_string(count_digits)
-#endif
-#ifdef LAMBDA
-    + std::string("L" STR(LAMBDA))
-#endif
-#ifdef ALPHA
-    + std::string("AL" STR(ALPHA))
-#endif
-;
-
 void version_information() {
   std::cout << "Program name = " << program << ":\n"
    " authors: Tanbir Ahmed and Oliver Kullmann\n"
@@ -1823,6 +2882,12 @@ void version_information() {
 #ifdef FIRST_VARIABLE
    " Compiled with FIRST_VARIABLE\n"
 #endif
+#ifdef PARALLEL
+   " Compiled with PARALLEL\n"
+#endif
+#ifdef COMPACT_CLAUSES
+   " Compiled with COMPACT_CLAUSES\n"
+#endif
 #ifdef LAMBDA
    " Compiled with LAMBDA=" STR(LAMBDA) "\n"
 #endif
@@ -1947,6 +3012,11 @@ if (logout.active()) {
          "c   system_time                         " << elapsed[1] << "\n"
          "c   elapsed_wall_clock                  " << diff_t(current-t1W).count() << "\n"
          "c   max_memory(MB)                      " << timing.mem() << "\n"
+#ifdef PARALLEL
+         "c number_threads                        " << n_threads << "\n"
+         "c   splitting_depth                     " << split_depth << "\n"
+         "c   number_cubes                        " << cubes.size() << "\n"
+#endif
          "c number_of_nodes                       " << n_nodes << "\n"
          "c   number_of_binary_nodes              " << n_backtracks << "\n"
          "c   number_of_single_child_nodes        " << single_child << "\n"
@@ -2066,6 +3136,68 @@ void set_output(const int argc, const char* const argv[]) {
   }
 }
 
+#ifdef PARALLEL
+// Setting n_threads and split_depth from arguments 4, 5:
+void set_parallelism(const int argc, const char* const argv[]) {
+  const auto read = [](const std::string& arg, const char* const name) {
+    unsigned long res;
+    std::size_t pos;
+    try { res = std::stoul(arg, &pos); }
+    catch (const std::exception&) { pos = 0; }
+    if (pos == 0 or pos != arg.size() or res >= max_lit) {
+      errout << ("Invalid " + std::string(name) + ": \"" + arg + "\".");
+      std::exit(parameter_error);
+    }
+    return res;
+  };
+  n_threads = argc >= 5 ? read(argv[4], "number of threads") : 0;
+  if (n_threads == 0) n_threads = std::thread::hardware_concurrency();
+  if (n_threads == 0) n_threads = 1;
+  if (argc >= 6) split_depth = read(argv[5], "splitting-depth");
+  else {
+    Var log2 = 0;
+    while ((Thread_index(1) << log2) < n_threads) ++log2;
+    split_depth = log2 + split_surplus;
+  }
+}
+#endif
+
+#ifdef CHECKPOINTING
+// Setting checkpoint_file, checkpoint_period and resume from arguments
+// 4, 5, 6:
+void set_checkpointing(const int argc, const char* const argv[]) {
+  if (argc < 5) return;
+  const std::string name(argv[4]);
+  if (name == "-nil") return;
+  if (name == filename or name == argv[2] or name == argv[3] or
+      name.empty() or name.front() == '-') {
+    errout << ("Invalid checkpoint-filename: \"" + name + "\".");
+    std::exit(parameter_error);
+  }
+  checkpoint_file = name;
+  if (argc >= 6) {
+    const std::string arg(argv[5]);
+    std::size_t pos;
+    unsigned long res;
+    try { res = std::stoul(arg, &pos); }
+    catch (const std::exception&) { pos = 0; }
+    if (pos == 0 or pos != arg.size() or
+        res > std::numeric_limits<unsigned>::max()) {
+      errout << ("Invalid checkpoint-period: \"" + arg + "\".");
+      std::exit(parameter_error);
+    }
+    checkpoint_period = res;
+  }
+  if (argc >= 7) {
+    if (std::string(argv[6]) != "-resume") {
+      errout << ("Invalid argument6: \"" + std::string(argv[6]) + "\".");
+      std::exit(parameter_error);
+    }
+    resume = true;
+  }
+}
+#endif
+
 void abortion(const int) {
   std::signal(SIGINT, abortion);
   output(unknown);
@@ -2075,6 +3207,25 @@ void show_statistics(const int) {
   signal(SIGUSR1, show_statistics);
   output(unknown);
 }
+#ifdef CHECKPOINTING
+void request_checkpoint(const int sig) {
+  signal(sig, request_checkpoint);
+  if (sig == SIGTERM) checkpoint_request = 2;
+  else if (checkpoint_request == 0) checkpoint_request = 1;
+}
+void start_checkpointing() {
+  if (checkpoint_file.empty()) return;
+  decisions.reserve(max_occ_var + 1);
+  if (resume) read_checkpoint();
+  std::signal(SIGUSR2, request_checkpoint);
+  std::signal(SIGTERM, request_checkpoint);
+  if (checkpoint_period != 0) {
+    std::signal(SIGALRM, request_checkpoint);
+    const itimerval period{{checkpoint_period, 0}, {checkpoint_period, 0}};
+    setitimer(ITIMER_REAL, &period, nullptr);
+  }
+}
+#endif
 
 } // anonymous namespace
 
@@ -2084,6 +3235,11 @@ int main(const int argc, const char* const argv[]) {
   if (filename == "-v" or filename == "--version") version_information();
 
   set_output(argc, argv);
+#ifdef PARALLEL
+  set_parallelism(argc, argv);
+#else
+  set_checkpointing(argc, argv);
+#endif
 
   t0W = std::chrono::high_resolution_clock::now();
   t0 = timing();
@@ -2098,9 +3254,18 @@ int main(const int argc, const char* const argv[]) {
   }
   std::signal(SIGINT, abortion);
   std::signal(SIGUSR1, show_statistics);
+#ifdef CHECKPOINTING
+  start_checkpointing();
+#endif
   t1 = timing();
   t1W = std::chrono::high_resolution_clock::now();
   const auto result = dll0();
+#ifdef CHECKPOINTING
+  if (replay) {
+    errout << "Checkpoint does not fit: node of checkpoint not reached.";
+    return checkpoint_error;
+  }
+#endif
   const auto ires = interprete_run(result);
   output(ires);
   return ires;
@@ -1,5 +1,5 @@
 // Oliver Kullmann, 25.2.2022 (Swansea)
-/* Copyright 2022, 2023 Oliver Kullmann
+/* Copyright 2022, 2023, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -377,8 +377,8 @@ See plans/general.txt.
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "1.3.1",
-        "21.6.2023",
+        "1.4.0",
+        "16.10.2026",
         __FILE__,
         "Oliver Kullmann",
         "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/Bicliques/BCC2SAT.cpp",
@@ -403,6 +403,7 @@ namespace {
     " format-options : " << Environment::WRP<DC>{} << "\n"
     "                : " << Environment::WRP<DP>{} << "\n"
     "                : " << Environment::WRP<CS>{} << "\n"
+    "                : " << Environment::WRP<DW>{} << "\n"
     " sb-rounds      : " << "default is " << default_sb_rounds << "\n"
     " seeds          : " << "sequence, can contain \"t\" or \"r\"\n\n"
     " reads a graph from standard input, and prints the SAT-translation"
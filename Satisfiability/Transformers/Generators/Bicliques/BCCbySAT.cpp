@@ -290,6 +290,46 @@ B sat maxn   c ptime stime elimc rts   cfs  cfsps   dec decpr  decps     r1
 4   0  116 544     0     0     0  30 6272 293386 7541     0 352746 137153 6.41561e+06 56596    27  25 0.021378
 
 
+Using the internal incremental solver (tawSolver-algorithm), which avoids
+the creation of files and processes, by translating only once and then
+using assumptions for deactivating bicliques:
+Bicliques> ./GraphGen clique 8 | ./BCCbySAT 5 incr "" "" "" "" ST ""
+# "./BCCbySAT" "5" "incr" "" "" "" "" "ST" ""
+# ** Parameters **
+# B                                     downwards 0 5
+# sb-options                            basic-sb with-ssb
+# pt-option                             cover
+# di-option                             downwards
+# so-option                             incremental-internal
+# comments-option                       with-comments
+# bicliques-option                      with-solution
+# solver-timeout(s)                     2147483647
+# sb-rounds                             100
+# num_e-seeds                           0
+# statistics-output                     ST
+# log-output                            null
+# ** Results **
+# sb-stats                              100 : 1 1 1; 0
+# result-type                           exact
+# bcc                                   = 3
+1 2 3 6 | 4 5 7 8
+2 3 5 7 | 1 4 6 8
+1 3 4 7 | 2 5 6 8
+Bicliques> cat ST
+B sat maxn   c   ptime stime elimc rts cfs  cfsps dec decpr  decps   r1        r1ps cfl cflpd mem        t
+4   1  180 847 6.9e-05     0     0   0   0      0  31     0 310000  144    1.44e+06   0     0   0   0.0001
+2   0  180 847       0     0     0   0 145 427729 145     0 427729 1864 5.49853e+06   0     0   0 0.000339
+
+The statistics then contains as "cfs" the number of backtracks of the
+solver, as "dec" the number of branchings, and as "r1" the number of
+unit-propagations, while "ptime" is the time for creating the
+translation (all other measurements not available are zero).
+The numbers of variables and clauses are those for the largest B (plus
+the activation-variables resp. -clauses).
+The solver does not use clause-learning, and so for harder unsatisfiable
+instances (e.g. already clique 12) minisat is much faster.
+
+
 Remarks on logging:
 
 If a log-file is given (or /dev/stdout used), then the (complete) minisat-
@@ -316,8 +356,8 @@ See plans/general.txt.
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.11.0",
-        "24.5.2023",
+        "0.12.0",
+        "16.10.2026",
         __FILE__,
         "Oliver Kullmann",
         "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/Bicliques/BCCbySAT.cpp",
@@ -355,7 +395,9 @@ namespace {
     "  - Using \"+\" for B means the increment added to the lower-bound.\n"
     "  - Default-values for the options are the first possibilities given.\n"
     "  - For stats the special value \"t\" creates an automatic name (with timestamp).\n"
-    "  - By using \"/dev/stdout\" for stats/log the output goes to standard output.\n\n"
+    "  - By using \"/dev/stdout\" for stats/log the output goes to standard output.\n"
+    "  - The solver-option \"incr\" uses the internal incremental solver\n"
+    "    (without timeout).\n\n"
 ;
     return true;
   }
@@ -1,5 +1,5 @@
 // Oliver Kullmann, 28.2.2022 (Swansea)
-/* Copyright 2022, 2023 Oliver Kullmann
+/* Copyright 2022, 2023, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -33,6 +33,8 @@ License, or any later version. */
    - disjoint(bc_frame) (whether the two sides are disjoint)
    - is_star(idv_t, list_t, AdjVecUInt)
    - is_bc(bc_frame, AdjVecUInt)
+   - is_bc(bc_frame, AdjMatUInt) (the smaller side is checked against the
+     bitset of the other side)
    - covers(bc_frame, idv_t, idv_t)
 
 
@@ -44,8 +46,14 @@ License, or any later version. */
    - valid2(Bcc_frame), valid(Bcc_frame, AdjVecUInt)
    - disjoint(Bcc_frame) (whether all bicliques are disjoint)
    - is_bc(Bcc_frame, AdjVecUInt)
+   - is_bc(Bcc_frame, AdjMatUInt)
    - covers(Bcc_frame, idv_t, idv_t)
    - is_cover(Bcc_frame, AdjVecUInt)
+   - is_cover(Bcc_frame, AdjMatUInt) (via the bitset-matrix of covered
+     edges)
+   - is_bc(Bcc_frame, AdjVecUInt) and is_cover(Bcc_frame, AdjVecUInt)
+     dispatch to the AdjMatUInt-versions if Graphs::dense_suitable(G) and
+     numocc(B) >= n (so that the construction of the matrix is amortised)
    - is_partition(Bcc_frame, AdjVecUInt)
    - is_bcc(Bcc_frame, AdjVecUInt)
    - is_bcp(Bcc_frame, AdjVecUInt)
@@ -70,13 +78,16 @@ License, or any later version. */
 
    The biclique-compatibility graph:
 
-   - bccomp(edge_t, edge_t, AdjVecUInt) (whether two edges can be in the same
-     biclique)
+   - bccomp(edge_t, edge_t, GRAPH) (whether two edges can be in the same
+     biclique; GRAPH is AdjVecUInt or AdjMatUInt)
 
+   - bccomp_adjlist(GRAPH, vecedges_t) -> adjlist_t
    - bccomp_graph_bydef(AdjVecUInt, vecedges_t) -> AdjVecUInt
      bccomp_graph_bydef(AdjVecUInt) -> AdjVecUInt
-   - num_edges_bccomp_graph_bydef(AdjVecUInt, vecedges_t) -> idv_t
+   - num_edges_bccomp_graph_bydef(GRAPH, vecedges_t) -> idv_t
      num_edges_bccomp_graph_bydef(AdjVecUInt) -> idv_t
+     (bccomp_graph_bydef and num_edges_bccomp_graph_bydef(AdjVecUInt) use
+     AdjMatUInt if Graphs::dense_suitable)
 
      computing the neighbours of edge e:
 
@@ -137,6 +148,7 @@ namespace Bicliques {
   namespace DT = DimacsTools;
 
   typedef Graphs::AdjVecUInt AdjVecUInt;
+  typedef Graphs::AdjMatUInt AdjMatUInt;
   typedef AdjVecUInt::id_t idv_t;
   typedef AdjVecUInt::list_t list_t;
   typedef AdjVecUInt::edge_t edge_t;
@@ -231,6 +243,15 @@ namespace Bicliques {
       return std::all_of(b.r.begin(), b.r.end(), test);
     }
   }
+  inline bool is_bc(const bc_frame& b, const AdjMatUInt& G) {
+    assert(G.type() == Graphs::GT::und);
+    const bool left = b.l.size() <= b.r.size();
+    const list_t& vs = left ? b.l : b.r;
+    if (vs.empty()) return true;
+    const auto S = AdjMatUInt::to_bitset(left ? b.r : b.l, G.n());
+    return std::ranges::all_of(vs,
+             [&G, &S](const idv_t v){return G.includes(v, S);});
+  }
   // Is {v,w} covered (v left or v right):
   inline bool covers(const bc_frame& b, const idv_t v, const idv_t w) noexcept {
     const auto lb = b.l.begin(); const auto le = b.l.end();
@@ -271,8 +292,18 @@ namespace Bicliques {
                        [&G](const bc_frame& b){return valid(b, G);});
   }
 
-  inline bool is_bc(const Bcc_frame& B, const AdjVecUInt& G) noexcept {
+  inline bool is_bc(const Bcc_frame& B, const AdjMatUInt& G) {
+    return std::ranges::all_of(B.L,
+                       [&G](const bc_frame& b){return is_bc(b, G);});
+  }
+  idv_t numocc(const Bcc_frame& B) noexcept;
+  // Whether the matrix for G is worth building for B:
+  inline bool dense_suitable(const Bcc_frame& B, const AdjVecUInt& G) {
+    return numocc(B) >= G.n() and Graphs::dense_suitable(G);
+  }
+  inline bool is_bc(const Bcc_frame& B, const AdjVecUInt& G) {
     assert(valid(B, G));
+    if (dense_suitable(B, G)) return is_bc(B, AdjMatUInt(G));
     return std::all_of(B.L.begin(), B.L.end(),
                        [&G](const bc_frame& b){return is_bc(b, G);});
   }
@@ -280,8 +311,17 @@ namespace Bicliques {
     return std::any_of(B.L.begin(), B.L.end(),
                        [v,w](const bc_frame& b){return covers(b,v,w);});
   }
-  inline bool is_cover(const Bcc_frame& B, const AdjVecUInt& G) noexcept {
+  inline bool is_cover(const Bcc_frame& B, const AdjMatUInt& G) {
+    assert(G.type() == Graphs::GT::und);
+    AdjMatUInt C(Graphs::GT::und, G.n());
+    for (const bc_frame& b : B.L) C.add_biclique(b.l, b.r);
+    for (idv_t v = 0; v < G.n(); ++v)
+      if (not AdjMatUInt::subset(G.row(v), C.row(v))) return false;
+    return true;
+  }
+  inline bool is_cover(const Bcc_frame& B, const AdjVecUInt& G) {
     assert(valid(B, G));
+    if (dense_suitable(B, G)) return is_cover(B, AdjMatUInt(G));
     const auto E = G.alledges();
     return std::all_of(E.begin(), E.end(),
                        [&B](const auto e){return covers(B,e.first,e.second);});
@@ -300,10 +340,10 @@ namespace Bicliques {
     }
     return true;
   }
-  inline bool is_bcc(const Bcc_frame& B, const AdjVecUInt& G) noexcept {
+  inline bool is_bcc(const Bcc_frame& B, const AdjVecUInt& G) {
     return is_bc(B, G) and is_cover(B, G);
   }
-  inline bool is_bcp(const Bcc_frame& B, const AdjVecUInt& G) noexcept {
+  inline bool is_bcp(const Bcc_frame& B, const AdjVecUInt& G) {
     return is_bc(B, G) and is_partition(B, G);
   }
 
@@ -433,8 +473,9 @@ namespace Bicliques {
 
   // Whether edges e1, e2 can be in the same biclique
   // ("biclique-compatibility"):
+  template <class GRAPH>
   inline bool bccomp(const edge_t e1, const edge_t e2,
-                     const AdjVecUInt& G) noexcept {
+                     const GRAPH& G) noexcept {
     const auto [a,b] = e1;
     const auto [c,d] = e2;
     if (c==a or c==b or d==a or d==b) return true;
@@ -445,6 +486,25 @@ namespace Bicliques {
 
   // The vertices are the edges of G in E (via their indices), with an
   // edge between them iff bccomp holds:
+  template <class GRAPH>
+  AdjVecUInt::adjlist_t bccomp_adjlist(const GRAPH& G, const vecedges_t& E) {
+    assert(G.type() == Graphs::GT::und);
+    const idv_t n = E.size();
+    AdjVecUInt::adjlist_t A(n);
+    if (n <= 1) return A;
+    for (idv_t i = 0; i < n-1; ++i) {
+      auto& row = A[i];
+      const edge_t& e1 = E[i];
+      for (idv_t j = i+1; j < n; ++j) {
+        const edge_t& e2 = E[j];
+        if (bccomp(e1, e2, G)) {
+          row.push_back(j);
+          A[j].push_back(i);
+        }
+      }
+    }
+    return A;
+  }
   AdjVecUInt bccomp_graph_bydef(const AdjVecUInt& G, const vecedges_t& E,
                                 const std::string& sep) {
     assert(G.type() == Graphs::GT::und);
@@ -452,20 +512,8 @@ namespace Bicliques {
     const idv_t n = E.size();
     AdjVecUInt res(Graphs::GT::und, n);
     if (n <= 1) return res;
-    {AdjVecUInt::adjlist_t A(n);
-     for (idv_t i = 0; i < n-1; ++i) {
-       auto& row = A[i];
-       const edge_t& e1 = E[i];
-       for (idv_t j = i+1; j < n; ++j) {
-         const edge_t& e2 = E[j];
-         if (bccomp(e1, e2, G)) {
-           row.push_back(j);
-           A[j].push_back(i);
-         }
-       }
-     }
-     res.set(std::move(A));
-    }
+    res.set(Graphs::dense_suitable(G) ?
+            bccomp_adjlist(AdjMatUInt(G), E) : bccomp_adjlist(G, E));
     if (not sep.empty()) {
       res.set_names();
       for (idv_t i = 0; i < E.size(); ++i) {
@@ -481,10 +529,10 @@ namespace Bicliques {
     return bccomp_graph_bydef(G, G.alledges(), sep);
   }
   // Just computing the number of edges:
-  idv_t num_edges_bccomp_graph_bydef(const AdjVecUInt& G,
+  template <class GRAPH>
+  idv_t num_edges_bccomp_graph_bydef(const GRAPH& G,
                                      const vecedges_t& E) noexcept {
     assert(G.type() == Graphs::GT::und);
-    assert(not has_loops(G));
     const idv_t n = E.size();
     if (n <= 1) return 0;
     idv_t res = 0;
@@ -496,7 +544,10 @@ namespace Bicliques {
     return res;
   }
   idv_t num_edges_bccomp_graph_bydef(const AdjVecUInt& G) {
-    return num_edges_bccomp_graph_bydef(G, G.alledges());
+    assert(not has_loops(G));
+    return Graphs::dense_suitable(G) ?
+      num_edges_bccomp_graph_bydef(AdjMatUInt(G), G.alledges()) :
+      num_edges_bccomp_graph_bydef(G, G.alledges());
   }
 
   // The sorted list of neighbours in bccomp-graph:
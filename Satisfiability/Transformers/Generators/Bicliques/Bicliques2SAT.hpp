@@ -1,5 +1,5 @@
 // Oliver Kullmann, 22.2.2022 (Swansea)
-/* Copyright 2022, 2023 Oliver Kullmann
+/* Copyright 2022, 2023, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -65,6 +65,7 @@ License, or any later version. */
      - DC (Dimacs-comments on/off)
      - DP (Dimacs-parameters on/off)
      - CS (clause-set-output on/off)
+     - DW (clause-output via ostream or via RandGen::DimacsOut)
      - DI (search direction)
      - SO (solver options)
 
@@ -75,6 +76,12 @@ License, or any later version. */
 
     - scoped enum ResultType
 
+    - the in-process incremental solver (SO::incr):
+     - struct TawSolver_put : wrapping a TawSolver::Solver as target for
+       the clause-translations (instead of a stream)
+     - tawsolver_stats(TawSolver::Statistics, ptime, ttime) -> Minisat_stats
+       (filling those minisat-columns which have a meaning for tawSolver)
+
     - class BC2SAT:
 
      - typedefs
@@ -162,6 +169,10 @@ License, or any later version. */
       - operator (ostream*, alg_options, rounds, sec, seeds)
         stores the Dimacs-files on disc, using the minisat_call, decrementing
         B until unsatisfiability reached.
+        With SO::incr instead the translation is done only once (for the
+        largest B possibly needed), into an in-process TawSolver::Solver,
+        with bicliques deactivated via assumptions (the timeout is not
+        applied here).
 
 
 See plans/general.txt.
@@ -186,6 +197,7 @@ See plans/general.txt.
 #include <algorithm>
 #include <map>
 #include <ios>
+#include <optional>
 
 #include <cstdint>
 #include <cassert>
@@ -197,6 +209,9 @@ See plans/general.txt.
 #include <Transformers/Generators/Random/Numbers.hpp>
 #include <Transformers/Generators/Random/Algorithms.hpp>
 #include <Transformers/Generators/Random/ClauseSets.hpp>
+#include <Transformers/Generators/Random/DimacsOutput.hpp>
+#include <SystemSpecifics/Timing.hpp>
+#include <Solvers/TawSolver/TawSolver.hpp>
 
 #include "Algorithms.hpp"
 #include "Graphs.hpp"
@@ -403,10 +418,11 @@ namespace Bicliques2SAT {
   enum class PT { cover=0, partition1=1, partition2=2 }; // problem type
   enum class DI { downwards=0, upwards=1, binary_search=2,
                   none=3 }; // search direction
-  enum class SO { none=0, nopre=1 }; // solver options
+  enum class SO { none=0, nopre=1, incr=2 }; // solver options
   enum class DC { with=0, without=1 }; // Dimacs-comments (or other comments)
   enum class DP { with=0, without=1 }; // Dimacs-parameters
   enum class CS { with=0, without=1 }; // clause-set
+  enum class DW { stream=0, buffered=1 }; // Dimacs-writer for the clauses
   enum class BC { with=0, without=1 }; // biclique-list (or other results)
 
   std::string solver_option(const SO so) {
@@ -417,7 +433,7 @@ namespace Bicliques2SAT {
   constexpr char sep = ',';
   typedef std::tuple<SB,SS,PT> alg_options_t;
   typedef std::tuple<SB,SS,PT,DI,SO> alg2_options_t;
-  typedef std::tuple<DC,DP,CS> format_options_t;
+  typedef std::tuple<DC,DP,CS,DW> format_options_t;
   typedef std::tuple<DC,BC> format2_options_t;
 
   constexpr id_t default_sb_rounds = 100;
@@ -460,6 +476,12 @@ namespace Environment {
     {"+trans", "-trans"};
   };
   template <>
+  struct RegistrationPolicies<Bicliques2SAT::DW> {
+    static constexpr int size = int(Bicliques2SAT::DW::buffered)+1;
+    static constexpr std::array<const char*, size> string
+    {"-buf", "+buf"};
+  };
+  template <>
   struct RegistrationPolicies<Bicliques2SAT::BC> {
     static constexpr int size = int(Bicliques2SAT::BC::without)+1;
     static constexpr std::array<const char*, size> string
@@ -473,9 +495,9 @@ namespace Environment {
   };
   template <>
   struct RegistrationPolicies<Bicliques2SAT::SO> {
-    static constexpr int size = int(Bicliques2SAT::SO::nopre)+1;
+    static constexpr int size = int(Bicliques2SAT::SO::incr)+1;
     static constexpr std::array<const char*, size> string
-    {"defsolve", "nopre"};
+    {"defsolve", "nopre", "incr"};
   };
 }
 namespace Bicliques2SAT {
@@ -519,6 +541,12 @@ namespace Bicliques2SAT {
     case CS::without : return out << "without-translation";
     default : return out << "CS::UNKNOWN";}
   }
+  std::ostream& operator <<(std::ostream& out, const DW w) {
+    switch (w) {
+    case DW::stream : return out << "stream-output";
+    case DW::buffered : return out << "buffered-output";
+    default : return out << "DW::UNKNOWN";}
+  }
   std::ostream& operator <<(std::ostream& out, const BC b) {
     switch (b) {
     case BC::with : return out << "with-solution";
@@ -537,6 +565,7 @@ namespace Bicliques2SAT {
     switch (s) {
     case SO::none : return out << "default-solver";
     case SO::nopre : return out << "-no-pre";
+    case SO::incr : return out << "incremental-internal";
     default : return out << "SO::UNKNOWN";}
   }
 
@@ -688,10 +717,69 @@ namespace Bicliques2SAT {
   };
 
 
+  /* Using the in-process TawSolver::Solver
+
+     For SO::incr the clauses are directly added to the solver (via
+     TawSolver_put as the STREAM-parameter of the clause-translations).
+
+     The statistics are presented as Minisat_stats (so that they can be
+     put into TableMinisatStats), with the following correspondences:
+      - num_var, num_cl : n, c (c excluding tautologies and unit-clauses)
+      - ptime : the time for adding the clauses
+      - conflicts : binary_nodes (the nodes where the first branch failed)
+      - decisions : evaluations (the calls of the branching-heuristic)
+      - propagations : units
+      - ttime : the time for solving.
+     The other measurements (simplification, restarts, learning, memory)
+     are zero.
+  */
+  struct TawSolver_put {
+    TawSolver::Solver& S;
+    TawSolver::clause_t C;
+    explicit TawSolver_put(TawSolver::Solver& S) noexcept : S(S) {}
+    void add(const RandGen::Clause& D) {
+      C.clear();
+      for (const RandGen::Lit x : D) {
+        assert(x.v.v <= std::numeric_limits<TawSolver::lit_t>::max());
+        C.push_back(x.convert());
+      }
+      S.add_clause(C);
+    }
+    friend TawSolver_put& operator <<(TawSolver_put& out,
+                                      const RandGen::ClauseList& F) {
+      for (const auto& D : F) out.add(D);
+      return out;
+    }
+  };
+
+  DimacsTools::Minisat_stats
+  tawsolver_stats(const TawSolver::Statistics& s,
+                  const FloatingPoint::float80 ptime,
+                  const FloatingPoint::float80 ttime) noexcept {
+    typedef FloatingPoint::float80 f_t;
+    const auto ps = [ttime](const f_t x) noexcept -> f_t {
+      return ttime == 0 ? 0 : x / ttime;
+    };
+    const f_t conflicts = s.binary_nodes, decisions = s.evaluations,
+      propagations = s.units;
+    return {s.result == TawSolver::Result::sat ?
+              DimacsTools::SolverR::sat : DimacsTools::SolverR::unsat,
+            {f_t(s.n), f_t(s.c), ptime, 0, 0,
+             0, conflicts, ps(conflicts),
+             decisions, 0, ps(decisions),
+             propagations, ps(propagations),
+             0, 0,
+             0, ttime}};
+  }
+
+
   struct BC2SAT {
     typedef Graphs::AdjVecUInt graph_t;
     const graph_t& G;
     const graph_t::vecedges_t edges; // vector of pairs of id_t's
+    // The bitset-matrix of G, if Graphs::dense_suitable(G), for the
+    // adjacency-queries of the symmetry-breaking:
+    const std::optional<Graphs::AdjMatUInt> dense;
     Bounds bounds;
 
     typedef VarEncoding enc_t;
@@ -699,8 +787,11 @@ namespace Bicliques2SAT {
     static_assert(std::is_same_v<id_t, graph_t::id_t>);
     static_assert(std::is_same_v<id_t, std::uint64_t>);
 
-    explicit BC2SAT(const graph_t& G, Bounds b) noexcept :
-      G(G), edges(G.alledges()), bounds(b,G), enc_(G,bounds.next()) {}
+    explicit BC2SAT(const graph_t& G, Bounds b) :
+      G(G), edges(G.alledges()),
+      dense(Graphs::dense_suitable(G) ?
+            std::optional<Graphs::AdjMatUInt>(G) : std::nullopt),
+      bounds(b,G), enc_(G,bounds.next()) {}
 
 
     const enc_t& enc() const noexcept { return enc_; }
@@ -715,7 +806,8 @@ namespace Bicliques2SAT {
     // edge is left:
     typedef std::vector<id_t> vei_t; // vector of edge-indices
     bool bccomp(const id_t i, const id_t j) const noexcept {
-      return Bicliques::bccomp(edges[i],edges[j], G);
+      return dense ? Bicliques::bccomp(edges[i],edges[j], *dense) :
+        Bicliques::bccomp(edges[i],edges[j], G);
     }
     bool is_bcincomp(const vei_t& v) const noexcept {
       return Algorithms::is_independent(v, [this](id_t i, id_t j)
@@ -890,7 +982,9 @@ namespace Bicliques2SAT {
                                         const SS ssb) const {
       assert(rounds < id_t(-1));
       if (rounds == 0 or enc_.E == 0) return {};
-      const graph_t BG = Bicliques::bccomp_graph_bydef(G, edges, "");
+      graph_t BG(Graphs::GT::und, enc_.E);
+      BG.set(dense ? Bicliques::bccomp_adjlist(*dense, edges) :
+                     Bicliques::bccomp_adjlist(G, edges));
       if (rounds == 1) {
         symmbreak_res_t res;
         res.v = std::get<0>(Graphs::perform_trials(BG, seeds, 1));
@@ -1232,6 +1326,7 @@ namespace Bicliques2SAT {
       const DC dc = std::get<DC>(fo);
       const DP dp = std::get<DP>(fo);
       const CS cs = std::get<CS>(fo);
+      const DW dw = std::get<DW>(fo);
 
       using Environment::DWW; using Environment::DHW;
       if (dc == DC::with) {
@@ -1243,6 +1338,8 @@ namespace Bicliques2SAT {
           DWW{"comments-option"} << dc << "\n" <<
           DWW{"dimacs-parameter-option"} << dp << "\n" <<
           DWW{"clauses-option"} << cs << "\n";
+        if (dw == DW::buffered)
+          out << DWW{"writer-option"} << dw << "\n";
         if (sb != SB::none) {
           out <<
             DWW{"sb-rounds"} << sb_rounds << "\n" <<
@@ -1303,7 +1400,14 @@ namespace Bicliques2SAT {
       }
 
       if (dp == DP::with) out << res;
-      if (cs == CS::with) all_clauses<std::ostream&>(sbr.v, sbr.sv, pt, out);
+      if (cs == CS::with) {
+        if (dw == DW::buffered) {
+          RandGen::DimacsOut dout(out);
+          all_clauses<RandGen::DimacsOut&>(sbr.v, sbr.sv, pt, dout);
+          dout.flush();
+        }
+        else all_clauses<std::ostream&>(sbr.v, sbr.sv, pt, out);
+      }
       return res;
     }
 
@@ -1388,11 +1492,29 @@ namespace Bicliques2SAT {
         return res;
       }
 
-      const std::string filename_head = SystemCalls::system_filename(
-        "Bicliques2SAT_" + Environment::CurrentTime::timestamp_str())
-        + "_";
+      const SO so = std::get<SO>(ao);
       const std::string solver_options = "-cpu-lim=" + std::to_string(sec)
-        + solver_option(std::get<SO>(ao));
+        + solver_option(so);
+
+      // For SO::incr: the translation for the maximal B, with activation-
+      // variables act0+b for the bicliques b (deactivated by assumptions):
+      TawSolver::Solver S;
+      Timing::UserTime timing;
+      FloatingPoint::float80 ptime = 0;
+      var_t act0 = 0;
+      const id_t maxB = bounds.ub() - 1;
+      if (so == SO::incr) {
+        assert(bounds.next() <= maxB);
+        const auto t0 = timing();
+        update_B(maxB);
+        act0 = enc_.n() + 1;
+        TawSolver_put put(S);
+        all_clauses<TawSolver_put&>(sbr.v, sbr.restrict_sv(maxB), pt, put);
+        for (id_t b = 0; b < maxB; ++b)
+          for (id_t e = 0; e < enc_.E; ++e)
+            put.add({-Lit(enc_.edge(e,b)), Lit(act0+b)});
+        ptime = timing() - t0;
+      }
 
       while (true) { // main solver-loop
         assert(bounds.open());
@@ -1401,35 +1523,60 @@ namespace Bicliques2SAT {
          res.B = nc; // so that in case of error the last B-value is available
         }
 
-        const auto inp = [this, &sbr, pt](std::FILE* const fp){
-          using DimacsTools:: operator <<;
-          const auto sbsv = sbr.restrict_sv(enc_.B());
-          fp << all_dimacs(sbr.v, sbsv, pt);
-          all_clauses(sbr.v, sbsv, pt, fp);
-        };
-        const auto call_res = DimacsTools::minisat_call
-          (inp, enc_.lf, solver_options);
-        if (log) {
-          *log << "Minisat-call for B=" << res.B << ": " << call_res.stats
-               << call_res.rv.out << std::endl;
-        }
-
-        if (call_res.stats.sr == DimacsTools::SolverR::aborted) {
-          res.rt = ResultType::aborted;
-          return res;
+        DimacsTools::SolverR sr;
+        Clause pa;
+        if (so != SO::incr) {
+          const auto inp = [this, &sbr, pt](std::FILE* const fp){
+            using DimacsTools:: operator <<;
+            const auto sbsv = sbr.restrict_sv(enc_.B());
+            fp << all_dimacs(sbr.v, sbsv, pt);
+            all_clauses(sbr.v, sbsv, pt, fp);
+          };
+          const auto call_res = DimacsTools::minisat_call
+            (inp, enc_.lf, solver_options);
+          if (log) {
+            *log << "Minisat-call for B=" << res.B << ": " << call_res.stats
+                 << call_res.rv.out << std::endl;
+          }
+          sr = call_res.stats.sr;
+          if (sr == DimacsTools::SolverR::aborted) {
+            res.rt = ResultType::aborted;
+            return res;
+          }
+          else if (sr == DimacsTools::SolverR::unknown) {
+            res.rt = ResultType::other_timeout;
+            return res;
+          }
+          res.minisat_stats.add(call_res, {result_t::float_t(res.B)});
+          pa = call_res.pa;
         }
-        else if (call_res.stats.sr == DimacsTools::SolverR::unknown) {
-          res.rt = ResultType::other_timeout;
-          return res;
+        else {
+          TawSolver::clause_t assumptions;
+          assumptions.reserve(maxB - res.B);
+          for (id_t b = res.B; b < maxB; ++b)
+            assumptions.push_back(-TawSolver::lit_t(act0+b));
+          const auto t0 = timing();
+          const TawSolver::Statistics st = S.solve(assumptions);
+          const auto stats = tawsolver_stats(st, ptime, timing() - t0);
+          ptime = 0;
+          if (log) {
+            *log << "TawSolver-call for B=" << res.B << ": " << stats;
+          }
+          sr = stats.sr;
+          res.minisat_stats.add(stats, {result_t::float_t(res.B)});
+          if (sr == DimacsTools::SolverR::sat)
+            for (const TawSolver::lit_t x : S.solution()) {
+              const Lit y(x);
+              if (enc_.lf(y)) pa.push_back(y);
+            }
         }
-        res.minisat_stats.add(call_res, {result_t::float_t(res.B)});
 
-        if (call_res.stats.sr == DimacsTools::SolverR::unsat)
+        if (sr == DimacsTools::SolverR::unsat)
           bounds.update_if_unsat();
         else {
-          assert(call_res.stats.sr == DimacsTools::SolverR::sat);
+          assert(sr == DimacsTools::SolverR::sat);
           res.solution = true;
-          res.bcc = enc_.extract_bcc(call_res.pa);
+          res.bcc = enc_.extract_bcc(pa);
           const auto red = trim(res.bcc);
           if (log) {
             *log << "  Literal-Reduction by trimming: " << red << "\n"
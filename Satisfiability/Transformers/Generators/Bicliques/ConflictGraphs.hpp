@@ -1,5 +1,5 @@
 // Oliver Kullmann, 27.2.2022 (Swansea)
-/* Copyright 2022, 2023 Oliver Kullmann
+/* Copyright 2022, 2023, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -49,7 +49,11 @@ License, or any later version. */
 
      - struct VarStatistics for variable-statistics, constructed from AllOcc
      - conflictgraph(var_t c, AllOcc) -> AdjVecUInt
-         (works by adding bicliques)
+         (works by adding bicliques; dispatches to conflictgraph_dense
+         if Graphs::dense_suitable for the (upper bound of the) sum of the
+         list-lengths, otherwise conflictgraph_sparse)
+     - conflictgraph_sparse(var_t c, AllOcc) : sorting the lists
+     - conflictgraph_dense(var_t c, AllOcc) : via Graphs::AdjMatUInt
      - conflictgraph(indexlist_t, varlist_t, AllOcc) :
          more generally, for a list of clauses and variables
      - conflictgraph(DimacsClauseList) -> AdjVecUInt
@@ -302,7 +306,7 @@ namespace ConflictGraphs {
   };
 
 
-  Graphs::AdjVecUInt conflictgraph(const var_t c, const AllOcc& O) {
+  Graphs::AdjVecUInt conflictgraph_sparse(const var_t c, const AllOcc& O) {
     Graphs::AdjVecUInt G(Graphs::GT::und, c);
     if (c <= 1) return G;
     Graphs::AdjVecUInt::adjlist_t A(c);
@@ -320,6 +324,22 @@ namespace ConflictGraphs {
     assert(A.empty());
     return G;
   }
+  // The bicliques are added into the bitset-matrix, which is then read
+  // row-wise (no sorting and no removal of duplicates needed):
+  Graphs::AdjVecUInt conflictgraph_dense(const var_t c, const AllOcc& O) {
+    Graphs::AdjVecUInt G(Graphs::GT::und, c);
+    if (c <= 1) return G;
+    Graphs::AdjMatUInt M(Graphs::GT::und, c);
+    for (const OccVar& o : O.O) M.add_biclique(o[true], o[false]);
+    G.set(M.graph());
+    return G;
+  }
+  Graphs::AdjVecUInt conflictgraph(const var_t c, const AllOcc& O) {
+    size_t d = 0; // upper bound for the sum of the list-lengths
+    for (const OccVar& o : O.O) d += 2 * o.muldeg();
+    return Graphs::dense_suitable(c, d) ?
+      conflictgraph_dense(c, O) : conflictgraph_sparse(c, O);
+  }
   Graphs::AdjVecUInt conflictgraph(const DimacsClauseList& F) {
     return conflictgraph(F.first.c, allocc(F));
   }
@@ -240,6 +240,8 @@ License, or any later version. */
      - m : Minisat_measurements
      - constructor from SystemCalls::EReturnValue and bool "with_measurement"
        (the bool controls whether read_minisat_results is called)
+     - constructor from SolverR and Minisat_measurements (for solvers
+       not called via the system)
      - operator << returns on first line sr and on second line m
 
     - class Minisat_return (the full data):
@@ -254,6 +256,7 @@ License, or any later version. */
     - class TableMinisatStats for storing and formatted output of a table
       of minisat-results
       - member add(Minisat_return, parameter-list)
+      - member add(Minisat_stats, parameter-list)
 
     - const strings input_filename, output_filename, minisat_string
 
@@ -1185,6 +1188,8 @@ namespace DimacsTools {
       sr(extract_ret(rv.rv)),
       m(with_measurement ?
         read_minisat_results(rv.out) : Minisat_measurements{}) {}
+    Minisat_stats(const SolverR sr, const Minisat_measurements& m) noexcept :
+      sr(sr), m(m) {}
 
     friend std::ostream& operator <<(std::ostream& out,
                                      const Minisat_stats& s) {
@@ -1252,9 +1257,12 @@ namespace DimacsTools {
     const params_vec_t& params() const noexcept { return paramsvec; }
 
     void add(const Minisat_return& mr, params_t p) {
+      add(mr.stats, std::move(p));
+    }
+    void add(const Minisat_stats& s, params_t p) {
       assert(p.size() == params_header.size()-1);
-      statsvec.push_back(mr.stats);
-      p.push_back(code(mr.stats.sr));
+      statsvec.push_back(s);
+      p.push_back(code(s.sr));
       paramsvec.push_back(p);
     }
 
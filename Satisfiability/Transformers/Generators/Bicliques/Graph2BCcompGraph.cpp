@@ -154,7 +154,7 @@ int main(const int argc, const char* const argv[]) {
   }
 
   const auto formopt =
-    Environment::translate<format_options_t>()(argv[1], ',');
+    Environment::translate<std::tuple<DC,DP,CS>>()(argv[1], ',');
   const auto [comments, parameters, translation] = formopt;
   const std::string sep = argv[2];
   const bool graph_input = argc == 3;
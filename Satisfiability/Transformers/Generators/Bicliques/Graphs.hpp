@@ -1,5 +1,5 @@
 // Oliver Kullmann, 20.2.2022 (Swansea)
-/* Copyright 2022, 2023 Oliver Kullmann
+/* Copyright 2022, 2023, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -156,6 +156,49 @@ License, or any later version. */
 
     - output_matrix(AdjVecUInt, ostream)
 
+
+   - class AdjMatUInt: the adjacency-matrix as dense bitsets, for algorithms
+     dominated by adjacency-queries and neighbourhood-intersections
+
+    - every vertex has a row of words() many 64-bit words (the bits for
+      vertices >= n() are always 0); memory n() * words() * 8 bytes
+    - constructed from AdjVecUInt (explicit), or via AdjMatUInt(GT, n) as
+      empty graph, extended by add_biclique(RAN V1, RAN V2)
+
+    - typedefs:
+     - id_t, size_t, list_t, adjlist_t as for AdjVecUInt
+     - word_t (uint64_t), wordvec_t (vector of word_t)
+     - row_t (span of const word_t)
+
+    - static helper-functions (the kernels; all simple loops over the
+      words, using std::popcount, which with -march=native are compiled
+      to POPCNT resp. vectorised (AVX2) code):
+     - num_words(n), bytes(n) (memory needed)
+     - bit(id_t) -> word_t
+     - count(row_t) -> size_t
+     - count_and(row_t, row_t) -> size_t
+     - subset(row_t, row_t) -> bool
+     - to_list(row_t) -> list_t (sorted)
+     - to_bitset(list_t, n) -> wordvec_t
+
+    - graph access:
+     - type(), n(), words()
+     - num_edges() -> size_t (computed)
+     - row(id_t) -> row_t
+     - adjacent(id_t, id_t) -> bool
+     - degree(id_t) -> id_t
+     - common(id_t, id_t) -> size_t (number of common neighbours)
+     - includes(id_t v, row_t S) -> bool (S subset of the neighbours of v)
+     - neighbours(id_t) -> list_t
+     - graph() -> adjlist_t
+     - == (ignores nothing)
+
+    - dense_suitable(n, d, max_bytes) -> bool : whether for n vertices and
+      sum d of the list-lengths the matrix should be used (d*64 >= n^2,
+      so that the lists use at least as much memory as the matrix, and
+      bytes(n) <= max_bytes (default dense_max_bytes = 2^31))
+      dense_suitable(AdjVecUInt) -> bool
+
     - independent sets:
 
      - is_independent(RAN r, AdjVecUInt) -> bool
@@ -190,6 +233,8 @@ TODOS:
 #include <algorithm>
 #include <iterator>
 #include <stack>
+#include <span>
+#include <bit>
 
 #include <cassert>
 #include <cstdint>
@@ -950,6 +995,160 @@ namespace Graphs {
   // ********************************************************************
 
 
+  // Adjacency-matrix, as dense bitsets (no names):
+  struct AdjMatUInt {
+    typedef AdjVecUInt::id_t id_t;
+    typedef AdjVecUInt::size_t size_t;
+    typedef AdjVecUInt::list_t list_t;
+    typedef AdjVecUInt::adjlist_t adjlist_t;
+
+    typedef std::uint64_t word_t;
+    typedef std::vector<word_t> wordvec_t;
+    typedef std::span<const word_t> row_t;
+    static constexpr size_t word_bits = 64;
+
+    static constexpr size_t num_words(const size_t n) noexcept {
+      return n / word_bits + (n % word_bits != 0);
+    }
+    static constexpr size_t bytes(const size_t n) noexcept {
+      return n * num_words(n) * sizeof(word_t);
+    }
+    static constexpr word_t bit(const id_t v) noexcept {
+      return word_t(1) << (v % word_bits);
+    }
+
+    static size_t count(const row_t r) noexcept {
+      size_t res = 0;
+      for (const word_t x : r) res += std::popcount(x);
+      return res;
+    }
+    static size_t count_and(const row_t r1, const row_t r2) noexcept {
+      assert(r1.size() == r2.size());
+      const size_t w = r1.size();
+      size_t res = 0;
+      for (size_t i = 0; i < w; ++i) res += std::popcount(r1[i] & r2[i]);
+      return res;
+    }
+    // Whether r1 is a subset of r2:
+    static bool subset(const row_t r1, const row_t r2) noexcept {
+      assert(r1.size() == r2.size());
+      const size_t w = r1.size();
+      word_t diff = 0;
+      for (size_t i = 0; i < w; ++i) diff |= r1[i] & ~r2[i];
+      return diff == 0;
+    }
+    static list_t to_list(const row_t r) {
+      list_t res; res.reserve(count(r));
+      for (size_t i = 0; i < r.size(); ++i)
+        for (word_t x = r[i]; x != 0; x &= x-1)
+          res.push_back(i * word_bits + std::countr_zero(x));
+      return res;
+    }
+    static wordvec_t to_bitset(const list_t& L, const size_t n) {
+      wordvec_t res(num_words(n));
+      for (const id_t v : L) {
+        assert(v < n); res[v / word_bits] |= bit(v);
+      }
+      return res;
+    }
+
+  private :
+
+    const GT type_;
+    const size_t n_, w_;
+    wordvec_t M; // invariant: M.size() = n_ * w_
+
+    word_t* row_data(const id_t v) noexcept { return M.data() + v * w_; }
+
+  public :
+
+    AdjMatUInt(const GT t, const size_t n) :
+      type_(t), n_(n), w_(num_words(n)), M(n_ * w_) {}
+    explicit AdjMatUInt(const AdjVecUInt& G) : AdjMatUInt(G.type(), G.n()) {
+      for (id_t v = 0; v < n_; ++v) {
+        word_t* const r = row_data(v);
+        for (const id_t w : G.neighbours(v)) r[w / word_bits] |= bit(w);
+      }
+    }
+
+    // As Graphs::add_biclique for the adjacency-list:
+    template <class RAN>
+    void add_biclique(const RAN& V1, const RAN& V2) noexcept {
+      for (const id_t v1 : V1) {
+        assert(v1 < n_); word_t* const r = row_data(v1);
+        for (const id_t v2 : V2) {
+          assert(v2 < n_); r[v2 / word_bits] |= bit(v2);
+        }
+      }
+      if (type_ == GT::und)
+        for (const id_t v2 : V2) {
+          word_t* const r = row_data(v2);
+          for (const id_t v1 : V1) r[v1 / word_bits] |= bit(v1);
+        }
+    }
+
+    GT type() const noexcept { return type_; }
+    size_t n() const noexcept { return n_; }
+    size_t words() const noexcept { return w_; }
+
+    size_t num_edges() const noexcept {
+      size_t res = 0, loops = 0;
+      for (id_t v = 0; v < n_; ++v) {
+        res += degree(v); loops += adjacent(v,v);
+      }
+      if (type_ == GT::und) {
+        assert((res - loops) % 2 == 0);
+        res = (res - loops) / 2 + loops;
+      }
+      return res;
+    }
+
+    row_t row(const id_t v) const noexcept {
+      assert(v < n_);
+      return {M.data() + v * w_, w_};
+    }
+    bool adjacent(const id_t v, const id_t w) const noexcept {
+      assert(v < n_ and w < n_);
+      return M[v * w_ + w / word_bits] & bit(w);
+    }
+    id_t degree(const id_t v) const noexcept { return count(row(v)); }
+    size_t common(const id_t v, const id_t w) const noexcept {
+      return count_and(row(v), row(w));
+    }
+    bool includes(const id_t v, const row_t S) const noexcept {
+      return subset(S, row(v));
+    }
+
+    list_t neighbours(const id_t v) const { return to_list(row(v)); }
+    adjlist_t graph() const {
+      adjlist_t res; res.reserve(n_);
+      for (id_t v = 0; v < n_; ++v) res.push_back(neighbours(v));
+      return res;
+    }
+
+    bool operator ==(const AdjMatUInt&) const noexcept = default;
+  };
+
+  constexpr AdjMatUInt::size_t dense_max_bytes = AdjMatUInt::size_t(1) << 31;
+  inline bool dense_suitable(const AdjMatUInt::size_t n,
+                             const AdjMatUInt::size_t d,
+                             const AdjMatUInt::size_t max_bytes
+                               = dense_max_bytes) noexcept {
+    if (n == 0 or n >= (AdjMatUInt::size_t(1) << 32) or
+        AdjMatUInt::bytes(n) > max_bytes) return false;
+    // d * 64 >= n^2, without overflow (n^2 + 63 < 2^64):
+    return d >= (n * n + (AdjMatUInt::word_bits - 1)) / AdjMatUInt::word_bits;
+  }
+  inline bool dense_suitable(const AdjVecUInt& G) noexcept {
+    AdjVecUInt::size_t d = 0;
+    for (const auto& L : G.graph()) d += L.size();
+    return dense_suitable(G.n(), d);
+  }
+
+
+  // ********************************************************************
+
+
   // See Algorithms::is_independent for the implicit version (with an
   // adjacency-predicate; there loops are ignored, here taken into account):
   template <class RAN>
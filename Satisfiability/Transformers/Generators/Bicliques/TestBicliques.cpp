@@ -1,5 +1,5 @@
 // Oliver Kullmann, 28.2.2022 (Swansea)
-/* Copyright 2022, 2023 Oliver Kullmann
+/* Copyright 2022, 2023, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -15,12 +15,13 @@ License, or any later version. */
 #include "Graphs.hpp"
 #include "Generators.hpp"
 #include "GraphTraversal.hpp"
+#include "RandomGraphs.hpp"
 
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.3.9",
-        "7.8.2023",
+        "0.3.10",
+        "16.10.2026",
         __FILE__,
         "Oliver Kullmann",
         "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/Bicliques/TestBicliques.cpp",
@@ -329,4 +330,34 @@ int main(const int argc, const char* const argv[]) {
    assert(eqp(Gc.allindices(), {{"A-B",0},{"A-C",1},{"B-E",2}}));
    assert(eqp(Gc.graph(), {{1,2},{0},{0}}));
   }
+
+  {RandGen::RandGen_t g;
+   for (idv_t n = 0; n <= 40; n += 8)
+     for (const RandGen::Prob64 p : {RandGen::Prob64{1,10}, {1,2}, {9,10}}) {
+       const AdjVecUInt G = RandomGraphs::independent_edges(n, p, g);
+       const AdjMatUInt M(G);
+       const auto E = G.alledges();
+       assert(bccomp_adjlist(M, E) == bccomp_adjlist(G, E));
+       assert(num_edges_bccomp_graph_bydef(M, E) ==
+              num_edges_bccomp_graph_bydef(G, E));
+       RandGen::Bernoulli B(g, RandGen::Prob64{1,3});
+       for (unsigned t = 0; t < 20; ++t) {
+         bc_frame b;
+         for (idv_t v = 0; v < n; ++v)
+           if (B()) b.l.push_back(v); else if (B()) b.r.push_back(v);
+         assert(is_bc(b, M) == is_bc(b, G));
+       }
+       Bcc_frame S; // the stars
+       for (idv_t v = 0; v < n; ++v) {
+         const auto& N = G.neighbours(v);
+         S.L.push_back({{v}, list_t(std::ranges::upper_bound(N, v), N.end())});
+       }
+       assert(is_bc(S, M) and is_bc(S, G));
+       assert(is_cover(S, M) and is_cover(S, G));
+       if (G.m() != 0) {
+         for (auto& b : S.L) if (not b.r.empty()) { b.r.pop_back(); break; }
+         assert(not is_cover(S, M) and not is_cover(S, G));
+       }
+     }
+  }
 }
@@ -22,8 +22,8 @@ License, or any later version. */
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.9.1",
-        "23.5.2023",
+        "0.10.1",
+        "16.10.2026",
         __FILE__,
         "Oliver Kullmann",
         "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/Bicliques/TestBicliques2SAT.cpp",
@@ -225,15 +225,15 @@ int main(const int argc, const char* const argv[]) {
 
    ss.str("");
    assert(eqp(trans.sat_translate(ss, {{},SS::without,{}},
-     {DC::without, DP::without, CS::without}, 1, {}), {64, 272 + 2*3})); // 278
+     {DC::without, DP::without, CS::without, DW::stream}, 1, {}), {64, 272 + 2*3})); // 278
    assert(ss.str().empty());
    ss.str("");
    assert(eqp(trans.sat_translate(ss,{{},SS::without,{}},
-     {DC::without,DP::without,CS::without},11,{}), {96, 409})); // {B * 32, B * 128 + 16 + 3*#units}
+     {DC::without,DP::without,CS::without,DW::stream},11,{}), {96, 409})); // {B * 32, B * 128 + 16 + 3*#units}
 
    ss.str("");
    assert(eqp(trans.sat_translate(ss, {{},SS::without,{}},
-     {DC::without, DP::with, CS::without}, 6, {}), {96, 406}));
+     {DC::without, DP::with, CS::without, DW::stream}, 6, {}), {96, 406}));
    assert(ss.str() == "p cnf 96 406\n");
    trans.update_B(1);
    assert(trans.all_nonedges_for_bcs<std::ostream&>(ss)
@@ -242,7 +242,15 @@ int main(const int argc, const char* const argv[]) {
    assert(trans.all_edges_cov<std::ostream&>(ss) == 16);
    assert(trans.all_basic_clauses<std::ostream&>(ss) == 32 + 96 + 16); // 144
    assert(eqp(trans.sat_translate(ss,
-     {SB::none,SS::without,{}}, {DC::without, DP::with, CS::without}, 0, {}), {96, 400}));
+     {SB::none,SS::without,{}}, {DC::without, DP::with, CS::without, DW::stream}, 0, {}), {96, 400}));
+   {std::stringstream s1, s2;
+    assert(eqp(trans.sat_translate(s1, {SB::none,SS::without,{}},
+      {DC::without, DP::with, CS::with, DW::stream}, 0, {}), {96, 400}));
+    assert(eqp(trans.sat_translate(s2, {SB::none,SS::without,{}},
+      {DC::without, DP::with, CS::with, DW::buffered}, 0, {}), {96, 400}));
+    assert(s1.str().starts_with("p cnf 96 400\n"));
+    assert(s1.str() == s2.str());
+   }
   }
 
   const auto test_downwards = [](const BC2SAT::graph_t& G, const size_t bcc,
@@ -277,6 +285,55 @@ std::cerr << G.n() << " " << G.m() << " " << sb << " " << ss
     }
   };
 
+  const auto test_incr = [](const BC2SAT::graph_t& G, const size_t bcc,
+                             PT pt = PT::cover) {
+    for (int sb0 = 0; sb0 <= int(SB::none); ++sb0) {
+      const SB sb = SB(sb0);
+      for (int ss0 = 0; ss0 <= int(SS::without); ++ ss0) {
+        const SS ss = SS(ss0);
+        for (size_t dist = 1; dist <= 3; ++dist) {
+          const size_t B = bcc + dist;
+          for (const Bounds b : {
+                 Bounds{DI::downwards, Bounds::choose_u{}, {B,false}},
+                 Bounds{DI::binary_search, Bounds::choose_u{}, {B,false}},
+                 Bounds{DI::upwards, Bounds::choose_l{}, {0,false}}}) {
+            BC2SAT trans(G, b);
+            const auto res = trans.sat_solve(nullptr,
+                                             {sb,ss,pt,{},SO::incr},
+                                             10, 1, {dist});
+            assert(res.rt == ResultType::exact);
+            assert(res.B == bcc);
+            assert(not res.solution or is_bcc(res.bcc, G));
+            assert(not res.solution or res.bcc.L.size() == bcc);
+            const auto& rows = res.minisat_stats.params();
+            assert(rows.size() == res.minisat_stats.stats().size());
+            for (const auto& r : rows) {
+              assert(r.size() == 2);
+              assert(r[1] == (r[0] >= bcc ? 1 : 0));
+            }
+          }
+        }
+      }
+    }
+  };
+
+  {for (size_t n = 0; n < 5; ++n)
+     test_incr(BC2SAT::graph_t(clique(n)), bcc_clique(n));
+   for (size_t n = 0; n < 4; ++n)
+     test_incr(BC2SAT::graph_t(biclique(n,n)), bcc_biclique(n,n));
+   for (size_t n = 3; n < 6; ++n)
+     test_incr(BC2SAT::graph_t(cycle(n)), bcc_cycle(n));
+   for (size_t n = 0; n < 5; ++n)
+     test_incr(BC2SAT::graph_t(crown(n)), bcc_crown(n));
+   for (size_t n = 0; n < 4; ++n)
+     for (size_t m = 0; m < 4; ++m)
+       test_incr(BC2SAT::graph_t(grid(n,m)), bcc_grid(n,m));
+   for (size_t n = 0; n < 5; ++n)
+     test_incr(BC2SAT::graph_t(clique(n)), bcp_clique(n), PT::partition2);
+   for (size_t n = 3; n < 6; ++n)
+     test_incr(BC2SAT::graph_t(cycle(n)), bcp_cycle(n), PT::partition2);
+  }
+
   constexpr size_t default_n = 5; // for full test level use 6
   {for (size_t n = 0; n < default_n; ++n)
      test_downwards(BC2SAT::graph_t(clique(n)), bcc_clique(n));
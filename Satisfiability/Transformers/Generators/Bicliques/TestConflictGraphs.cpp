@@ -1,5 +1,5 @@
 // Oliver Kullmann, 27.2.2022 (Swansea)
-/* Copyright 2022, 2023 Oliver Kullmann
+/* Copyright 2022, 2023, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -28,8 +28,8 @@ License, or any later version. */
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.4.0",
-        "21.8.2023",
+        "0.4.1",
+        "16.10.2026",
         __FILE__,
         "Oliver Kullmann",
         "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/Bicliques/TestConflictGraphs.cpp",
@@ -324,4 +324,23 @@ int main(const int argc, const char* const argv[]) {
           conflictgraph_degree_stats(F0.expand()));
   }
 
+  {RandGen::RandGen_t g;
+   for (var_t n = 1; n <= 9; n += 4)
+     for (var_t c = 0; c <= 120; c += 30)
+       for (var_t k = 1; k <= n; k += 3) {
+         DimacsClauseList F{{n,c}, {}};
+         for (var_t i = 0; i < c; ++i) {
+           Clause C;
+           RandGen::rand_clause(g, C, RandGen::VarInterval(n), k,
+                                RandGen::SignDist{RandGen::Prob64{1,2}});
+           F.second.push_back(std::move(C));
+         }
+         const auto O = allocc(F);
+         const auto G = conflictgraph_bydef(F);
+         assert(conflictgraph_sparse(c, O) == G);
+         assert(conflictgraph_dense(c, O) == G);
+         assert(conflictgraph(F) == G);
+       }
+  }
+
 }
@@ -1,5 +1,5 @@
 // Oliver Kullmann, 20.2.2022 (Swansea)
-/* Copyright 2022, 2023 Oliver Kullmann
+/* Copyright 2022, 2023, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -22,8 +22,8 @@ License, or any later version. */
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.4.5",
-        "17.8.2023",
+        "0.4.6",
+        "16.10.2026",
         __FILE__,
         "Oliver Kullmann",
         "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/Bicliques/TestGraphs.cpp",
@@ -779,4 +779,58 @@ int main(const int argc, const char* const argv[]) {
     }
   }
 
+  {using A = AdjMatUInt;
+   assert(A::num_words(0) == 0);
+   assert(A::num_words(1) == 1);
+   assert(A::num_words(64) == 1);
+   assert(A::num_words(65) == 2);
+   assert(A::bytes(65) == 65 * 2 * 8);
+   const A::wordvec_t S = A::to_bitset({0,3,64,127}, 128);
+   assert(eqp(S, {9, A::word_t(1) | (A::word_t(1) << 63)}));
+   assert(A::count(S) == 4);
+   assert(eqp(A::to_list(S), {0,3,64,127}));
+   const A::wordvec_t T = A::to_bitset({3,64,100}, 128);
+   assert(A::count_and(S, T) == 2);
+   assert(not A::subset(S, T) and not A::subset(T, S));
+   assert(A::subset(A::to_bitset({3,64}, 128), S));
+   assert(A::subset(A::wordvec_t(2), S));
+   assert(not dense_suitable(0, 0));
+   assert(not dense_suitable(1, 0) and dense_suitable(1, 1));
+   assert(not dense_suitable(64, 63) and dense_suitable(64, 64));
+   assert(dense_suitable(128, 256) and not dense_suitable(128, 255));
+   assert(not dense_suitable(128, 128*128, 128*16-1));
+  }
+  {RandGen::RandGen_t g;
+   for (RandGen::gen_uint_t n = 0; n < 140; n += 7)
+     for (const RandGen::Prob64 p : {RandGen::Prob64{1,10}, {1,2}, {1,1}}) {
+       const auto G = RandomGraphs::independent_edges(n, p, g);
+       const AdjMatUInt M(G);
+       assert(M.type() == GT::und);
+       assert(M.n() == G.n());
+       assert(M.words() == AdjMatUInt::num_words(n));
+       assert(M.num_edges() == G.m());
+       assert(M.graph() == G.graph());
+       assert(M == AdjMatUInt(G));
+       for (AdjMatUInt::id_t v = 0; v < G.n(); ++v) {
+         assert(M.degree(v) == G.degree(v));
+         assert(M.neighbours(v) == G.neighbours(v));
+         for (AdjMatUInt::id_t w = 0; w < G.n(); ++w) {
+           assert(M.adjacent(v,w) == G.adjacent(v,w));
+           AdjVecUInt::list_t I;
+           std::ranges::set_intersection(G.neighbours(v), G.neighbours(w),
+                                         std::back_inserter(I));
+           assert(M.common(v,w) == I.size());
+           assert(M.includes(v, M.row(w)) ==
+                  std::ranges::includes(G.neighbours(v), G.neighbours(w)));
+         }
+       }
+       AdjMatUInt M2(GT::und, G.n());
+       auto add = [&M2](const AdjVecUInt::edge_t& e) {
+         M2.add_biclique(AdjVecUInt::list_t{e.first},
+                         AdjVecUInt::list_t{e.second}); };
+       G.process_alledges(add);
+       assert(M2 == M);
+     }
+  }
+
 }
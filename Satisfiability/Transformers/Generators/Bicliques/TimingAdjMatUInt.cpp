@@ -0,0 +1,182 @@
+// Oliver Kullmann, 16.10.2026 (Swansea)
+/* Copyright 2026 Oliver Kullmann
+This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
+it and/or modify it under the terms of the GNU General Public License as published by
+the Free Software Foundation and included in this library; either version 3 of the
+License, or any later version. */
+
+/* Timing of the graph-kernels, sparse (AdjVecUInt) versus dense (AdjMatUInt)
+
+Examples (annotations on following lines):
+
+The arguments and their default values:
+Bicliques> ./TimingAdjMatUInt mode=cd R=1 < CNF
+
+Reads a strict Dimacs-file from standard input, and performs R times
+ - mode "cs" : conflictgraph_sparse
+ - mode "cd" : conflictgraph_dense
+ - mode "bs" : num_edges_bccomp_graph_bydef for the conflict-graph as
+               AdjVecUInt
+ - mode "bd" : num_edges_bccomp_graph_bydef for the conflict-graph as
+               AdjMatUInt
+ - mode "vs" : is_bc and is_cover for the cover by stars, via the
+               AdjVecUInt-kernels (is_bc(bc_frame, G) and covers per edge)
+ - mode "vd" : is_bc and is_cover for AdjMatUInt.
+Empty or (detectably) invalid input yields return-code 2.
+The constructions of the conflict-graph (for "b*", "v*") resp. of the
+all-occurrences (for "c*") and of the cover (for "v*") are not timed.
+
+Bicliques> ./TimingAdjMatUInt cd < data/A_131_3964_1
+# mode = cd, R = 1
+3964 157484
+# the number of vertices and edges of the conflict-graph
+Bicliques> ./TimingAdjMatUInt bd < data/A_77_1090_1
+# mode = bd, R = 1
+1090 7026 727326
+# plus the number of edges of the biclique-compatibility graph
+# (the same values for all modes; for "v*" the last value is 1).
+
+
+Results:
+
+On vm (g++ 12.2.0, bogomips 4200; one core):
+
+Bicliques> time ./TimingAdjMatUInt cs 500 < data/A_131_3964_1
+real 2.027 user 1.800
+Bicliques> time ./TimingAdjMatUInt cd 500 < data/A_131_3964_1
+real 0.851 user 0.831
+
+Bicliques> time ./TimingAdjMatUInt bs 20 < data/A_77_1090_1
+real 8.665 user 8.552
+Bicliques> time ./TimingAdjMatUInt bd 20 < data/A_77_1090_1
+real 0.914 user 0.877
+Bicliques> time ./TimingAdjMatUInt bs < data/A_131_3964_1
+3964 157484 2362378400
+real 370.227 user 364.543
+Bicliques> time ./TimingAdjMatUInt bd < data/A_131_3964_1
+real 31.339 user 30.875
+
+Bicliques> time ./TimingAdjMatUInt vs < data/A_131_3964_1
+real 0.679 user 0.667
+Bicliques> time ./TimingAdjMatUInt vd 500 < data/A_131_3964_1
+real 0.465 user 0.460
+
+So the construction of the conflict-graph is 2.4 times faster, the
+biclique-compatibility graph around 10 times faster (the adjacency-tests
+are single bit-lookups instead of binary searches), and checking a cover
+(quadratic for the sparse kernels) becomes linear in the size of the
+matrix. The QBF2BCC-corpus itself is not part of the repository; the
+above instances (from data/) are dense enough for the dispatch
+(dense_suitable) to choose AdjMatUInt.
+
+*/
+
+#include <iostream>
+#include <string>
+#include <algorithm>
+#include <exception>
+
+#include <cassert>
+
+#include <Numerics/FloatingPoint.hpp>
+#include <ProgramOptions/Environment.hpp>
+
+#include "DimacsTools.hpp"
+#include "Graphs.hpp"
+#include "ConflictGraphs.hpp"
+#include "Bicliques.hpp"
+
+namespace {
+
+  const Environment::ProgramInfo proginfo{
+        "0.1.1",
+        "16.10.2026",
+        __FILE__,
+        "Oliver Kullmann",
+        "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/Bicliques/TimingAdjMatUInt.cpp",
+        "GPL v3"};
+
+  using namespace Graphs;
+  typedef AdjVecUInt::id_t idv_t;
+
+  constexpr idv_t R_default = 1;
+
+  // The cover of all edges by the stars {v} x {w > v : w adjacent v}:
+  Bicliques::Bcc_frame stars(const AdjVecUInt& G) {
+    Bicliques::Bcc_frame B;
+    for (idv_t v = 0; v < G.n(); ++v) {
+      const auto& N = G.neighbours(v);
+      Bicliques::list_t r(std::ranges::upper_bound(N, v), N.end());
+      if (not r.empty()) B.L.push_back({{v}, std::move(r)});
+    }
+    return B;
+  }
+
+}
+
+int main(const int argc, const char* const argv[]) {
+
+  if (Environment::version_output(std::cout, proginfo, argc, argv)) return 0;
+
+  Environment::Index index;
+  const std::string mode = (argc <= index) ? "cd" : argv[index++];
+  if (mode != "cs" and mode != "cd" and mode != "bs" and mode != "bd" and
+      mode != "vs" and mode != "vd") {
+    std::cerr << "ERROR[" << proginfo.prg << "]: mode must be one of \"cs\","
+      " \"cd\", \"bs\", \"bd\", \"vs\", \"vd\".\n";
+    return 1;
+  }
+  const idv_t R = (argc <= index) ? R_default : FloatingPoint::toUInt(argv[index++]);
+  index.deactivate();
+
+  std::cout << "# mode = " << mode << ", R = " << R << std::endl;
+
+  if (std::cin.peek() == std::char_traits<char>::eof()) {
+    std::cerr << "ERROR[" << proginfo.prg << "]: empty input.\n";
+    return 2;
+  }
+  DimacsTools::DimacsClauseList F;
+  try { F = DimacsTools::read_strict_Dimacs(std::cin); }
+  catch (const std::exception& e) {
+    std::cerr << "ERROR[" << proginfo.prg << "]: invalid Dimacs-input ("
+              << e.what() << ").\n";
+    return 2;
+  }
+  const auto O = ConflictGraphs::allocc(F);
+  const auto c = F.first.c;
+
+  if (mode[0] == 'c') {
+    idv_t m = 0;
+    for (idv_t i = 0; i < R; ++i)
+      m = (mode == "cs" ? ConflictGraphs::conflictgraph_sparse(c, O) :
+                          ConflictGraphs::conflictgraph_dense(c, O)).m();
+    std::cout << c << " " << m << "\n";
+    return 0;
+  }
+
+  const AdjVecUInt G = ConflictGraphs::conflictgraph_sparse(c, O);
+  const AdjMatUInt M(G);
+  if (mode[0] == 'b') {
+    const auto E = G.alledges();
+    idv_t mb = 0;
+    for (idv_t i = 0; i < R; ++i)
+      mb = mode == "bs" ? Bicliques::num_edges_bccomp_graph_bydef(G, E) :
+                          Bicliques::num_edges_bccomp_graph_bydef(M, E);
+    std::cout << G.n() << " " << G.m() << " " << mb << "\n";
+  }
+  else {
+    const auto B = stars(G);
+    const auto E = G.alledges();
+    bool ok = true;
+    for (idv_t i = 0; i < R; ++i)
+      ok = mode == "vs" ?
+        std::ranges::all_of(B.L, [&G](const Bicliques::bc_frame& b){
+                                   return Bicliques::is_bc(b, G);}) and
+        std::ranges::all_of(E, [&B](const auto e){
+                                 return covers(B, e.first, e.second);}) :
+        Bicliques::is_bc(B, M) and Bicliques::is_cover(B, M);
+    assert(ok);
+    std::cout << G.n() << " " << G.m() << " " << ok << "\n";
+  }
+
+}
@@ -12,7 +12,7 @@ License, or any later version. */
    Imported types:
     - Var, Lit Clause from RandGen
 
-   Functions:
+   Functions (out is an ostream or a RandGen::DimacsOut):
 
    - amo_primes(ostream, Clause)
    - alo_primes(ostream, Clause)
@@ -49,7 +49,8 @@ namespace AloAmo {
   using RandGen::Lit;
   using RandGen::Clause;
 
-  void amo_primes(std::ostream& out, const Clause& C) {
+  template <class OUT>
+  void amo_primes(OUT& out, const Clause& C) {
     if (C.size() >= 2) {
       auto current_end = C.cbegin(); ++current_end;
       do {
@@ -60,28 +61,32 @@ namespace AloAmo {
       } while (++current_end != C.end());
     }
   }
-  void alo_primes(std::ostream& out, const Clause& C) {
+  template <class OUT>
+  void alo_primes(OUT& out, const Clause& C) {
     out << C; INCCLAUSE;
   }
-  void eo_primes(std::ostream& out, const Clause& C) {
+  template <class OUT>
+  void eo_primes(OUT& out, const Clause& C) {
     amo_primes(out, C);
     alo_primes(out, C);
   }
 
   // The disjunction over B implies w:
-  inline void disj_impl(std::ostream& out, const Clause& B, const Lit w) {
+  template <class OUT>
+  inline void disj_impl(OUT& out, const Clause& B, const Lit w) {
     for (const Lit& x : B) { out << Clause{-x, w}; INCCLAUSE; }
   }
   // The disjunction over B is equivalent to w:
-  inline void disj_equiv(std::ostream& out, const Clause& B, const Lit w) {
+  template <class OUT>
+  inline void disj_equiv(OUT& out, const Clause& B, const Lit w) {
     disj_impl(out, B, w);
     out << -w << " "; out << B; INCCLAUSE;
   }
 
   // As seco_amov2cl(L,V) in CardinalityConstraints.mac;
   // object enc of NVAR: enc() returns new variable:
-  template <class NVAR>
-  void amo_seco(std::ostream& out, Clause C, const NVAR& enc) {
+  template <class OUT, class NVAR>
+  void amo_seco(OUT& out, Clause C, const NVAR& enc) {
     Clause B(3);
     while (C.size() > 4) {
       const Lit w{enc(), 1};
@@ -95,8 +100,8 @@ namespace AloAmo {
   }
   // Combining seco_amovuep2cl(L,V) and seco_amouep_co(L)
   // from CardinalityConstraints.mac:
-  template <class NVAR>
-  RandGen::var_t amo_secouep(std::ostream& out, Clause C, const NVAR& enc) {
+  template <class OUT, class NVAR>
+  RandGen::var_t amo_secouep(OUT& out, Clause C, const NVAR& enc) {
     RandGen::var_t final_v = 0;
     Clause B(3);
     while (C.size() > 4) {
@@ -111,14 +116,14 @@ namespace AloAmo {
     amo_primes(out, C);
     return final_v;
   }
-  template <class NVAR>
-  void eo_seco(std::ostream& out, const Clause& C, const NVAR& enc) {
+  template <class OUT, class NVAR>
+  void eo_seco(OUT& out, const Clause& C, const NVAR& enc) {
     amo_seco(out, C, enc);
     out << C; INCCLAUSE;
   }
 
-  template <class NVAR>
-  void eo_secouep(std::ostream& out, const Clause& C, const NVAR& enc) {
+  template <class OUT, class NVAR>
+  void eo_secouep(OUT& out, const Clause& C, const NVAR& enc) {
     const RandGen::var_t final_v = amo_secouep(out, C, enc);
     if (final_v == 0) {
       assert(C.size() <= 4);
@@ -25,6 +25,7 @@ namespace Errors {
     ealo_par = 16,
     eul_par = 17,
     p_par = 18,
+    w_par = 19,
   };
 
 }
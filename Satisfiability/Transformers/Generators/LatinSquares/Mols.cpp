@@ -210,7 +210,8 @@ namespace {
     " [k=1]\n"
     "   [symopt=" << Environment::WRP<SymP>{} << ",\"\"]"
     " [primopt=" << Environment::WRP<PrimeP>{} << ",\"\"]\n"
-    "   [output=-cout,\"\",-nil,NAME]\n"
+    "   [output=-cout,\"\",-nil,NAME]"
+    " [writer=" << Environment::WRP<RandGen::DimacsW>{} << ",\"\"]\n"
     "computes the SAT-translation for a latin square of order N.\n"
     "\n> " << proginfo.prg <<
     " [N=>1]"
@@ -219,7 +220,8 @@ namespace {
     "   [ealoopt=" << Environment::WRP<EAloP>{} << ",\"\"]\n"
     "   [eulopt=" << Environment::WRP<EulP>{} << ",\"\"]\n"
     "   [primopt=" << Environment::WRP<PrimeP>{} << ",\"\"]\n"
-    "   [output=-cout,\"\",-nil,NAME]\n"
+    "   [output=-cout,\"\",-nil,NAME]"
+    " [writer=" << Environment::WRP<RandGen::DimacsW>{} << ",\"\"]\n"
     "computes the SAT-translation for k MOLS of order N:\n\n"
     "  - The arguments are positional, not named (the names are used here only"
     " for communication).\n"
@@ -231,6 +233,7 @@ namespace {
     "     k=1: \"" << default_filestem() << "_N_1_so_po.dimacs\"\n"
     "     k>1: \"" << default_filestem() << "_N_k_so_eao_euo_po.dimacs\".\n"
     "  - \"-nil\" for the output means no output of clauses (only information).\n"
+    "  - The writer \"+buf\" outputs the clauses buffered (the same output).\n"
 ;
     return true;
   }
@@ -242,7 +245,9 @@ namespace {
   using RandGen::Lit;
   using RandGen::Clause;
 
-  void call_eo_seco(std::ostream& out, const Clause& C,
+  // out is an ostream or a RandGen::DimacsOut:
+  template <class OUT>
+  void call_eo_seco(OUT& out, const Clause& C,
                     const VarEncoding& enc) {
     assert(has_pair(enc.ealoopt));
     if (enc.ealoopt == EAloP::pair or enc.ealoopt == EAloP::both)
@@ -254,21 +259,25 @@ namespace {
   }
 
   // x -> (y and z):
-  void implication(std::ostream& out, const Lit x, const Lit y, const Lit z) {
+  template <class OUT>
+  void implication(OUT& out, const Lit x, const Lit y, const Lit z) {
     out << Clause{-x, y} << Clause{-x, z}; INCCLAUSE; INCCLAUSE;
   }
   // x <- (y and z):
-  void back_implication(std::ostream& out, const Lit x, const Lit y, const Lit z) {
+  template <class OUT>
+  void back_implication(OUT& out, const Lit x, const Lit y, const Lit z) {
     out << Clause{x, -y, -z}; INCCLAUSE;
   }
   // x <-> (y and z):
-  void definition(std::ostream& out, const Lit x, const Lit y, const Lit z) {
+  template <class OUT>
+  void definition(OUT& out, const Lit x, const Lit y, const Lit z) {
     implication(out,x,y,z);
     back_implication(out,x,y,z);
   }
 
 
-  void ls(std::ostream& out, const VarEncoding& enc) {
+  template <class OUT>
+  void ls(OUT& out, const VarEncoding& enc) {
 #ifndef NDEBUG
     assert(running_counter == 0);
 #endif
@@ -397,7 +406,8 @@ namespace {
   }
 
 
-  void es_defs(std::ostream& out, const VarEncoding& enc) {
+  template <class OUT>
+  void es_defs(OUT& out, const VarEncoding& enc) {
 #ifndef NDEBUG
     assert(running_counter == enc.nvc.cls);
 #endif
@@ -466,7 +476,8 @@ namespace {
   }
 
 
-  void es_values(std::ostream& out, const VarEncoding& enc) {
+  template <class OUT>
+  void es_values(OUT& out, const VarEncoding& enc) {
     if (not has_val(enc.ealoopt)) return;
     if (enc.symopt == SymP::full) {
       for (dim_t q = 1; q < enc.k; ++q)
@@ -521,7 +532,8 @@ namespace {
     }
   }
 
-  void orthogonality(std::ostream& out, const VarEncoding& enc) {
+  template <class OUT>
+  void orthogonality(OUT& out, const VarEncoding& enc) {
     if (enc.symopt == SymP::full) {
       for (dim_t q = 1; q < enc.k; ++q)
         for (dim_t p = 0; p < q; ++p)
@@ -587,6 +599,14 @@ namespace {
 #endif
   }
 
+  template <class OUT>
+  void all_clauses(OUT& out, const VarEncoding& enc) {
+    ls(out, enc);
+    es_defs(out, enc);
+    es_values(out, enc);
+    orthogonality(out, enc);
+  }
+
 
   inline std::string default_param(const VarEncoding e) {
     using Environment::RegistrationPolicies;
@@ -666,6 +686,15 @@ int main(const int argc, const char* const argv[]) {
 
   const VarEncoding enc(p, symopt, ealoopt, eulopt, primopt);
 
+  const std::optional<RandGen::DimacsW> rdw = argc <= index+1 ?
+    RandGen::DimacsW{} : Environment::read<RandGen::DimacsW>(argv[index+1]);
+  if (not rdw) {
+    std::cerr << error << "Bad option-argument w.r.t. the writer: \""
+              << argv[index+1] << "\".\n";
+    return int(Error::w_par);
+  }
+  const RandGen::DimacsW dw = rdw.value();
+
   std::ofstream out;
   std::string filename;
   if (index == argc or special(argv[index])) {
@@ -683,6 +712,7 @@ int main(const int argc, const char* const argv[]) {
     std::cout << "Output to file \"" << filename << "\".\n";
   }
   index++;
+  if (argc > index) index++;
 
   index.deactivate();
 
@@ -701,8 +731,10 @@ int main(const int argc, const char* const argv[]) {
             << DWW{"Euler_ALO"} << ealoopt << "\n"
             << DWW{"Euler_vars"} << eulopt << "\n"
             << DWW{"Prime_clauses"} << primopt << "\n"
-            << DWW{"output"} << qu(filename) << "\n"
-      << DHW{"Sizes"};
+            << DWW{"output"} << qu(filename) << "\n";
+  if (dw == RandGen::DimacsW::buffered)
+    out << DWW{"output-mode"} << dw << "\n";
+  out << DHW{"Sizes"};
   if (k == 1) {
     enc.nls(out);
     enc.cls(out);
@@ -720,8 +752,10 @@ int main(const int argc, const char* const argv[]) {
 
   if (filename == "-nil") return 0;
   out << dimacs_pars{enc.nvc.n, enc.nvc.c};
-  ls(out, enc);
-  es_defs(out, enc);
-  es_values(out, enc);
-  orthogonality(out, enc);
+  if (dw == RandGen::DimacsW::buffered) {
+    RandGen::DimacsOut dout(out);
+    all_clauses(dout, enc);
+    dout.flush();
+  }
+  else all_clauses(out, enc);
 }
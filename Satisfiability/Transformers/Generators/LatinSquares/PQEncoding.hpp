@@ -34,10 +34,12 @@ License, or any later version. */
 
   Translation of Pandiagonal:
 
-   - eo(ostream&, Clause C, NVAR enc) :
+   (out is an ostream or a RandGen::DimacsOut for the clause-outputs)
+
+   - eo(out, Clause C, NVAR enc) :
      output exactly-one for C, using enc.ct and enc();
      more general:
-   - amoeo(ostream&, Clause C, NVAR enc, CF cf)
+   - amoeo(out, Clause C, NVAR enc, CF cf)
      (not for alo)
 
    - rowreduced(out, enc)
@@ -48,7 +50,10 @@ License, or any later version. */
    - eoantidiagonals(out, enc)
    - amoeosudoku(out, enc);
 
-   - pandiagonal(ostream&, PEncoding enc, bool sudoku)
+   - pandiagonal_clauses(out, PEncoding enc, bool sudoku)
+   - pandiagonal(ostream&, PEncoding enc, bool sudoku, DimacsW dw)
+     (Dimacs-parameter-line, then the clauses, via DimacsOut for
+     DimacsW::buffered)
 
   Encoding of cyclic Pandiagonal:
 
@@ -61,7 +66,8 @@ License, or any later version. */
 
   Translation of cyclic Pandiagonal:
 
-   - cpandiagonal(ostream&, CEncoding enc, bool sudoku)
+   - cpandiagonal_clauses(out, CEncoding enc, bool sudoku)
+   - cpandiagonal(ostream&, CEncoding enc, bool sudoku, DimacsW dw)
 
 
 */
@@ -236,8 +242,8 @@ namespace PQEncoding {
   };
 
 
-  template <class NVAR>
-  void eo(std::ostream& out, const AloAmo::Clause& C, const NVAR& enc) {
+  template <class OUT, class NVAR>
+  void eo(OUT& out, const AloAmo::Clause& C, const NVAR& enc) {
     switch(enc.ct) {
       case PQOptions::CT::prime : AloAmo::eo_primes(out, C); return;
       case PQOptions::CT::seco : AloAmo::eo_seco(out, C, enc); return;
@@ -245,8 +251,8 @@ namespace PQEncoding {
     }
   }
   // Only amo or eo (controlled by cf):
-  template <class NVAR>
-  void amoeo(std::ostream& out, const AloAmo::Clause& C, const NVAR& enc,
+  template <class OUT, class NVAR>
+  void amoeo(OUT& out, const AloAmo::Clause& C, const NVAR& enc,
              const PQOptions::CF cf) {
     assert(cf != PQOptions::CF::alo);
     if (cf == PQOptions::CF::eo) { eo(out, C, enc); return; }
@@ -269,8 +275,8 @@ namespace PQEncoding {
         out << "(int " << CSP{i,j} << " " << 0 << " " << N-1 << ")\n";
   }
 
-  template <class ENC>
-  void rowreduced(std::ostream& out, const ENC& enc, const var_t bound = 0) {
+  template <class OUT, class ENC>
+  void rowreduced(OUT& out, const ENC& enc, const var_t bound = 0) {
     const var_t B = bound == 0 ? enc.N : bound;
     for (dim_t j = 0; j < B; ++j)
       out << AloAmo::Clause{AloAmo::Lit(enc({0,j},j))};
@@ -283,8 +289,8 @@ namespace PQEncoding {
       out << "(= " << CSP{0,j} << " " << j << ")\n";
   }
 
-  template <class ENC>
-  void eovalues(std::ostream& out, const ENC& enc, const var_t bound = 0) {
+  template <class OUT, class ENC>
+  void eovalues(OUT& out, const ENC& enc, const var_t bound = 0) {
     const var_t B = bound == 0 ? enc.N : bound;
     for (dim_t j = 0; j < B; ++j)
       for (dim_t i = 0; i < enc.N; ++i) {
@@ -295,7 +301,8 @@ namespace PQEncoding {
       }
   }
 
-  void eorows(std::ostream& out, const PEncoding& enc) {
+  template <class OUT>
+  void eorows(OUT& out, const PEncoding& enc) {
     for (dim_t i = 0; i < enc.N; ++i)
       for (dim_t k = 0; k < enc.N; ++k) {
         AloAmo::Clause C;
@@ -313,8 +320,8 @@ namespace PQEncoding {
     }
   }
 
-  template <class ENC>
-  void eocolumns(std::ostream& out, const ENC& enc, const var_t bound = 0) {
+  template <class OUT, class ENC>
+  void eocolumns(OUT& out, const ENC& enc, const var_t bound = 0) {
     const var_t B = bound == 0 ? enc.N : bound;
     for (dim_t j = 0; j < B; ++j)
       for (dim_t k = 0; k < enc.N; ++k) {
@@ -333,8 +340,8 @@ namespace PQEncoding {
     }
   }
 
-  template <class ENC>
-  void eodiagonals(std::ostream& out, const ENC& enc, const var_t bound = 0) {
+  template <class OUT, class ENC>
+  void eodiagonals(OUT& out, const ENC& enc, const var_t bound = 0) {
     const var_t B = bound == 0 ? enc.N : bound;
     for (dim_t diff = 0; diff < B; ++diff)
       for (dim_t k = 0; k < enc.N; ++k) {
@@ -357,8 +364,8 @@ namespace PQEncoding {
     }
   }
 
-  template <class ENC>
-  void eoantidiagonals(std::ostream& out, const ENC& enc,
+  template <class OUT, class ENC>
+  void eoantidiagonals(OUT& out, const ENC& enc,
                        const var_t bound = 0) {
     const var_t B = bound == 0 ? enc.N : bound;
     for (var_t sum = enc.N; sum < enc.N+B; ++sum)
@@ -382,8 +389,8 @@ namespace PQEncoding {
     }
   }
 
-  template <class ENC>
-  void amoeosudoku(std::ostream& out, const ENC& enc) {
+  template <class OUT, class ENC>
+  void amoeosudoku(OUT& out, const ENC& enc) {
     const auto N = enc.N;
     using Clause = AloAmo::Clause;
     using Lit = AloAmo::Lit;
@@ -520,10 +527,9 @@ namespace PQEncoding {
     }
   }
 
-  void pandiagonal(std::ostream& out, const PEncoding& enc,
-                   const bool sudoku) {
-    out << Statistics::dimacs_pars(enc.p);
-
+  template <class OUT>
+  void pandiagonal_clauses(OUT& out, const PEncoding& enc,
+                           const bool sudoku) {
     rowreduced(out, enc);
     eovalues(out, enc);
     eorows(out, enc);
@@ -532,6 +538,17 @@ namespace PQEncoding {
     eoantidiagonals(out, enc);
 
     if (sudoku and enc.N >= 9) amoeosudoku(out, enc);
+  }
+  void pandiagonal(std::ostream& out, const PEncoding& enc,
+                   const bool sudoku,
+                   const RandGen::DimacsW dw = RandGen::DimacsW::stream) {
+    out << Statistics::dimacs_pars(enc.p);
+    if (dw == RandGen::DimacsW::buffered) {
+      RandGen::DimacsOut dout(out);
+      pandiagonal_clauses(dout, enc, sudoku);
+      dout.flush();
+    }
+    else pandiagonal_clauses(out, enc, sudoku);
 
 #ifndef NDEBUG
     assert(running_counter == enc.p.c);
@@ -605,10 +622,9 @@ namespace PQEncoding {
 
   };
 
-  void cpandiagonal(std::ostream& out, const CEncoding& enc,
-                    const bool sudoku) {
-    out << Statistics::dimacs_pars(enc.pc);
-
+  template <class OUT>
+  void cpandiagonal_clauses(OUT& out, const CEncoding& enc,
+                            const bool sudoku) {
     rowreduced(out, enc, 1);
     eovalues(out, enc, 1);
     eocolumns(out, enc, 1);
@@ -616,6 +632,17 @@ namespace PQEncoding {
     eoantidiagonals(out, enc, 1);
 
     if (sudoku and enc.N >= 9) amoeosudoku(out, enc);
+  }
+  void cpandiagonal(std::ostream& out, const CEncoding& enc,
+                    const bool sudoku,
+                    const RandGen::DimacsW dw = RandGen::DimacsW::stream) {
+    out << Statistics::dimacs_pars(enc.pc);
+    if (dw == RandGen::DimacsW::buffered) {
+      RandGen::DimacsOut dout(out);
+      cpandiagonal_clauses(dout, enc, sudoku);
+      dout.flush();
+    }
+    else cpandiagonal_clauses(out, enc, sudoku);
 
 #ifndef NDEBUG
     assert(running_counter == enc.pc.c);
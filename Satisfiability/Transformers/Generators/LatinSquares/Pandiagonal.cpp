@@ -267,8 +267,8 @@ p cnf 56875 303775
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.2.1",
-        "3.3.2024",
+        "0.2.2",
+        "16.10.2026",
         __FILE__,
         "Oliver Kullmann",
         "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/LatinSquares/Pandiagonal.cpp",
@@ -288,9 +288,11 @@ namespace {
       return false;
     std::cout <<
     "> " << proginfo.prg <<
-      " [+]N constraint-type\n\n"
+      " [+]N constraint-type [writer]\n\n"
       " - N               : unsigned integer\n"
-      " - constraint-type : " << Environment::WRPO<CT>{} << "\n\n" <<
+      " - constraint-type : " << Environment::WRPO<CT>{} << "\n"
+      " - writer          : " << Environment::WRP<RandGen::DimacsW>{} <<
+        " (buffered clause-output)\n\n" <<
       "Here\n"
       "  - \"+\" adds the (generalised) Sudoku-conditions\n"
       "  - for options the first possibility is the default, "
@@ -305,8 +307,9 @@ int main(const int argc, const char* const argv[]) {
   if (Environment::version_output(std::cout, proginfo, argc, argv)) return 0;
   if (show_usage(argc, argv)) return 0;
 
-  if (argc != commandline_args + 1) {
-    std::cerr << error << "Exactly " << commandline_args << " command-line"
+  if (argc != commandline_args + 1 and argc != commandline_args + 2) {
+    std::cerr << error << "Exactly " << commandline_args << " or "
+      << commandline_args+1 << " command-line"
       " arguments needed, but the real number is " << argc-1 << ".\n";
     return 1;
   }
@@ -323,6 +326,14 @@ int main(const int argc, const char* const argv[]) {
     return 1;
   }
   const CT ct = ct0.value();
+  const auto dw0 = argc == commandline_args + 2 ?
+    Environment::read<RandGen::DimacsW>(argv[3]) : RandGen::DimacsW{};
+  if (not dw0) {
+    std::cerr << error << "The writer could not be read from"
+        " string \"" << argv[3] << "\".\n";
+    return 1;
+  }
+  const RandGen::DimacsW dw = dw0.value();
 
   const PEncoding enc(N, ct, sudoku);
 
@@ -336,6 +347,8 @@ int main(const int argc, const char* const argv[]) {
             << DWW{"N"} << N << "\n"
             << DWW{"Constraint_type"} << ct << "\n"
             << DWW{"box-constraint"} << sudoku << "\n";
+  if (dw == RandGen::DimacsW::buffered)
+    std::cout << DWW{"output-mode"} << dw << "\n";
   if (sudoku) {
     std::cout << DWW{"  b,q,r"} << enc.b << " " << enc.q << " "
               << enc.r << "\n"
@@ -344,5 +357,5 @@ int main(const int argc, const char* const argv[]) {
     std::cout << std::endl;
   }
 
-  pandiagonal(std::cout, enc, sudoku);
+  pandiagonal(std::cout, enc, sudoku, dw);
 }
@@ -11,8 +11,8 @@ License, or any later version. */
 namespace ProgramInfo {
 
   const Environment::ProgramInfo proginfo{
-        "0.10.7",
-        "1.3.2024",
+        "0.10.8",
+        "16.10.2026",
         "Mols.cpp",
         "Oliver Kullmann",
         "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/LatinSquares/Mols.cpp",
@@ -1,5 +1,5 @@
 // Oliver Kullmann, 12.6.2016 (Swansea)
-/* Copyright 2016, 2017, 2019 Oliver Kullmann
+/* Copyright 2016, 2017, 2019, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -98,9 +98,22 @@ License, or any later version. */
   translation-type, in both cases without symmetry-breaking, while with
   we get "Pyth_n-K-d-m-SB.cnf" resp. "Pyth_n-K-d-m-T-SB.cnf".
 
+  At any position, the optional parameter "nt=N" can be used, for the
+  number N >= 1 of threads (default 1); it is not part of the default
+  filename, and the output does not depend on it (besides the timestamp).
+  The outer loops of the enumeration (resp. counting) are split into
+  N slices (by congruence classes of the loop-index modulo N), sharing the
+  factorisation-table, and the tuples are merged into the sequential order;
+  also subsumption-elimination and core-reduction are run with N threads.
+
+  Also at any position, the optional parameter "buf=on" (default "buf=off")
+  outputs the clauses via RandGen::DimacsOut (Random/DimacsOutput.hpp),
+  formatting with std::to_chars into a buffer handed over in large blocks;
+  the output is exactly the same.
+
   So the complete usage-description is
 
-Pythagorean n K d [format=SD|D] m [S|W|N|NS] [sb=on|off] [-|filename]
+Pythagorean n K d [format=SD|D] m [S|W|N|NS] [sb=on|off] [-|filename] [nt=N] [buf=on|off]
 
   where the parameter after m is needed if m >= 3, while for m <= 2 this
   parameter can not be used. As usual, square-brackets mean optional
@@ -133,21 +146,21 @@ Pythagorean n K d [format=SD|D] m [S|W|N|NS] [sb=on|off] [-|filename]
 
   COMPILATION:
 
-  Requires C++11. Compile with
+  Requires C++20 (for Random/DimacsOutput.hpp). Compile with
 
-  > g++ -Wall --std=c++17 -Ofast -o Pythagorean Pythagorean.cpp
+  > g++ -Wall --std=c++20 -Ofast -pthread -o Pythagorean Pythagorean.cpp
 
   resp. (now asserts disabled)
 
-  > g++ -Wall --std=c++17 -Ofast -DNDEBUG -o Pythagorean Pythagorean.cpp
+  > g++ -Wall --std=c++20 -Ofast -DNDEBUG -pthread -o Pythagorean Pythagorean.cpp
 
   resp. (fastest, and without superfluous warnings)
 
-  > g++ -Wall -Wno-dangling-else -Wno-catch-value --std=c++17 -Ofast -funroll-loops -DNDEBUG -o Pythagorean Pythagorean.cpp
+  > g++ -Wall -Wno-dangling-else -Wno-catch-value --std=c++20 -Ofast -funroll-loops -DNDEBUG -pthread -o Pythagorean Pythagorean.cpp
 
   If on the other hand a debugging version is needed, use:
 
-  > g++ -Wall --std=c++17 -g -o Pythagorean Pythagorean.cpp
+  > g++ -Wall --std=c++20 -g -pthread -o Pythagorean Pythagorean.cpp
 
 
   FURTHER WORK:
@@ -163,20 +176,10 @@ Pythagorean n K d [format=SD|D] m [S|W|N|NS] [sb=on|off] [-|filename]
         line.
   TODO: prove that subsumption does not happen for K=4.
   TODO: implement arbitrary K.
-  TODO: implement multi-threaded computation.
-        Easy with std::async, just dividing up the outer loops for computing
-        the tuples (enumeration or counting). Since smaller numbers are easier,
-        a bit of thought on an equal splitting is needed.
-        The solution for splitting is, not to split the load into contiguous
-        blocks, but to use "slicing": for the number nt >= 1 of threads,
-        just use the congruence classes {1,...,n} mod i, i = 0,...,nt-1
-        for the threads. It seems the computation of the factorisation-table
-        can not be parallelised.
+  TODO: multi-threaded computation ("nt=N", via std::async and slicing):
+        The computation of the factorisation-table is still sequential.
         nt=0 could be used for outputting just the header? Or just the
         estimation?!
-        It seems then that "nt=.." should become another optional parameter
-        (default-value 1).
-        nt should not become part of the default filename.
   TODO: implement mixed k_i.
         Likely best here to use for example "[3,4]", that is, enclosing the
         list into square brackets on the parameter line; and demanding, that
@@ -393,6 +396,10 @@ float(B);
 #include <stdexcept>
 #include <iomanip>
 #include <random>
+#include <future>
+#include <iterator>
+
+#include "Random/DimacsOutput.hpp"
 
 namespace {
 
@@ -402,6 +409,22 @@ namespace {
 
 }
 
+namespace Parallel {
+
+  // Running f(j) for 0 <= j < nt in parallel (j=0 in the calling thread):
+  template <class F>
+  void run(const unsigned nt, const F& f) {
+    assert(nt >= 1);
+    std::vector<std::future<void>> futures;
+    futures.reserve(nt-1);
+    for (unsigned j = 1; j < nt; ++j)
+      futures.push_back(std::async(std::launch::async, f, j));
+    f(0);
+    for (auto& fut : futures) fut.get();
+  }
+
+}
+
 namespace Factorisation {
 
   typedef std::uint_least32_t base_t;
@@ -513,104 +536,262 @@ namespace Pythagorean {
     return N / (std::pow((long double)n,K-2) * std::log((long double)n));
   }
 
-  // Counting triples:
-  template <typename C1, typename C2>
-  void triples_c(const C1 n, C1& max, C2& hn) {
-    using namespace Factorisation;
-    const auto T = table_factor(n);
-    assert(T.size() == n+1);
-    for (C1 i = 5; i <= n; ++i) {
-      C2 prod = 1;
-      for (const auto e : extract_exponents_1m4(T,i)) prod *= 2*e + 1;
-      if (prod != 1) {max = std::max(max, i); hn += (prod-1)/2;}
+  /* Multi-threaded computation by "slicing":
+
+     The outer loop of the enumeration resp. counting runs over the
+     indices 0 <= i < N (determining the hypotenuse for counting triples
+     via the factorisation-table, r for the other triples-computations,
+     and otherwise the smallest tuple-component a); thread 0 <= j < nt
+     handles the indices i with i = j mod nt (so that the easier and the
+     harder values are mixed), collecting its tuples together with the
+     end-positions per index. The factorisation-table is computed once,
+     and shared (read-only) by the threads. Merging the blocks in the
+     order of the indices yields exactly the sequential order.
+  */
+
+  template <class V, typename C1, typename C2>
+  struct Slice {
+    bool enumerate = true; // otherwise only counting
+    C1 max = 0;
+    C2 hn = 0;
+    V res;
+    std::vector<siz_t<V>> ends; // ends of the blocks of tuples per index
+  };
+  template <class V, typename C1, typename C2>
+  using slice_v = std::vector<Slice<V,C1,C2>>;
+
+  // f(i, S) handles index i of the outer loop (adding to slice S):
+  template <class V, typename C1, typename C2, class F>
+  slice_v<V,C1,C2> sliced(const C2 N, const bool enumerate,
+                          const unsigned nt, const F& f) {
+    slice_v<V,C1,C2> res(nt);
+    Parallel::run(nt, [&res, N, enumerate, nt, &f](const unsigned j) {
+      auto& S = res[j];
+      S.enumerate = enumerate;
+      for (C2 i = j; i < N; i += nt) {
+        f(i, S);
+        if (enumerate) S.ends.push_back(S.res.size());
+      }
+    });
+    return res;
+  }
+  // Merging the slices into res, max and hn (in the sequential order):
+  template <class V, typename C1, typename C2>
+  void merge(slice_v<V,C1,C2>& slices, const C2 N, V& res, C1& max, C2& hn) {
+    const auto nt = slices.size();
+    siz_t<V> total = 0;
+    for (const auto& S : slices) {
+      max = std::max(max, S.max); hn += S.hn; total += S.res.size();
+    }
+    if (total == 0) return;
+    res.reserve(res.size() + total);
+    for (C2 i = 0; i < N; ++i) {
+      auto& S = slices[i % nt];
+      const C2 k = i / nt;
+      const auto begin = S.res.begin();
+      res.insert(res.end(),
+        std::make_move_iterator(begin + (k==0 ? 0 : S.ends[k-1])),
+        std::make_move_iterator(begin + S.ends[k]));
     }
   }
 
-  // Counting triples with minimum distance between (sorted) components
-  // (much slower than above, but minimal space usage):
-  template <typename C1, typename C2>
-  void triples_c(const C1 n, const C1 dist, C1& max, C2& hn) noexcept {
-    assert(dist >= 1);
-    for (C1 r = 2; r <= C1(n/(1+std::sqrt(2))); r+=2) {
-      const C1 rs = r*(r/2);
-      for (C1 s = dist; s <= C1(std::sqrt(rs)); ++s)
-        if (rs % s == 0) {
-          const C1 t = rs / s;
-          if (t >= n or t < s+dist) continue;
-          const C1 c = r+s+t;
-          if (c <= n) {max = std::max(max,c); ++hn;}
-        }
-    }
+  // Counting triples with hypotenuse i, using factorisation-table T:
+  template <class T, class V, typename C1, typename C2>
+  void triples_c(const T& table, const C1 i, Slice<V,C1,C2>& S) {
+    C2 prod = 1;
+    for (const auto e : Factorisation::extract_exponents_1m4(table,i))
+      prod *= 2*e + 1;
+    if (prod != 1) {S.max = std::max(S.max, i); S.hn += (prod-1)/2;}
   }
 
-  // Generating triples:
-  template <class V, typename C1>
-  V triples_e(const C1 n, const C1 dist, C1& max) {
-    V res; res.reserve(Pythagorean::estimating_triples(n));
-    const C1 max_r = n/(1+std::sqrt(2));
-    const auto T = Factorisation::table_factor(max_r);
-    assert(T.size() == max_r+1);
-    for (C1 r = 2; r <= max_r; r+=2) {
-      auto F = Factorisation::extract_factorisation(T, r);
-      for (auto& p : F) p.second *= 2;
-      --F[2];
-      const C1 rs = r*(r/2);
-      const C1 bound = std::sqrt(rs);
-      for (const C1 s : Factorisation::bounded_factors(F,bound)) {
-        if (s < dist) continue;
+  // Maximal r for triples (r even, 2 <= r <= max_r):
+  template <typename C1>
+  C1 max_r(const C1 n) noexcept { return n/(1+std::sqrt(2)); }
+
+  // Counting triples for given r, with minimum distance between (sorted)
+  // components (much slower than above, but minimal space usage):
+  template <class V, typename C1, typename C2>
+  void triples_c(const C1 n, const C1 dist, const C1 r, Slice<V,C1,C2>& S) noexcept {
+    assert(dist >= 1);
+    const C1 rs = r*(r/2);
+    for (C1 s = dist; s <= C1(std::sqrt(rs)); ++s)
+      if (rs % s == 0) {
         const C1 t = rs / s;
         if (t >= n or t < s+dist) continue;
         const C1 c = r+s+t;
-        if (c <= n and s+dist <= t) {
-          res.push_back({{r+s,r+t,c}});
-          max = std::max(max,c);
+        if (c <= n) {S.max = std::max(S.max,c); ++S.hn;}
+      }
+  }
+
+  // Generating triples for given r, using factorisation-table T:
+  template <class T, class V, typename C1, typename C2>
+  void triples_e(const T& table, const C1 n, const C1 dist, const C1 r,
+                 Slice<V,C1,C2>& S) {
+    auto F = Factorisation::extract_factorisation(table, r);
+    for (auto& p : F) p.second *= 2;
+    --F[2];
+    const C1 rs = r*(r/2);
+    const C1 bound = std::sqrt(rs);
+    for (const C1 s : Factorisation::bounded_factors(F,bound)) {
+      if (s < dist) continue;
+      const C1 t = rs / s;
+      if (t >= n or t < s+dist) continue;
+      const C1 c = r+s+t;
+      if (c <= n and s+dist <= t) {
+        S.res.push_back({{r+s,r+t,c}});
+        S.max = std::max(S.max,c);
+      }
+    }
+  }
+
+  // Generating (or counting) quadruples with smallest component a:
+  template <class V, typename C1, typename C2>
+  void quadruples(const C1 n, const C1 dist, const C1 a, Slice<V,C1,C2>& S) {
+    const C1 n2 = n*n;
+    const C1 a2 = a*a;
+    const C1 bbound = std::sqrt(n2-a2);
+    for (C1 b = a+dist; b <= bbound; ++b) {
+      const C1 b2 = a2+b*b;
+      const C1 cbound = std::sqrt(n2-b2);
+      for (C1 c = b+dist; c <= cbound; ++c) {
+        const C1 d2 = b2 + c*c;
+        const C1 d = std::sqrt(d2);
+        if (d*d == d2 and d >= c+dist) {
+          S.max = std::max(S.max,d);
+          if (S.enumerate) S.res.push_back({{a,b,c,d}});
+          else ++S.hn;
         }
       }
     }
-    return res;
   }
 
-  // Counting quadruples :
-  template <typename C1, typename C2>
-  void quadruples_c(const C1 n, const C1 dist, C1& max, C2& hn) noexcept {
+  // Generating (or counting) 5-tuples with smallest component a:
+  template <class V, typename C1, typename C2>
+  void quintuples(const C1 n, const C1 dist, const C1 a, Slice<V,C1,C2>& S) {
     const C1 n2 = n*n;
-    for (C1 a = 1; a < n; ++a) {
-      const C1 a2 = a*a;
-      const C1 bbound = std::sqrt(n2-a2);
-      for (C1 b = a+dist; b <= bbound; ++b) {
-        const C1 b2 = a2+b*b;
-        const C1 cbound = std::sqrt(n2-b2);
-        for (C1 c = b+dist; c <= cbound; ++c) {
-          const C1 d2 = b2 + c*c;
-          const C1 d = std::sqrt(d2);
-          if (d*d == d2 and d >= c+dist) {max = std::max(max,d); ++hn;}
+    const C1 a2 = a*a;
+    for (C1 b = a+dist; b < n; ++b) {
+      const C1 b2 = b*b;
+      for (C1 c = b+dist; c < n; ++c) {
+        const C1 c2 = c*c;
+        for (uint d = c+dist; d < n; ++d) {
+          const C1 d2 = d*d;
+          const C1 e2 = a2 + b2 + c2 + d2;
+          if (e2 > n2) break;
+          const C1 e = std::sqrt(e2);
+          if (e*e != e2) continue;
+          if (e < d+dist) continue;
+          S.max = std::max(S.max,e);
+          if (S.enumerate) S.res.push_back({{a,b,c,d,e}});
+          else ++S.hn;
         }
       }
     }
   }
 
-  // Generating quadruples:
-  template <class V, typename C1>
-  V quadruples_e(const C1 n, const C1 dist, C1& max) {
-    V res;
+  // Generating (or counting) 6-tuples with smallest component a:
+  template <class V, typename C1, typename C2>
+  void sextuples(const C1 n, const C1 dist, const C1 a, Slice<V,C1,C2>& S) {
     const C1 n2 = n*n;
-    for (C1 a = 1; a < n; ++a) {
-      const C1 a2 = a*a;
-      const C1 bbound = std::sqrt(n2-a2);
-      for (C1 b = a+dist; b <= bbound; ++b) {
-        const C1 b2 = a2+b*b;
-        const C1 cbound = std::sqrt(n2-b2);
-        for (C1 c = b+dist; c <= cbound; ++c) {
-          const C1 d2 = b2 + c*c;
-          const C1 d = std::sqrt(d2);
-          if (d*d == d2 and d >= c+dist) {
-            res.push_back({{a,b,c,d}});
-            max = std::max(max,d);
+    const C1 a2 = a*a;
+    for (C1 b = a+dist; b < n; ++b) {
+      const C1 b2 = b*b;
+      for (C1 c = b+dist; c < n; ++c) {
+        const C1 c2 = c*c;
+        for (uint d = c+dist; d < n; ++d) {
+          const C1 d2 = d*d;
+          for (uint e = d+dist; e < n; ++e) {
+            const uint e2 = e*e;
+            const C1 f2 = a2 + b2 + c2 + d2 + e2;
+            if (f2 > n2) break;
+            const C1 f = std::sqrt(f2);
+            if (f*f != f2) continue;
+            if (f < e+dist) continue;
+            S.max = std::max(S.max,f);
+            if (S.enumerate) S.res.push_back({{a,b,c,d,e,f}});
+            else ++S.hn;
           }
         }
       }
     }
-    return res;
+  }
+
+  // Generating (or counting) 7-tuples with smallest component a:
+  template <class V, typename C1, typename C2>
+  void septuples(const C1 n, const C1 dist, const C1 a, Slice<V,C1,C2>& S) {
+    const C1 n2 = n*n;
+    const C1 a2 = a*a;
+    for (C1 b = a+dist; b < n; ++b) {
+      const C1 b2 = b*b;
+      for (C1 c = b+dist; c < n; ++c) {
+        const C1 c2 = c*c;
+        for (uint d = c+dist; d < n; ++d) {
+          const C1 d2 = d*d;
+          for (uint e = d+dist; e < n; ++e) {
+            const uint e2 = e*e;
+            for (uint f = e+dist; f < n; ++f) {
+              const uint f2 = f*f;
+              const C1 g2 = a2 + b2 + c2 + d2 + e2 + f2;
+              if (g2 > n2) break;
+              const C1 g = std::sqrt(g2);
+              if (g*g != g2) continue;
+              if (g < f+dist) continue;
+              S.max = std::max(S.max,g);
+              if (S.enumerate) S.res.push_back({{a,b,c,d,e,f,g}});
+              else ++S.hn;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // Computing all tuples (m=0: only counting), using nt threads:
+  template <class V, typename C1, typename C2>
+  void tuples(const C1 n, const C1 K, const C1 dist, const C1 m,
+              const unsigned nt, V& res, C1& max, C2& hn) {
+    assert(K >= 3);
+    const bool enumerate = m != 0;
+    slice_v<V,C1,C2> slices;
+    C2 N;
+    if (K == 3) {
+      if (m == 0 and dist == 0) {
+        const auto T = Factorisation::table_factor(n);
+        assert(T.size() == n+1);
+        N = (n < 5) ? 0 : n-4;
+        slices = sliced<V,C1>(N, enumerate, nt,
+          [&T](const C2 i, auto& S){triples_c(T, C1(i+5), S);});
+      }
+      else {
+        const C1 mr = max_r(n);
+        N = mr / 2;
+        if (m == 0)
+          slices = sliced<V,C1>(N, enumerate, nt,
+            [n,dist](const C2 i, auto& S){triples_c(n, dist, C1(2*(i+1)), S);});
+        else {
+          const auto T = Factorisation::table_factor(mr);
+          assert(T.size() == mr+1);
+          slices = sliced<V,C1>(N, enumerate, nt,
+            [&T,n,dist](const C2 i, auto& S){triples_e(T, n, dist, C1(2*(i+1)), S);});
+        }
+      }
+    }
+    else {
+      N = (n == 0) ? 0 : n-1; // a = 1, ..., n-1
+      if (K == 4)
+        slices = sliced<V,C1>(N, enumerate, nt,
+          [n,dist](const C2 i, auto& S){quadruples(n, dist, C1(i+1), S);});
+      else if (K == 5)
+        slices = sliced<V,C1>(N, enumerate, nt,
+          [n,dist](const C2 i, auto& S){quintuples(n, dist, C1(i+1), S);});
+      else if (K == 6)
+        slices = sliced<V,C1>(N, enumerate, nt,
+          [n,dist](const C2 i, auto& S){sextuples(n, dist, C1(i+1), S);});
+      else
+        slices = sliced<V,C1>(N, enumerate, nt,
+          [n,dist](const C2 i, auto& S){septuples(n, dist, C1(i+1), S);});
+    }
+    merge(slices, N, res, max, hn);
   }
 }
 
@@ -636,9 +817,11 @@ namespace Subsumption {
   // should be a choice of minimum degree, however here it is not worth the effort.
 
   // Remove subsumed elements from vector v, where the elements of v are
-  // ordered sequences of unsigned integral type C1, with maximal value max:
+  // ordered sequences of unsigned integral type C1, with maximal value max;
+  // the elements of the same size are checked by nt threads (sliced as
+  // in namespace Pythagorean):
   template <class V, typename C1>
-  void min_elements(V& v, const C1 max) {
+  void min_elements(V& v, const C1 max, const unsigned nt = 1) {
     if (v.empty()) return;
     const auto begin = v.begin(), end = v.end();
     typedef val_t<V> tuple_t;
@@ -650,18 +833,24 @@ namespace Subsumption {
     for (const auto size = begin->size(); i != end and i->size()==size; ++i)
       occ[select(*i)].push_front(i);
     if (i == end) return;
+    // Whether t is subsumed by some element in occ (only reading occ):
+    const auto subsumed = [&occ](const tuple_t& t) {
+      for (const auto x : t)
+        for (const auto j : occ[x])
+          if (std::includes(t.begin(),t.end(), j->begin(),j->end()))
+            return true;
+      return false;
+    };
     while (true) {
       const auto size = i->size();
       const it_t old_i = i;
-      for (; i < end and i->size()==size; ++i) {
-        for (const auto x : *i)
-          for (const auto j : occ[x])
-            if (std::includes(i->begin(),i->end(), j->begin(),j->end())) {
-              i->clear();
-              goto Outer;
-            }
-        Outer :;
-      }
+      i = std::find_if(i, end,
+            [size](const tuple_t& t){return t.size() != size;});
+      const auto len = i - old_i;
+      Parallel::run(nt, [old_i, len, nt, &subsumed](const unsigned j) {
+        for (auto k = decltype(len)(j); k < len; k += nt)
+          if (subsumed(old_i[k])) old_i[k].clear();
+      });
       if (i == end) break;
       for (auto j = old_i; j != i; ++j)
         if (not j->empty()) occ[select(*j)].push_front(j);
@@ -674,24 +863,63 @@ namespace Subsumption {
 namespace Reduction {
 
   // Iteratively removing all hyperedges containing some vertex occurring
-  // at most m-1 time, computing the (final) vertex-degrees in deg:
+  // at most m-1 time, computing the (final) vertex-degrees in deg.
+  // The result (the m-core) does not depend on the order of removals;
+  // for nt >= 2 threads, in each round the hyperedges to be removed are
+  // determined in parallel (contiguous blocks of hyp), and then removed:
   template <class V, class SV, typename C1>
-  void core_red(V& hyp, SV& deg, const C1 m) noexcept {
-    for (const auto& h : hyp) for (const auto v : h) ++deg[v];
-    if (m <= 1) return;
+  void core_red(V& hyp, SV& deg, const C1 m, const unsigned nt = 1) {
     typedef val_t<V> tuple_t;
     typedef val_t<tuple_t> vert_t;
+    typedef siz_t<V> size_t;
+    const size_t N = hyp.size();
+    const auto block = [N,nt](const unsigned j) -> size_t {
+      return j == nt ? N : N / nt * j;
+    };
+    if (nt == 1)
+      for (const auto& h : hyp) for (const auto v : h) ++deg[v];
+    else {
+      std::vector<SV> degs(nt, SV(deg.size()));
+      Parallel::run(nt, [&](const unsigned j) {
+        for (size_t i = block(j); i < block(j+1); ++i)
+          for (const auto v : hyp[i]) ++degs[j][v];
+      });
+      for (const auto& d : degs)
+        for (siz_t<SV> v = 0; v < d.size(); ++v) deg[v] += d[v];
+    }
+    if (m <= 1) return;
+    const auto low = [&deg, m](const tuple_t& h) {
+      return std::find_if(h.begin(), h.end(),
+        [&](const vert_t v){return deg[v] < m;}) != h.end();
+    };
     bool changed;
-    do {
-      changed = false;
-      for (auto& h : hyp)
-        if (std::find_if(h.begin(), h.end(),
-            [&](const vert_t v){return deg[v] < m;}) != h.end()) {
-          changed = true;
-          for (const auto v : h) --deg[v];
-          h.clear();
-        }
-    } while (changed);
+    if (nt == 1)
+      do {
+        changed = false;
+        for (auto& h : hyp)
+          if (low(h)) {
+            changed = true;
+            for (const auto v : h) --deg[v];
+            h.clear();
+          }
+      } while (changed);
+    else {
+      std::vector<std::vector<size_t>> removed(nt);
+      do {
+        Parallel::run(nt, [&](const unsigned j) {
+          removed[j].clear();
+          for (size_t i = block(j); i < block(j+1); ++i)
+            if (low(hyp[i])) removed[j].push_back(i);
+        });
+        changed = false;
+        for (const auto& r : removed)
+          for (const size_t i : r) {
+            changed = true;
+            for (const auto v : hyp[i]) --deg[v];
+            hyp[i].clear();
+          }
+      } while (changed);
+    }
     Container::remove_empty_elements(hyp);
   }
 
@@ -881,8 +1109,8 @@ namespace Translation {
   // {-v_1}, {v_1,-v_2}, {v_1,v_2,-v_3}, ..., {v_1,...,v_{m-2},-v_{m-1}},
   // {v_1,...,v_{m-1}} (all literals flipped, compared to literature, due to
   // minimising "-"-symbols in output).
-  template <typename C2, typename C1>
-  inline void lits_n(const C1 v, const C1 m, const C1 col, std::ostream* const out) {
+  template <typename C2, typename C1, class OUT>
+  inline void lits_n(const C1 v, const C1 m, const C1 col, OUT* const out) {
     assert(v >= 1);
     assert(col < m);
     if (col == 0) *out << "-" << var_n<C2,C1>(v,m,0);
@@ -893,13 +1121,13 @@ namespace Translation {
     }
   }
 
-  template <class Hyp, typename C1, typename C2, class Deg, class T>
-  void output_colouring_problem(std::ostream* const out, const Hyp& G, const C1 m,
-      const C2 max, const C2 c, const Deg deg, const C1 md_v,
+  // out is an ostream or a RandGen::DimacsOut:
+  template <class OUT, class Hyp, typename C1, typename C2, class Deg, class T>
+  void output_clauses(OUT* const out, const Hyp& G, const C1 m,
+      const Deg& deg, const C1 md_v,
       const Type t, const bool sb, const T& re) {
     assert(m >= 1);
     bool r = not re.empty();
-    pline_output(out, max, c, m);
     if (m == 1) {
       assert(not sb);
       for (const auto& H : G) {
@@ -1011,6 +1239,19 @@ namespace Translation {
     }
   }
 
+  template <class Hyp, typename C1, typename C2, class Deg, class T>
+  void output_colouring_problem(std::ostream* const out, const Hyp& G, const C1 m,
+      const C2 max, const C2 c, const Deg& deg, const C1 md_v,
+      const Type t, const bool sb, const T& re, const bool buffered) {
+    pline_output(out, max, c, m);
+    if (buffered) {
+      RandGen::DimacsOut dout(*out);
+      output_clauses<RandGen::DimacsOut, Hyp, C1, C2>(&dout, G, m, deg, md_v, t, sb, re);
+      dout.flush();
+    }
+    else output_clauses<std::ostream, Hyp, C1, C2>(out, G, m, deg, md_v, t, sb, re);
+  }
+
 }
 
 namespace {
@@ -1027,14 +1268,16 @@ namespace {
     translation = 6,
     symmetry = 7,
     format = 8,
-    parse = 9
+    parse = 9,
+    threads = 10,
+    buffered = 11
   };
   constexpr int v(const Error e) noexcept {return static_cast<int>(e);}
 
   const std::string program = "Pythagorean";
   const std::string err = "ERROR[" + program + "]: ";
 
-  const std::string version = "0.10.5";
+  const std::string version = "0.11.1";
 
   const std::string file_prefix = "Pyth_";
 
@@ -1115,6 +1358,12 @@ namespace {
     else return std::stoull(arg.substr(1));
   }
 
+  bool check_nt_arg(const std::string& arg) noexcept {
+    return arg.find("nt=") == 0;
+  }
+  bool check_buf_arg(const std::string& arg) noexcept {
+    return arg.find("buf=") == 0;
+  }
   bool check_sb_arg(const std::string& arg) noexcept {
     return arg.find("sb=") == 0;
   }
@@ -1299,7 +1548,41 @@ namespace {
 
 }
 
-int main(const int argc, const char* const argv[]) {
+int main(const int argc0, const char* const argv0[]) {
+  // Removing the optional arguments "nt=..." and "buf=..." (at any
+  // position):
+  std::vector<const char*> args;
+  unsigned nt = 1;
+  bool buffered = false;
+  {bool with_nt_argument = false, with_buf_argument = false;
+   for (int i = 0; i < argc0; ++i)
+     if (i == 0) args.push_back(argv0[i]);
+     else if (check_buf_arg(argv0[i])) {
+       const std::string val = std::string(argv0[i]).substr(4);
+       if (with_buf_argument or (val != "on" and val != "off")) {
+         std::cerr << err << "Optional input \"" << argv0[i] << "\" must be "
+           "the only \"buf=..\", with \"on\" or \"off\".\n";
+         return v(Error::buffered);
+       }
+       with_buf_argument = true;
+       buffered = val == "on";
+     }
+     else if (not check_nt_arg(argv0[i])) args.push_back(argv0[i]);
+     else {
+       const auto p = read_uint(std::string(argv0[i]).substr(3));
+       if (with_nt_argument or not p.first or p.second == 0 or
+           p.second > std::numeric_limits<unsigned>::max()) {
+         std::cerr << err << "Optional input \"" << argv0[i] << "\" must be "
+           "the only \"nt=..\", with an unsigned integer >= 1.\n";
+         return v(Error::threads);
+       }
+       with_nt_argument = true;
+       nt = p.second;
+     }
+  }
+  const int argc = args.size();
+  const char* const* const argv = args.data();
+
   constexpr int argc_min = 5, argc_max = 9;
   constexpr uint_t K_max = 7;
   if (argc < argc_min or argc > argc_max) {
@@ -1311,7 +1594,9 @@ int main(const int argc, const char* const argv[]) {
      " - The number m >= 0 of colours.\n"
      " - The translation type in case of m >= 3.\n"
      " - Optional: symmetry-breaking \"sb=on\" (the default) or \"sb=off\".\n"
-     " - Optional: The filename or \"-\" for standard output.\n";
+     " - Optional: The filename or \"-\" for standard output.\n"
+     "Additionally, at any position \"nt=N\" (N >= 1 threads, default 1)\n"
+     " and \"buf=on\" or \"buf=off\" (buffered clause-output, default off).\n";
     return v(Error::parameter);
   }
 
@@ -1461,92 +1746,7 @@ int main(const int argc, const char* const argv[]) {
   cnum_t hn = 0;
   uint_t max = 0;
 
-  if (K == 3)
-    if (m == 0)
-      if (dist == 0) Pythagorean::triples_c(n, max, hn);
-      else Pythagorean::triples_c(n, dist, max, hn);
-    else
-      res = Pythagorean::triples_e<hypergraph>(n, dist, max);
-  else if (K == 4)
-    if (m == 0) Pythagorean::quadruples_c(n, dist, max, hn);
-    else res = Pythagorean::quadruples_e<hypergraph>(n, dist, max);
-  else if (K == 5) {
-    const uint_t n2 = n*n;
-    for (uint_t a = 1; a < n; ++a) {
-      const uint_t a2 = a*a;
-      for (uint_t b = a+dist; b < n; ++b) {
-        const uint_t b2 = b*b;
-        for (uint_t c = b+dist; c < n; ++c) {
-          const uint_t c2 = c*c;
-          for (uint d = c+dist; d < n; ++d) {
-            const uint_t d2 = d*d;
-            const uint_t e2 = a2 + b2 + c2 + d2;
-            if (e2 > n2) break;
-            const uint_t e = std::sqrt(e2);
-            if (e*e != e2) continue;
-            if (e < d+dist) continue;
-            max = std::max(max,e);
-            if (m == 0) ++hn;
-            else res.push_back({{a,b,c,d,e}});
-          }
-        }
-      }
-    }
-  }
-  else if (K == 6) {
-    const uint_t n2 = n*n;
-    for (uint_t a = 1; a < n; ++a) {
-      const uint_t a2 = a*a;
-      for (uint_t b = a+dist; b < n; ++b) {
-        const uint_t b2 = b*b;
-        for (uint_t c = b+dist; c < n; ++c) {
-          const uint_t c2 = c*c;
-          for (uint d = c+dist; d < n; ++d) {
-            const uint_t d2 = d*d;
-            for (uint e = d+dist; e < n; ++e) {
-              const uint e2 = e*e;
-              const uint_t f2 = a2 + b2 + c2 + d2 + e2;
-              if (f2 > n2) break;
-              const uint_t f = std::sqrt(f2);
-              if (f*f != f2) continue;
-              if (f < e+dist) continue;
-              max = std::max(max,f);
-              if (m == 0) ++hn;
-              else res.push_back({{a,b,c,d,e,f}});
-            }
-          }
-        }
-      }
-    }
-  } else {
-    const uint_t n2 = n*n;
-    for (uint_t a = 1; a < n; ++a) {
-      const uint_t a2 = a*a;
-      for (uint_t b = a+dist; b < n; ++b) {
-        const uint_t b2 = b*b;
-        for (uint_t c = b+dist; c < n; ++c) {
-          const uint_t c2 = c*c;
-          for (uint d = c+dist; d < n; ++d) {
-            const uint_t d2 = d*d;
-            for (uint e = d+dist; e < n; ++e) {
-              const uint e2 = e*e;
-              for (uint f = e+dist; f < n; ++f) {
-                const uint f2 = f*f;
-                const uint_t g2 = a2 + b2 + c2 + d2 + e2 + f2;
-                if (g2 > n2) break;
-                const uint_t g = std::sqrt(g2);
-                if (g*g != g2) continue;
-                if (g < f+dist) continue;
-                max = std::max(max,g);
-                if (m == 0) ++hn;
-                else res.push_back({{a,b,c,d,e,f,g}});
-              }
-            }
-          }
-        }
-      }
-    }
-  }
+  Pythagorean::tuples(n, K, dist, m, nt, res, max, hn);
 
   if (m == 0) {
     *out << max << " " << hn << " " <<
@@ -1564,13 +1764,13 @@ int main(const int argc, const char* const argv[]) {
   // removing duplicates:
   for (auto& x : res) x.erase(std::unique(x.begin(), x.end()), x.end());
 
-  if (K >= 5 and dist == 0) Subsumption::min_elements(res,max);
+  if (K >= 5 and dist == 0) Subsumption::min_elements(res,max,nt);
 
   const cnum_t after_subs_hn = res.size();
   // Core-reduction and vertex-degrees:
   typedef std::vector<cnum_t> stat_vec_t;
   stat_vec_t degree(max+1, 0);
-  Reduction::core_red(res, degree, m);
+  Reduction::core_red(res, degree, m, nt);
 
   hn = res.size();
   hn_output(out, orig_hn, after_subs_hn, hn, m, K, dist);
@@ -1624,18 +1824,18 @@ int main(const int argc, const char* const argv[]) {
   if (is_strict(format)) max = occ_n;
   if (m == 1) {
     degree_output(out, occ_n, min_d, max_d, min_v, max_v, sum_d, m, translation, renaming);
-    output_colouring_problem(out, res, m, cnum_t(max), hn, degree, max_v, translation, symm_break, renaming);
+    output_colouring_problem(out, res, m, cnum_t(max), hn, degree, max_v, translation, symm_break, renaming, buffered);
   }
   else if (m == 2) {
     degree_output(out, occ_n, min_d, max_d, min_v, max_v, sum_d, m, translation, renaming);
     const cnum_t cn = num_cl(max,m,hn,translation,symm_break);
-    output_colouring_problem(out, res, m, cnum_t(max), cn, degree, max_v, translation, symm_break, renaming);
+    output_colouring_problem(out, res, m, cnum_t(max), cn, degree, max_v, translation, symm_break, renaming, buffered);
  } else {
     assert(m >= 3);
     *out << "c Using translation " << translation << ".\n";
     degree_output(out, occ_n, min_d, max_d, min_v, max_v, sum_d, m, translation, renaming);
     const cnum_t vn = num_var<cnum_t>(max,m,translation);
     const cnum_t cn = num_cl(occ_n, m, hn, translation, symm_break);
-    output_colouring_problem(out, res, m, vn, cn, degree, max_v, translation, symm_break, renaming);
+    output_colouring_problem(out, res, m, vn, cn, degree, max_v, translation, symm_break, renaming, buffered);
   }
 }
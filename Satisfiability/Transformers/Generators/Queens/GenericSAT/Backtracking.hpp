@@ -1,5 +1,5 @@
 // Oliver Kullmann, 6.7.2018 (Swansea)
-/* Copyright 2018, 2019, 2020 Oliver Kullmann
+/* Copyright 2018, 2019, 2020, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -27,7 +27,9 @@ License, or any later version. */
   - class FullStatsRC comprising both types of statistics
 
   - prototype EmptyCACHING for caching-functionality
-  - class CountSatRC<ACLS, Branching, CACHING, USAT>
+  - class CountSatRC<ACLS, Branching, CACHING, USAT>, optionally
+    distributing the root-branches over several threads (if CACHING is
+    concurrent)
 
 */
 
@@ -96,6 +98,9 @@ License, or any later version. */
 #include <ostream>
 #include <algorithm>
 #include <type_traits>
+#include <vector>
+#include <future>
+#include <atomic>
 
 #include <cmath>
 #include <cassert>
@@ -298,6 +303,7 @@ namespace Backtracking {
     Count_t r2s;
     Count_t r2u;
     Count_t cache_hits;
+    Count_t cache_misses; // nodes computed and then inserted into the cache
     static Environment::OP op;
   };
   Environment::OP StatisticsRC::op;
@@ -319,6 +325,7 @@ namespace Backtracking {
       s.r2s += x.r2s;
       s.r2u += x.r2u;
       s.cache_hits += x.cache_hits;
+      s.cache_misses += x.cache_misses;
     }
     ++s.height; ++s.nodes;
     StatisticsRC::Var_uint hs_width = 0;
@@ -371,6 +378,7 @@ namespace Backtracking {
           << DWW{"r2_sat"} << s.r2s << "\n"
           << DWW{"r2_unsat"} << s.r2u << "\n"
           << DWW{"cache_hits"} << s.cache_hits << "\n"
+          << DWW{"cache_misses"} << s.cache_misses << "\n"
           << DWW{"q=leaves/sols"} << Wrap(float80(s.leaves) / (s.solutions)) << "\n";
     }
     else if (StatisticsRC::op == OP::explained) {
@@ -384,12 +392,14 @@ namespace Backtracking {
           << "  Number of satisfying r2-reduction: " << s.r2s << "\n"
           << "  Number of falsifying r2_reductions: " << s.r2u << "\n"
           << "  Number of cache_hits: " << s.cache_hits << "\n"
+          << "  Number of cache_misses: " << s.cache_misses << "\n"
           << "  Quotient leaves/sols: " << Wrap(float80(s.leaves) / (s.solutions)) << "\n";
     }
     else if (Environment::isR(StatisticsRC::op) or StatisticsRC::op == OP::simple) {
       out << " " << s.solutions << " " << s.nodes << " " << s.leaves <<
           " " << s.height << " " << s.maxusat_nodes << " " << s.hs <<
           " " << s.r2s << " " << s.r2u << " " << s.cache_hits << " " <<
+          s.cache_misses << " " <<
           std::defaultfloat << Wrap(float80(s.leaves) / (s.solutions));
     }
     return out;
@@ -399,20 +409,23 @@ namespace Backtracking {
     using Count_t = ChessBoard::Count_t;
     Count_t cache_size;
     double load_factor;
+    Count_t evictions;
   };
   std::ostream& operator <<(std::ostream& out, const GlobalStatsRC& s) {
     using Environment::OP;
     if (StatisticsRC::op == OP::dimacs) {
       using Environment::DWW;
       out << DWW{"max_cache_size"} << s.cache_size << "\n"
-          << DWW{"final_load_factor"} << s.load_factor << "\n";
+          << DWW{"final_load_factor"} << s.load_factor << "\n"
+          << DWW{"cache_evictions"} << s.evictions << "\n";
     }
     else if (StatisticsRC::op == OP::explained) {
       out << "  Final number of elements in cache: " << s.cache_size << "\n"
-          << "  Final load-factor: " << s.load_factor << "\n";
+          << "  Final load-factor: " << s.load_factor << "\n"
+          << "  Number of cache-evictions: " << s.evictions << "\n";
     }
     else if (Environment::isR(StatisticsRC::op) or StatisticsRC::op == OP::simple) {
-      out << " " << s.cache_size << " " << s.load_factor;
+      out << " " << s.cache_size << " " << s.load_factor << " " << s.evictions;
     }
     return out;
   }
@@ -429,8 +442,10 @@ namespace Backtracking {
   // Empty prototype of class providing caching-functionality:
   struct EmptyCACHING {
     typedef ChessBoard::Count_t size_t;
+    static constexpr bool concurrent = true;
     static size_t size() {return 0;}
     static double load_factor() {return 0;}
+    static size_t evictions() {return 0;}
     static void init(ChessBoard::coord_t) {}
     // types cache_t, return_t = std::optional<Count_t>
     // static functions:
@@ -457,20 +472,33 @@ namespace Backtracking {
 
     const coord_t N;
     const ACLS F;
-    CountSatRC(const coord_t N) : N(N), F(N) {};
+    // Number of threads for the root-branches (only if CACHING::concurrent):
+    const unsigned threads;
+    CountSatRC(const coord_t N, const unsigned threads = 1) :
+      N(N), F(N), threads(threads) {};
 
     FullStatsRC operator()() const {
       CACHING::init(N);
-      const auto res = operator()(F);
-      const GlobalStatsRC gs{CACHING::size(), CACHING::load_factor()};
+      const auto res = threads >= 2 and CACHING::concurrent ?
+        parallel_root() : operator()(F);
+      const GlobalStatsRC gs{CACHING::size(), CACHING::load_factor(),
+                             CACHING::evictions()};
       return {res, gs};
     }
     // Invariant: F.satisfied() = F.falsified() = false, and also
     // USAT::test yields false, if applicable.
     StatisticsRC operator()(const ACLS& F) const {
+      StatisticsRC_v stats;
+      for_children(F, [this, &stats](const ACLS& G){ branch(G, stats); });
+      return sum(stats);
+    }
+
+  private :
+
+    template <class FUN>
+    void for_children(const ACLS& F, FUN&& f) const {
       const auto [index, row] = Branching(F)();
       assert(1 <= index and index <= N);
-      StatisticsRC_v stats;
       if (row) {
         assert(F.board().r_rank(index).o >= 1);
         const auto& R = F.board()()[index];
@@ -478,7 +506,7 @@ namespace Backtracking {
           if (R[j] != ChessBoard::State::open) continue;
           ACLS G(F);
           G.set({index, j}, true);
-          branch(G, stats);
+          f(G);
         }
       }
       else {
@@ -488,13 +516,32 @@ namespace Backtracking {
           if (not F.board().open(bv)) continue;
           ACLS G(F);
           G.set(bv, true);
-          branch(G, stats);
+          f(G);
         }
       }
-      return sum(stats);
     }
 
-  private :
+    /* The root-branches are handed out one by one to the threads; the
+       solution-count is exact, while the other statistics (concerning
+       the cache) depend on the timing of the threads:
+    */
+    StatisticsRC parallel_root() const {
+      std::vector<ACLS> children;
+      for_children(F, [&children](const ACLS& G){ children.push_back(G); });
+      const auto n = children.size();
+      std::vector<StatisticsRC_v> stats(n);
+      std::atomic<std::size_t> next = 0;
+      const auto work = [&, this]{
+        for (std::size_t i; (i = next++) < n;) branch(children[i], stats[i]);
+      };
+      std::vector<std::future<void>> workers;
+      for (unsigned t = 0; t < std::min(std::size_t(threads), n); ++t)
+        workers.push_back(std::async(std::launch::async, work));
+      for (auto& w : workers) w.get();
+      StatisticsRC_v all;
+      for (const auto& v : stats) all.insert(all.end(), v.begin(), v.end());
+      return sum(all);
+    }
 
     void branch(const ACLS& G, StatisticsRC_v& stats) const {
       if (G.satisfied()) {
@@ -516,7 +563,8 @@ namespace Backtracking {
         if (const auto found = CACHING::find(hash, G.board()))
           stats.push_back(cachestatsrc(*found));
         else {
-          const auto s = operator()(G);
+          auto s = operator()(G);
+          ++s.cache_misses;
           [[maybe_unused]] const bool inserted =
             CACHING::insert(hash, s.solutions);
           assert(inserted);
@@ -1,5 +1,5 @@
 // Oliver Kullmann, 30.7.2019 (Swansea)
-/* Copyright 2019, 2020 Oliver Kullmann
+/* Copyright 2019, 2020, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -26,20 +26,34 @@ License, or any later version. */
   - class FullCaching_map
 
   - helper type-traits memman ("memory management")
+  - function template find_sym (lookup of the 8 symmetric variants)
   - class template FullSymCaching<MAP>
   - instantiations FullSymCaching_map, FullSymCaching_hash
 
+  - scoped enum EP (eviction policies)
+  - function depth(ClosedLines)
+  - class BoundedSymCaching (bounded memory, thread-safe)
+
+  All caching-classes provide the static functions init, size,
+  load_factor, evictions, hash, find, insert, and the static member
+  concurrent (whether find and insert may be called from several
+  threads at the same time).
+
 */
 
 /* TODOS:
 
 0. Enter the experimental results.
 
-1. Provide restricted caching-versions
+1. DONE (BoundedSymCaching, with eviction-policy EP::depth)
+   Provide restricted caching-versions
     - Easiest seems to start with caching only nodes with depth
       <= N/k for a given constant k.
 
-3. Provide parallelisation (threads)
+3. PARTIALLY DONE (BoundedSymCaching is thread-safe, and CountSatRC
+   can distribute the root-branches over threads; a node whose count
+   is not yet in the cache is computed by each thread needing it)
+   Provide parallelisation (threads)
     - map_t (as now in FullCaching_map) should be a map from ClosedLines
       to some a pair of Count_t and a vector of iterator's into the map --
       these are the counts for cache-values which where unknown at the
@@ -61,8 +75,14 @@ License, or any later version. */
 #include <bitset>
 #include <optional>
 #include <functional>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <bit>
+#include <algorithm>
 
 #include <cstdint>
+#include <cassert>
 
 #include "Numerics/FloatingPoint.hpp"
 
@@ -176,14 +196,16 @@ namespace Caching {
     none = 0,
     full_ordered = 1,
     fullsym_ordered = 2,
-    fullsym_unordered = 3
+    fullsym_unordered = 3,
+    bounded_sym = 4
   };
   // "full" : all internal nodes
   // "ordered": using std::map
   // "unordered": using std::unordered_map
   // "sym": using the 8 symmetries
+  // "bounded": sharded hash-table with memory-budget (BoundedSymCaching)
 
-  constexpr int maxCS = int(CS::fullsym_unordered);
+  constexpr int maxCS = int(CS::bounded_sym);
   constexpr int maxCachOptions = Caching::maxCS;
 
   std::ostream& operator <<(std::ostream& out, const CS cs) {
@@ -192,6 +214,7 @@ namespace Caching {
       case CS::full_ordered : return out << "full_ordered";
       case CS::fullsym_ordered : return out << "fullsym_ordered";
       case CS::fullsym_unordered : return out << "fullsym_unordered";
+      case CS::bounded_sym : return out << "bounded_sym";
       default : return out << "CS_uncovered:" << int(cs);
     }
   }
@@ -204,11 +227,13 @@ namespace Caching {
     typedef map_t::const_iterator iterator;
     static map_t M;
   public :
+    static constexpr bool concurrent = false;
     static void init(const ChessBoard::coord_t) noexcept {}
     typedef ClosedLines cache_t;
     typedef map_t::size_type size_t;
     static size_t size() noexcept { return M.size(); }
     static double load_factor() noexcept { return 1; }
+    static size_t evictions() noexcept { return 0; }
     typedef std::optional<Count_t> return_t;
     static cache_t hash(const Board& B) noexcept {
       return used_lines(B);
@@ -228,6 +253,39 @@ namespace Caching {
   template <class K, class T, class H, class E, class A>
   struct memman<std::unordered_map<K,T,H,E,A>> {static constexpr bool v=true;};
 
+  /* Applying the 8 symmetries of the board to the closed lines h of B,
+     and returning the first value found by lookup(ClosedLines) (which
+     returns std::optional<Count_t>):
+  */
+  template <class LOOKUP>
+  std::optional<Count_t> find_sym(const ClosedLines& h, const ChessBoard::Board& B, LOOKUP&& lookup) {
+    const auto [D,A,R,C] = h;
+
+    if (const auto r = lookup({D,A,R,C})) return r;
+
+    const auto iD = used_da_inverse(B.d_rank(), B.N);
+    // reflexion main-diagonal:
+    if (const auto r = lookup({iD,A,C,R})) return r;
+
+    const auto iR = used_rc_inverse(B.r_rank(), B.N);
+    // reflexion horizontal:
+    if (const auto r = lookup({A,D,iR,C})) return r;
+
+    const auto iC = used_rc_inverse(B.c_rank(), B.N);
+    // rotation 270:
+    if (const auto r = lookup({A,iD,iC,R})) return r;
+
+    const auto iA = used_da_inverse(B.ad_rank(), B.N);
+    // rotation 180 (point-symmetry):
+    if (const auto r = lookup({iD,iA,iR,iC})) return r;
+    // rotation 90:
+    if (const auto r = lookup({iA,D,C,iR})) return r;
+    // reflexion main-anti-diagonal:
+    if (const auto r = lookup({D,iA,iC,iR})) return r;
+    // reflexion vertical:
+    return lookup({iA,iD,R,iC});
+  }
+
   template <class MAP>
   class FullSymCaching {
     typedef ChessBoard::Board Board;
@@ -235,6 +293,7 @@ namespace Caching {
     typedef typename map_t::iterator iterator;
     static map_t M;
   public :
+    static constexpr bool concurrent = false;
     static constexpr bool has_memory_management = memman<map_t>::v;
     // Anticipated quotient cache_size / number_solutions:
     static constexpr FloatingPoint::float80 quot = 2;
@@ -253,6 +312,7 @@ namespace Caching {
         return M.load_factor();
       else return 1;
     }
+    static size_t evictions() noexcept { return 0; }
 
     static cache_t hash(const Board& B) noexcept {
       return used_lines(B);
@@ -260,32 +320,10 @@ namespace Caching {
     typedef std::optional<Count_t> return_t;
     static return_t find(const cache_t& h, const Board& B) noexcept {
       const iterator end = M.end();
-      const auto [D,A,R,C] = h;
-
-      if (const auto it = M.find({D,A,R,C}); it != end) return it->second;
-
-      const auto iD = used_da_inverse(B.d_rank(), B.N);
-      // reflexion main-diagonal:
-      if (const auto it = M.find({iD,A,C,R}); it != end) return it->second;
-
-      const auto iR = used_rc_inverse(B.r_rank(), B.N);
-      // reflexion horizontal:
-      if (const auto it = M.find({A,D,iR,C}); it != end) return it->second;
-
-      const auto iC = used_rc_inverse(B.c_rank(), B.N);
-      // rotation 270:
-      if (const auto it = M.find({A,iD,iC,R}); it != end) return it->second;
-
-      const auto iA = used_da_inverse(B.ad_rank(), B.N);
-      // rotation 180 (point-symmetry):
-      if (const auto it = M.find({iD,iA,iR,iC}); it != end) return it->second;
-      // rotation 90:
-      if (const auto it = M.find({iA,D,C,iR}); it != end) return it->second;
-      // reflexion main-anti-diagonal:
-      if (const auto it = M.find({D,iA,iC,iR}); it != end) return it->second;
-      // reflexion vertical:
-      if (const auto it = M.find({iA,iD,R,iC}); it != end) return it->second;
-      return {};
+      return find_sym(h, B, [end](const ClosedLines& cl) -> return_t {
+        if (const auto it = M.find(cl); it != end) return it->second;
+        else return {};
+      });
     }
     static bool insert(const cache_t& h, const Count_t c) {
       return M.emplace(h, c).second;
@@ -298,6 +336,181 @@ namespace Caching {
   typedef FullSymCaching<std::unordered_map<ClosedLines, Count_t, HashClosedLines>> FullSymCaching_hash;
   static_assert(FullSymCaching_hash::has_memory_management);
 
+
+  // Eviction policies for bounded caching:
+  enum class EP {
+    depth = 0, // evict the deepest entry, never admit a deeper one
+    hits = 1 // evict the entry with the fewest hits
+  };
+  constexpr int maxEP = int(EP::hits);
+  std::ostream& operator <<(std::ostream& out, const EP ep) {
+    switch(ep) {
+      case EP::depth : return out << "depth";
+      case EP::hits : return out << "hits";
+      default : return out << "EP_uncovered:" << int(ep);
+    }
+  }
+
+  // The depth of the node (the number of placed queens):
+  inline unsigned depth(const ClosedLines& cl) noexcept {
+    return std::popcount(cl.r);
+  }
+
+  /* Symmetric caching with bounded memory, usable from several threads:
+
+      - configure(budget, policy, shards) sets the memory-budget (in
+        bytes), the eviction-policy and the number of shards (rounded
+        down to a power of 2), to be called before init(N), which
+        allocates and clears the table; the size of the table is the
+        anticipated cache-size for N (at load-factor max_load_factor), if
+        this is below the budget.
+      - The table is split into shards, each with its own mutex; a shard
+        consists of buckets with "ways"-many entries each (so that the
+        memory is allocated once, in init).
+      - A key is placed into its bucket; if the bucket is full, then one
+        entry is evicted according to the policy (for EP::depth a key
+        deeper than all entries of the bucket is not admitted, which is
+        also counted as an eviction).
+      - insert(h, c) always returns true: if h is already in the table
+        (computed in the meantime by another thread), then nothing
+        happens.
+  */
+  class BoundedSymCaching {
+    typedef ChessBoard::Board Board;
+    struct Entry {
+      ClosedLines key;
+      Count_t count;
+      std::uint32_t hits;
+      std::uint32_t used;
+    };
+    static_assert(is_pod(Entry));
+    struct alignas(64) Shard {
+      std::mutex m;
+      Count_t size = 0, evictions = 0;
+      std::vector<Entry> E; // buckets * ways entries
+    };
+    static constexpr std::size_t ways = 4;
+
+    static std::size_t budget, num_shards, buckets;
+    static EP policy;
+    static std::unique_ptr<Shard[]> S;
+
+  public :
+    static constexpr bool concurrent = true;
+    static constexpr std::size_t default_budget = std::size_t(1) << 30;
+    static constexpr std::size_t default_shards = 64;
+    static constexpr std::size_t entry_size = sizeof(Entry);
+    // Anticipated quotient cache_size / number_solutions (larger than for
+    // FullSymCaching, since the table can not grow):
+    static constexpr FloatingPoint::float80 quot = 4;
+    static constexpr FloatingPoint::float80 max_load_factor = 0.5;
+
+    static void configure(const std::size_t budget_bytes, const EP ep,
+                          const std::size_t shards = default_shards) noexcept {
+      budget = budget_bytes; policy = ep;
+      num_shards = std::bit_floor(std::max(shards, std::size_t(1)));
+    }
+    // The size of the table in bytes (at most the budget):
+    static std::size_t table_bytes(const ChessBoard::coord_t N) noexcept {
+      const FloatingPoint::float80 anticipated = quot *
+        Recursion::strong_conjecture(N) / max_load_factor * sizeof(Entry);
+      return anticipated >= budget ? budget :
+        FloatingPoint::toUInt(FloatingPoint::ceil(anticipated));
+    }
+    static void init(const ChessBoard::coord_t N) {
+      buckets = std::max(table_bytes(N) / (num_shards * ways * sizeof(Entry)),
+                         std::size_t(1));
+      S = std::make_unique<Shard[]>(num_shards);
+      for (std::size_t i = 0; i < num_shards; ++i)
+        S[i].E.assign(buckets * ways, Entry{});
+    }
+
+    typedef ClosedLines cache_t;
+    typedef Count_t size_t;
+    static size_t capacity() noexcept { return num_shards * buckets * ways; }
+    static size_t size() noexcept {
+      if (not S) return 0;
+      size_t res = 0;
+      for (std::size_t i = 0; i < num_shards; ++i) {
+        std::lock_guard l(S[i].m); res += S[i].size;
+      }
+      return res;
+    }
+    static double load_factor() noexcept {
+      return S ? double(size()) / capacity() : 0;
+    }
+    static size_t evictions() noexcept {
+      if (not S) return 0;
+      size_t res = 0;
+      for (std::size_t i = 0; i < num_shards; ++i) {
+        std::lock_guard l(S[i].m); res += S[i].evictions;
+      }
+      return res;
+    }
+
+    static cache_t hash(const Board& B) noexcept {
+      return used_lines(B);
+    }
+    typedef std::optional<Count_t> return_t;
+    static return_t find(const cache_t& h, const Board& B) {
+      return find_sym(h, B, lookup);
+    }
+    static bool insert(const cache_t& h, const Count_t c) {
+      assert(S);
+      const auto [shard, first] = position(h);
+      std::lock_guard l(shard.m);
+      Entry* const begin = shard.E.data() + first;
+      Entry* const end = begin + ways;
+      for (Entry* e = begin; e != end; ++e)
+        if (not e->used) {
+          *e = {h, c, 0, 1}; ++shard.size; return true;
+        }
+        else if (e->key == h) { assert(e->count == c); return true; }
+      ++shard.evictions;
+      Entry* victim = begin;
+      if (policy == EP::depth) {
+        for (Entry* e = begin+1; e != end; ++e) {
+          const auto de = depth(e->key), dv = depth(victim->key);
+          if (de > dv or (de == dv and e->hits < victim->hits)) victim = e;
+        }
+        if (depth(h) > depth(victim->key)) return true;
+      }
+      else
+        for (Entry* e = begin+1; e != end; ++e)
+          if (e->hits < victim->hits or (e->hits == victim->hits and
+                depth(e->key) > depth(victim->key))) victim = e;
+      *victim = {h, c, 0, 1};
+      return true;
+    }
+
+  private :
+
+    // splitmix64-finaliser, since the high bits of HashClosedLines are weak:
+    static constexpr std::uint64_t mix(std::uint64_t x) noexcept {
+      x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9;
+      x = (x ^ (x >> 27)) * 0x94d049bb133111eb;
+      return x ^ (x >> 31);
+    }
+    static std::pair<Shard&, std::size_t> position(const ClosedLines& cl) noexcept {
+      const std::uint64_t x = mix(HashClosedLines()(cl));
+      return {S[x & (num_shards - 1)], ((x >> 32) % buckets) * ways};
+    }
+    static return_t lookup(const ClosedLines& cl) {
+      const auto [shard, first] = position(cl);
+      std::lock_guard l(shard.m);
+      for (std::size_t i = first; i < first + ways; ++i) {
+        Entry& e = shard.E[i];
+        if (e.used and e.key == cl) { ++e.hits; return e.count; }
+      }
+      return {};
+    }
+  };
+  std::size_t BoundedSymCaching::budget = BoundedSymCaching::default_budget;
+  std::size_t BoundedSymCaching::num_shards = BoundedSymCaching::default_shards;
+  std::size_t BoundedSymCaching::buckets = 0;
+  EP BoundedSymCaching::policy = EP::depth;
+  std::unique_ptr<BoundedSymCaching::Shard[]> BoundedSymCaching::S;
+
 }
 
 #endif
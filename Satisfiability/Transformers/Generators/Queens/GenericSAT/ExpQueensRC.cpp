@@ -1,5 +1,5 @@
 // Oliver Kullmann, 25.7.2019 (Swansea)
-/* Copyright 2019, 2020 Oliver Kullmann
+/* Copyright 2019, 2020, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -29,7 +29,14 @@ Caching schemes (from Caching::CS):
 0 : none
 1 : full caching, using std::map
 2 : full symmetric caching, using std::map
-2 : full symmetric caching, using std::unordered_map
+3 : full symmetric caching, using std::unordered_map
+4 : bounded symmetric caching, using a sharded hash-table with
+    memory-budget and eviction-policy (thread-safe)
+
+Eviction policies (from Caching::EP):
+
+0 : depth (evict the deepest entries)
+1 : hits (evict the entries with the fewest hits)
 
 Symmetry breaking schemes:
 
@@ -91,14 +98,15 @@ Symmetry breaking schemes:
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.8.0",
-        "2.6.2020",
+        "0.9.1",
+        "16.10.2026",
         __FILE__,
         "Oliver Kullmann",
         "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/Queens/GenericSAT/ExpQueensRC.cpp",
         "GPL v3"};
 
   constexpr ChessBoard::coord_t N_default = 11;
+  constexpr unsigned long budget_default = 1024; // MB
 
   bool show_usage(const int argc, const char* const argv[]) {
     if (not Environment::help_header(std::cout, argc, argv, proginfo))
@@ -113,8 +121,13 @@ namespace {
     " [heuristics=0.." << Heuristics::maxHeurOptions << "]"
     " [caching=0.." << Caching::maxCachOptions << "]"
     " [symmetry-breaking=0,1]"
-    " [output-mode=" << Environment::wrpi(Environment::OP::dimacs) << "]\n\n"
+    " [output-mode=" << Environment::wrpi(Environment::OP::dimacs) << "]"
+    " [cache-budget-MB=" << budget_default << "]"
+    " [eviction=0.." << Caching::maxEP << "]"
+    " [threads=1]\n\n"
     " computes the solution-count and statistics for the board of dimension N.\n"
+    " The last three arguments only concern caching=" << int(Caching::CS::bounded_sym) << ";\n"
+    " more than one thread is only possible for caching=0," << int(Caching::CS::bounded_sym) << ".\n"
     "\nThe different output-modes are:\n"
     "  - d = Dimacs\n"
     "  - s = simple\n"
@@ -138,7 +151,7 @@ namespace {
   }
 
   void output_R_attributes() {
-    std::cout << " N heur cache syb sol nds lvs h munds hts r2s r2u chts q mcs flf t mem" << std::endl;
+    std::cout << " N heur cache syb sol nds lvs h munds hts r2s r2u chts cmis q mcs flf cev t mem" << std::endl;
   }
 
   template <class BRANCHING, class CACHING=Backtracking::EmptyCACHING>
@@ -152,17 +165,18 @@ namespace {
   using FCm = Caching::FullCaching_map;
   using FSCm = Caching::FullSymCaching_map;
   using FSCh = Caching::FullSymCaching_hash;
+  using BSC = Caching::BoundedSymCaching;
 
   template <Heuristics::LRC h, class CACHING=Backtracking::EmptyCACHING>
   using CSIBLRC = CSRC<Heuristics::InitialSymBreaking<Heuristics::ByLengthRC<h>>, CACHING>;
   template <Heuristics::FRC h, class CACHING=Backtracking::EmptyCACHING>
   using CSIFRC = CSRC<Heuristics::InitialSymBreaking<Heuristics::ByFirstRC<h>>, CACHING>;
 
-#define MLR(co) (symbreak?CSIBLRC<co>(N)():CSBLRC<co>(N)())
-#define MLRC(co,ca) (symbreak?CSIBLRC<co,ca>(N)():CSBLRC<co,ca>(N)())
+#define MLR(co) (symbreak?CSIBLRC<co>(N,threads)():CSBLRC<co>(N,threads)())
+#define MLRC(co,ca) (symbreak?CSIBLRC<co,ca>(N,threads)():CSBLRC<co,ca>(N,threads)())
 
-#define MFR(co) (symbreak?CSIFRC<co>(N)():CSFRC<co>(N)())
-#define MFRC(co,ca) (symbreak?CSIFRC<co,ca>(N)():CSFRC<co,ca>(N)())
+#define MFR(co) (symbreak?CSIFRC<co>(N,threads)():CSFRC<co>(N,threads)())
+#define MFRC(co,ca) (symbreak?CSIFRC<co,ca>(N,threads)():CSFRC<co,ca>(N,threads)())
 
 }
 
@@ -189,7 +203,22 @@ int main(const int argc, const char* const argv[]) {
   const OP output_choice = (argc <= index) ? OP::dimacs :
     std::get<OP>(Environment::translate<OP>()(argv[index++], ','));
   Backtracking::StatisticsRC::op = output_choice;
+  const unsigned long budget = argc <= index ? budget_default : std::stoul(argv[index++]);
+  const int eviction0 = argc <= index ? int(Caching::EP::depth) : std::stoi(argv[index++]);
+  const unsigned threads = argc <= index ? 1 : std::stoul(argv[index++]);
   index.deactivate();
+  if (eviction0 < 0 or eviction0 > Caching::maxEP) {
+    std::cerr << "ERROR[" << proginfo.prg << "]: eviction=" << eviction0 <<
+      " must be in 0.." << Caching::maxEP << ".\n";
+    return 1;
+  }
+  const Caching::EP eviction = Caching::EP(eviction0);
+  if (threads >= 2 and caching != CS::none and caching != CS::bounded_sym) {
+    std::cerr << "ERROR[" << proginfo.prg << "]: threads=" << threads <<
+      " requires caching 0 or " << int(CS::bounded_sym) << ".\n";
+    return 1;
+  }
+  Caching::BoundedSymCaching::configure(budget << 20, eviction);
 
   if (output_choice != OP::rh)
     std::cout << Environment::Wrap(proginfo, output_choice);
@@ -206,6 +235,9 @@ int main(const int argc, const char* const argv[]) {
               << DWW{"N"} << N << "\n"
               << DWW{"caching"} << caching << "\n"
               << DWW{"symmetry-breaking"} << symbreak << "\n"
+              << DWW{"cache-budget-MB"} << budget << "\n"
+              << DWW{"eviction"} << eviction << "\n"
+              << DWW{"threads"} << threads << "\n"
 ;
   }
   else if (output_choice == OP::rh or output_choice == OP::rf)
@@ -221,7 +253,10 @@ int main(const int argc, const char* const argv[]) {
       std::cout << Heuristics::LRC(heuristics);
     else std::cout << Heuristics::FRC(heuristics);
     std::cout << "\n  Caching: " << caching << "\n";
-    std::cout << "  Symmetry-breaking: " << std::boolalpha << symbreak << "\n\n";
+    std::cout << "  Symmetry-breaking: " << std::boolalpha << symbreak << "\n";
+    std::cout << "  Cache-budget (MB): " << budget << "\n"
+              << "  Eviction-policy: " << eviction << "\n"
+              << "  Threads: " << threads << "\n\n";
   }
   if (Environment::isR(output_choice) or output_choice == OP::simple)
     std::cout << N << " " << heuristics << " " << int(caching) << " " << symbreak;
@@ -240,36 +275,42 @@ int main(const int argc, const char* const argv[]) {
       case CS::none : cout << MLR(LRC::max); goto END;
       case CS::full_ordered : cout << MLRC(LRC::max,FCm); goto END;
       case CS::fullsym_ordered : cout << MLRC(LRC::max,FSCm); goto END;
+      case CS::bounded_sym : cout << MLRC(LRC::max,BSC); goto END;
       default : cout << MLRC(LRC::max,FSCh); goto END;}
     case LRC::minrows :
       switch (caching) {
       case CS::none : cout << MLR(LRC::minrows); goto END;
       case CS::full_ordered : cout << MLRC(LRC::minrows,FCm); goto END;
       case CS::fullsym_ordered : cout << MLRC(LRC::minrows,FSCm); goto END;
+      case CS::bounded_sym : cout << MLRC(LRC::minrows,BSC); goto END;
       default : cout << MLRC(LRC::minrows,FSCh); goto END;}
     case LRC::maxrows :
       switch (caching) {
       case CS::none : cout << MLR(LRC::maxrows); goto END;
       case CS::full_ordered : cout << MLRC(LRC::maxrows,FCm); goto END;
       case CS::fullsym_ordered : cout << MLRC(LRC::maxrows,FSCm); goto END;
+      case CS::bounded_sym : cout << MLRC(LRC::maxrows,BSC); goto END;
       default : cout << MLRC(LRC::maxrows,FSCh); goto END;}
     case LRC::mincolumns :
       switch (caching) {
       case CS::none : cout << MLR(LRC::mincolumns); goto END;
       case CS::full_ordered : cout << MLRC(LRC::mincolumns,FCm); goto END;
       case CS::fullsym_ordered : cout << MLRC(LRC::mincolumns,FSCm); goto END;
+      case CS::bounded_sym : cout << MLRC(LRC::mincolumns,BSC); goto END;
       default : cout << MLRC(LRC::mincolumns,FSCh); goto END;}
     case LRC::maxcolumns :
       switch (caching) {
       case CS::none : cout << MLR(LRC::maxcolumns); goto END;
       case CS::full_ordered : cout << MLRC(LRC::maxcolumns,FCm); goto END;
       case CS::fullsym_ordered : cout << MLRC(LRC::maxcolumns,FSCm); goto END;
+      case CS::bounded_sym : cout << MLRC(LRC::maxcolumns,BSC); goto END;
       default : cout << MLRC(LRC::maxcolumns,FSCh); goto END;}
     default :
       switch (caching) {
       case CS::none : cout << MLR(LRC::min); goto END;
       case CS::full_ordered : cout << MLRC(LRC::min,FCm); goto END;
       case CS::fullsym_ordered : cout << MLRC(LRC::min,FSCm); goto END;
+      case CS::bounded_sym : cout << MLRC(LRC::min,BSC); goto END;
       default : cout << MLRC(LRC::min,FSCh); goto END;}
     }
   }
@@ -284,12 +325,14 @@ int main(const int argc, const char* const argv[]) {
       case CS::none : cout << MFR(FRC::column); goto END;
       case CS::full_ordered : cout << MFRC(FRC::column,FCm); goto END;
       case CS::fullsym_ordered : cout << MFRC(FRC::column,FSCm); goto END;
+      case CS::bounded_sym : cout << MFRC(FRC::column,BSC); goto END;
       default : cout << MFRC(FRC::column,FSCh); goto END;}
     default :
       switch (caching) {
       case CS::none : cout << MFR(FRC::row); goto END;
       case CS::full_ordered : cout << MFRC(FRC::row,FCm); goto END;
       case CS::fullsym_ordered : cout << MFRC(FRC::row,FSCm); goto END;
+      case CS::bounded_sym : cout << MFRC(FRC::row,BSC); goto END;
       default : cout << MFRC(FRC::row,FSCh); goto END;}
     }
   }
@@ -1,5 +1,5 @@
 // Oliver Kullmann, 6.8.2018 (Swansea)
-/* Copyright 2018, 2019 Oliver Kullmann
+/* Copyright 2018, 2019, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -55,6 +55,8 @@ License, or any later version. */
 #include <stdexcept>
 #include <numeric>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <cassert>
 
@@ -623,6 +625,76 @@ int main() {
    assert(FullSymCaching_map::size() == 1);
   }
 
+  {using namespace Caching;
+   typedef BoundedSymCaching BSC;
+   static_assert(BSC::concurrent and not FullSymCaching_hash::concurrent);
+   assert(BSC::size() == 0 and BSC::evictions() == 0);
+   // Small N: the table is sized from N (one bucket per shard):
+   BSC::init(8);
+   assert(BSC::table_bytes(8) < (1 << 16));
+   assert(BSC::capacity() == BSC::default_shards * 4);
+   // Large N: the table is sized from the budget:
+   BSC::configure(1 << 20, EP::depth);
+   assert(BSC::table_bytes(17) == 1 << 20);
+   const AmoAlo_board B(17);
+   BSC::init(17);
+   assert(BSC::capacity() >= (1 << 20) / BSC::entry_size / 2);
+   assert(BSC::load_factor() == 0);
+   auto B1(B);
+   B1.set({1,1}, true);
+   const auto h1 = BSC::hash(B1.board());
+   assert(depth(h1) == 1);
+   assert(not BSC::find(h1, B1.board()));
+   assert(BSC::insert(h1, 77));
+   assert(BSC::insert(h1, 77));
+   assert(BSC::size() == 1);
+   assert(BSC::find(h1, B1.board()).value() == 77);
+   auto B2(B);
+   B2.set({1,17}, true);
+   assert(BSC::find(BSC::hash(B2.board()), B2.board()).value() == 77);
+   assert(BSC::evictions() == 0);
+
+   // One shard with one bucket:
+   BSC::configure(0, EP::depth, 1);
+   BSC::init(17);
+   assert(BSC::capacity() == 4);
+   std::vector<ClosedLines> keys;
+   for (unsigned i = 0; i < 4; ++i) keys.push_back({i,0,1,0});
+   for (const auto& k : keys) assert(BSC::insert(k, 1));
+   assert(BSC::size() == 4 and BSC::evictions() == 0);
+   assert(BSC::insert({9,0,3,0}, 2)); // deeper, not admitted
+   assert(BSC::size() == 4 and BSC::evictions() == 1);
+   assert(BSC::insert({9,0,0,0}, 2)); // less deep, admitted
+   assert(BSC::size() == 4 and BSC::evictions() == 2);
+   assert(BSC::load_factor() == 1);
+
+   BSC::configure(0, EP::hits, 1);
+   BSC::init(17);
+   assert(BSC::size() == 0 and BSC::evictions() == 0);
+   for (const auto& k : keys) assert(BSC::insert(k, 1));
+   assert(BSC::insert({9,0,3,0}, 2));
+   assert(BSC::size() == 4 and BSC::evictions() == 1);
+
+   BSC::configure(BSC::default_budget, EP::depth);
+  }
+  {using namespace Caching;
+   // The solution-counts are exact for all caching-schemes and numbers
+   // of threads:
+   typedef Heuristics::ByLengthRC<Heuristics::LRC::min> H;
+   typedef CountSatRC<AmoAlo_board, H, BoundedSymCaching> CB;
+   BoundedSymCaching::configure(1 << 20, EP::depth);
+   for (const unsigned T : {1u, 2u, 5u}) {
+     assert(CB(8, T)().s.solutions == 92);
+     assert((CountSatRC<AmoAlo_board, H>(9, T)().s.solutions == 352));
+   }
+   BoundedSymCaching::configure(0, EP::hits);
+   const auto fs = CB(9, 3)();
+   assert(fs.s.solutions == 352);
+   assert(fs.gs.evictions != 0);
+   assert(fs.s.cache_misses == fs.s.nodes - 1);
+   BoundedSymCaching::configure(BoundedSymCaching::default_budget, EP::depth);
+  }
+
   {using namespace CreateExperiment;
    assert(size({}) == 0);
    assert(size({{0,0},{-1,-1},{min_par_t,min_par_t},{max_par_t,max_par_t}}) == 1);
@@ -1,5 +1,5 @@
 // Oliver Kullmann, 1.7.2020 (Swansea)
-/* Copyright 2020 Oliver Kullmann
+/* Copyright 2020, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -56,7 +56,9 @@ namespace Backtracking {
     typedef typename State::stats stats_t;
     typedef typename State::iterator iterator_t;
 
-    Stack S{{B, stats_t(true), B.cbr().begin()}};
+    // B.cbr() updates the current branching-row of B, before B is copied:
+    const iterator_t first = B.cbr().begin();
+    Stack S{{B, stats_t(true), first}};
     assert(S.size() == max_size_stack+1);
     const auto begin = S.begin();
     for (auto i = begin;;) {
@@ -90,6 +92,23 @@ namespace Backtracking {
       return countnr(B);
   }
 
+
+  // One step of count(B), adding the statistics of node B to s, and
+  // handing the open children to push (for splitting the search-tree):
+  template <class PUSH>
+  void expand(const Board::DoubleSweep& B, Statistics::NodeCounts& s,
+              PUSH&& push) {
+    typedef Rows::Row Row;
+    typedef Board::DoubleSweep board_t;
+    Statistics::NodeCounts res(true);
+    for (const Row new_row : B.cbr()) {
+      board_t Bj(B);
+      Bj.set_cbr(new_row);
+      if (not Bj.ucp(res)) push(Bj);
+    }
+    s += res;
+  }
+
 }
 
 #endif
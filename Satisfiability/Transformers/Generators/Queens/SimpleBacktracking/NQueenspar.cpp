@@ -1,7 +1,7 @@
 // Irfansha Shaik 26.6.2018 (Swansea)
 /*
   Copyright Alessandro Nicolosi 2016, 2017
-  Copyright Oliver Kullmann 2018, 2019
+  Copyright Oliver Kullmann 2018, 2019, 2026
 
 MIT License
 
@@ -21,17 +21,25 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
 OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 
-std::future is used for parallel computation, using N/2 parallel threads.
+By default a work-stealing pool (WorkStealing.hpp) is used, with as many
+threads as hardware-threads; the search-trees for the first row are split
+into tasks up to (excluding) row D=3.
+With T=0, std::future is used for parallel computation, using N/2 parallel
+threads (one per placement in the first row, up to mirror-symmetry).
 
   Usage:
 
-> ./pqcount N
+> ./pqcount N [T] [D] [u]
 
 Output of N and the solution count; e.g.
 
 > ./pqcount 8
 8 92
 
+With "u" for each thread additionally a line
+  w tasks steals busy-time utilisation
+is output.
+
 
 TODOS:
 
@@ -65,12 +73,13 @@ TODOS:
 #include <ProgramOptions/Environment.hpp>
 
 #include "NQueens.hpp"
+#include "WorkStealing.hpp"
 
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.7.4",
-        "6.12.2019",
+        "0.8.0",
+        "16.10.2026",
         __FILE__,
         "Oliver Kullmann",
         "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/Queens/SimpleBacktracking/NQueenspar.cpp",
@@ -80,6 +89,7 @@ using namespace Queens;
 
 constexpr input_t N_default = 15;
 static_assert(N_default <= maxN);
+constexpr input_t D_default = 3;
 
 // The recursive counting-function;
 // using bit-positions 0, ..., N-1 for the columns 1, ..., N:
@@ -121,6 +131,67 @@ inline count_t backtracking(queen_t avail,
   return count;
 }
 
+
+// A node of the search-tree, as given by the arguments of backtracking,
+// with weight 2 or 1 due to mirror-symmetry:
+struct Task {
+  queen_t avail, columns, fdiag, fantid;
+  input_t size;
+  count_t weight;
+};
+typedef WorkStealing::Pool<Task> pool_t;
+
+// The loop of backtracking, handing the children to push:
+template <class PUSH>
+void expand(const Task& t, PUSH&& push) {
+  const queen_t sdiag = t.fdiag>>1, santid = t.fantid<<1;
+  const queen_t newavail0 = ~(t.columns | sdiag | santid) & all_columns;
+  if (not newavail0) return;
+  queen_t avail = t.avail;
+  queen_t next = keeprightmostbit(avail);
+  const input_t sp1 = t.size+1;
+  assert(sp1+1 < N);
+  do {const queen_t nextrs = next>>1, nextls = next<<1,
+        newavail = newavail0 & ~(next | nextrs | nextls);
+    if (newavail)
+      push(Task{newavail, t.columns|next, sdiag|nextrs, santid|nextls,
+                sp1, t.weight});
+  } while (next = keeprightmostbit(avail^=next));
+}
+
+struct alignas(64) Count { count_t c = 0; }; // per thread
+
+count_t ws_count(pool_t& P, const input_t cutoff) {
+  pool_t::task_v init;
+  // Using mirror-symmetry around vertical axis:
+  for (input_t i = 0; i < N/2; ++i) init.push_back({one(i), 0, 0, 0, 0, 2});
+  if (N % 2 == 1) init.push_back({one(N/2), 0, 0, 0, 0, 1});
+  std::vector<Count> counts(P.threads());
+  P.run(init, [&P, &counts, cutoff](const Task& t, const unsigned w) {
+    if (t.size < cutoff and t.size+2 < N)
+      expand(t, [&P, w](const Task& c){ P.push(w, c); });
+    else
+      counts[w].c += t.weight *
+        backtracking(t.avail, t.columns, t.fdiag, t.fantid, t.size);
+  });
+  count_t count = 0;
+  for (const Count& c : counts) count += c.c;
+  return count;
+}
+
+count_t async_count() {
+  typedef std::future<count_t> future_t;
+  std::vector<future_t> futures;
+  for (input_t i = 0; i < N/2; ++i)
+    futures.push_back(std::async(std::launch::async, backtracking, one(i), 0, 0, 0, 0));
+  count_t count = 0;
+  for (auto& e : futures) count += e.get();
+  count *= 2;
+  if (N % 2 == 1)
+    count += std::async(std::launch::async, backtracking, one(N/2), 0, 0, 0, 0).get();
+  return count;
+}
+
   bool show_usage(const int argc, const char* const argv[]) {
     assert(argc >= 1);
     if (argc != 2 or not Environment::is_help_string(argv[1])) return false;
@@ -130,9 +201,13 @@ inline count_t backtracking(queen_t avail,
     " shows version information and exits.\n"
     "> " << program << " [-h | --help]\n"
     " shows help information and exits.\n"
-    "> " << program << " N\n"
-    " computes the solution-count for the board of dimension N.\n"
-    "The default-value of N is " << (unsigned long) N_default << ".\n"
+    "> " << program << " N [T] [D] [u]\n"
+    " computes the solution-count for the board of dimension N, using\n"
+    " T threads, splitting the search-tree up to row D, and with \"u\"\n"
+    " outputting per thread tasks, steals, busy-time, utilisation.\n"
+    " T=0 means one thread per first-row placement (up to symmetry).\n"
+    "The default-values are N=" << (unsigned long) N_default <<
+    ", T=number of hardware-threads, D=" << (unsigned long) D_default << ".\n"
 ;
     return true;
   }
@@ -150,28 +225,14 @@ int main(const int argc, const char* const argv[]) {
     std::cerr << " N <= " << (unsigned long) maxN << " required.\n"; return 1;
   }
   N = arg1;
+  const unsigned T = argc < 3 ? WorkStealing::default_threads() :
+    std::stoul(argv[2]);
+  const input_t D = argc < 4 ? D_default : std::stoul(argv[3]);
+  const bool show_util = argc >= 5 and std::string(argv[4]) == "u";
   std::cout << (unsigned long) N << " "; std::cout.flush();
 
-  typedef std::future<count_t> future_t;
   all_columns = setrightmostbits(N);
-  // Using mirror-symmetry around vertical axis:
-  if (N % 2 == 0) {
-    std::vector<future_t> futures;
-    for (input_t i = 0; i < N/2; ++i)
-      futures.push_back(std::async(std::launch::async, backtracking, one(i), 0, 0, 0, 0));
-    count_t count = 0;
-    for (auto& e : futures) count += e.get();
-    count *= 2;
-    std::cout << count << "\n";
-  } else {
-    std::vector<future_t> futures;
-    for (input_t i = 0; i < N/2; ++i)
-      futures.push_back(std::async(std::launch::async, backtracking, one(i), 0, 0, 0, 0));
-    future_t mid = std::async(std::launch::async, backtracking, one(N/2), 0, 0, 0, 0);
-    count_t count = 0;
-    for (auto& e : futures) count += e.get();
-    count *= 2;
-    count += mid.get();
-    std::cout << count << "\n";
-  }
+  pool_t P(T);
+  std::cout << (T == 0 ? async_count() : ws_count(P, D)) << "\n";
+  if (show_util and T != 0) WorkStealing::output_utilisation(std::cout, P);
 }
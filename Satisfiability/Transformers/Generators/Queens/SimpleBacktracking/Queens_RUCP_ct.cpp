@@ -1,5 +1,5 @@
 // Oliver Kullmann 25.4.2020 (Swansea)
-/* Copyright 2020, 2022 Oliver Kullmann
+/* Copyright 2020, 2022, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -19,7 +19,35 @@ USAGE:
 16 1 0 0  14772512 47318154 179766962 7386256 64236195 5735944
 
 uses the built-in N (N=16 by default), and outputs statistics (see below).
-floor((N+1)/2) parallel threads are used.
+By default a work-stealing pool (WorkStealing.hpp) with as many threads
+as hardware-threads is used, splitting the search-trees of the root-branches
+(after symmetry-breaking) up to depth D=2 (below the root-branches) into tasks:
+
+> ./Queens_RUCP_ct [T] [D] [u]
+
+ - T is the number of threads; T=0 means one thread per root-branch
+   (the old scheme)
+ - D is the depth-cutoff (the nodes of depth D are counted by one thread)
+ - "u" additionally outputs for each thread a line (after the main line)
+   "w tasks steals busy-time utilisation".
+
+For distributing the computation over several processes or machines
+(see SubProblems.hpp), using plain binary files:
+
+> ./Queens_RUCP_ct export d list
+writes all nodes of depth d (below the root-branches) into the work-list
+file "list", outputting "N bt width  d records";
+
+> ./Queens_RUCP_ct work list begin end result [T]
+counts the records begin <= i < end of the work-list (end is capped at the
+number of records), writing the statistics into file "result", outputting
+"N bt width  begin end";
+
+> ./Queens_RUCP_ct merge list result1 ... resultk
+checks that the result-files cover the work-list exactly once, and outputs
+the same line as the direct computation.
+Failed slices can just be recomputed (results are written atomically).
+
 Via "-h" help-information is obtained, via "-v" version-information.
 
 Use
@@ -127,6 +155,10 @@ TODOS:
 */
 
 #include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <exception>
 
 #include <cassert>
 
@@ -136,12 +168,13 @@ TODOS:
 
 #include "Dimensions.hpp"
 #include "SymmetryBreaking.hpp"
+#include "SubProblems.hpp"
 
 namespace {
 
 const Environment::ProgramInfo proginfo{
-      "0.19.7",
-      "11.12.2020",
+      "0.21.0",
+      "16.10.2026",
       __FILE__,
       "Oliver Kullmann",
       "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/Queens/SimpleBacktracking/Queens_RUCP_ct.cpp",
@@ -163,13 +196,24 @@ bool show_usage(const int argc, const char* const argv[]) {
   if (not Environment::help_header(std::cout, argc, argv, proginfo))
     return false;
   std::cout <<
-    "> " << proginfo.prg << "\n"
+    "> " << proginfo.prg << " [T] [D] [u]\n"
     " runs the program for built-in\n"
     "   N   = " << N << "\n"
     "   bt  = " << int(bt) << ",\n outputting the line\n"
     "   N bt num_branches  solution_count node_count unit-clauses  min_nds_branch max_nds_branch\n"
     " plus the number of leaves realised via ucp as satisfiable or row/column-unsatisfiable."
-    "\n\n"
+    "\n"
+    "   T   : number of threads (default the number of hardware-threads;\n"
+    "         0 means one thread per root-branch)\n"
+    "   D   : depth-cutoff for splitting (default " << SymmetryBreaking::default_cutoff << ")\n"
+    "   u   : output per thread tasks, steals, busy-time, utilisation.\n"
+    "\n"
+    "> " << proginfo.prg << " export d list\n"
+    "> " << proginfo.prg << " work list begin end result [T]\n"
+    "> " << proginfo.prg << " merge list result1 ... resultk\n"
+    " for exporting the nodes of depth d, counting a slice of them, and\n"
+    " merging the results of the slices.\n"
+    "\n"
     "> ./Call_QueensRUCPct [N=16] [bt=1]\n"
     " compiles optimised and debugging forms of this program, and runs\n"
     " the optimised version, with added user-time (s) and max-memory (kb).\n"
@@ -183,17 +227,65 @@ int main(const int argc, const char* const argv[]) {
   if (Environment::version_output(std::cout, proginfo, argc, argv, AO))
     return 0;
   if (show_usage(argc, argv)) return 0;
+
+  const std::string mode = argc <= 1 ? "" : argv[1];
+  const bool export_mode = mode == "export", work_mode = mode == "work",
+    merge_mode = mode == "merge";
+  if ((export_mode and argc != 4) or (work_mode and argc != 6 and argc != 7)
+      or (merge_mode and argc < 3)) {
+    std::cerr << "ERROR[" << proginfo.prg << "]: wrong number of arguments"
+      " for mode \"" << mode << "\"; see \"-h\".\n";
+    return 1;
+  }
+  const bool sub_mode = export_mode or work_mode or merge_mode;
+
+  const unsigned T = work_mode ?
+    (argc == 7 ? std::stoul(argv[6]) : WorkStealing::default_threads()) :
+    sub_mode or argc <= 1 ? WorkStealing::default_threads() :
+    std::stoul(argv[1]);
+  const sizet D = sub_mode or argc <= 2 ? SymmetryBreaking::default_cutoff :
+    std::stoul(argv[2]);
+  const bool show_util = not sub_mode and argc > 3 and
+    std::string(argv[3]) == "u";
+
   std::cout << N << " " << int(bt) << " " << SymmetryBreaking::width_branching();
   std::cout.flush();
 
   using Statistics::NodeCounts;
-  SymmetryBreaking::job_v jobs;
   SymmetryBreaking::result_v results;
   Statistics::NodeCounts res(true);
-  SymmetryBreaking::branching(jobs, results, res);
-
-  std::cout.flush();
-  for (sizet i = 0; i < jobs.size(); ++i) results[i] += jobs[i].get();
+  SymmetryBreaking::pool_t P(T);
+  try {
+    if (export_mode) {
+      const auto h = SubProblems::export_list(argv[3], std::stoull(argv[2]));
+      std::cout << "  " << h.depth << " " << h.records << "\n";
+      return 0;
+    }
+    else if (work_mode) {
+      if (T == 0) {
+        std::cerr << "\nERROR[" << proginfo.prg << "]: T >= 1 required.\n";
+        return 1;
+      }
+      const auto h = SubProblems::count_slice(argv[2], std::stoull(argv[3]),
+                       std::stoull(argv[4]), argv[5], P);
+      std::cout << "  " << h.begin << " " << h.end << "\n";
+      return 0;
+    }
+    else if (merge_mode)
+      SubProblems::merge(argv[2],
+                         std::vector<std::string>(argv+3, argv+argc),
+                         results, res);
+    else if (T == 0) {
+      SymmetryBreaking::job_v jobs;
+      SymmetryBreaking::branching(jobs, results, res);
+      for (sizet i = 0; i < jobs.size(); ++i) results[i] += jobs[i].get();
+    }
+    else SymmetryBreaking::ws_counting(P, D, results, res);
+  }
+  catch (const std::exception& e) {
+    std::cerr << "\nERROR[" << proginfo.prg << "]: " << e.what() << "\n";
+    return 1;
+  }
   for (const auto& r : results) res += r;
 
   if (res.num_sols() != ChessBoard::exact_value(N)) {
@@ -209,5 +301,6 @@ int main(const int argc, const char* const argv[]) {
     std::sort(results.begin(), results.end());
     std::cout << "  " << results.front() << " " << results.back() << "\n";
   }
+  if (show_util and T != 0) WorkStealing::output_utilisation(std::cout, P);
 
 }
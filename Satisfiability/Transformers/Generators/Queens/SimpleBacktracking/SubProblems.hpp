@@ -0,0 +1,285 @@
+// Oliver Kullmann, 16.10.2026 (Swansea)
+/* Copyright 2026 Oliver Kullmann
+This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
+it and/or modify it under the terms of the GNU General Public License as published by
+the Free Software Foundation and included in this library; either version 3 of the
+License, or any later version. */
+
+/* Sub-problems of DoubleSweep-counting, as binary files
+
+   For distributing the counting over independent processes (e.g. the
+   nodes of a batch-system), using only plain files:
+
+    - export_list(file, d) writes all nodes of depth d (below the
+      root-branches of SymmetryBreaking) as a "work-list"
+    - count_slice(list, begin, end, result, P) counts the records with
+      indices begin <= i < end of the work-list (using the work-stealing
+      pool P), writing the statistics into a "result-file"
+    - merge(list, results) adds up the root-branches, the inner nodes of
+      the work-list and the result-files, after checking that the slices
+      of the result-files cover the work-list exactly once.
+
+   File formats (all values in the binary representation of the machine,
+   so all steps need to use the same executable, or at least the same
+   N, bt and platform -- which is checked):
+
+    - Header: magic (8 chars, "QDSlist1" resp. "QDSres_1"), N, bt, d,
+      record_size, width (number of root-branches), records (size of
+      the work-list), begin, end (each std::uint64_t; begin = end = 0
+      for the work-list).
+    - A work-list is the header, followed by width-many NodeCounts (the
+      inner nodes of depth < d, per root-branch), followed by the records
+      (board, index of root-branch).
+    - A result-file is the header (of the work-list, with the slice
+      begin, end), followed by width-many NodeCounts (per root-branch).
+
+   Result-files are first written to "file.tmp" and then renamed, so that
+   an interrupted worker never leaves an incomplete result-file.
+   All errors are reported via std::runtime_error.
+
+*/
+
+#ifndef SUBPROBLEMS_Vt4kQm8ZcX
+#define SUBPROBLEMS_Vt4kQm8ZcX
+
+#include <string>
+#include <vector>
+#include <array>
+#include <fstream>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <filesystem>
+#include <type_traits>
+
+#include <cstdint>
+#include <cstring>
+#include <cassert>
+
+#include "Dimensions.hpp"
+#include "Statistics.hpp"
+#include "Board.hpp"
+#include "Backtracking.hpp"
+#include "SymmetryBreaking.hpp"
+
+namespace SubProblems {
+
+  namespace D = Dimensions;
+  namespace SB = SymmetryBreaking;
+
+  typedef std::uint64_t index_t;
+  typedef std::array<char, 8> magic_t;
+  constexpr magic_t list_magic{'Q','D','S','l','i','s','t','1'};
+  constexpr magic_t result_magic{'Q','D','S','r','e','s','_','1'};
+
+  struct Record {
+    Board::DoubleSweep b;
+    index_t branch; // index of root-branch
+  };
+  static_assert(std::is_trivially_copyable_v<Record>);
+
+  struct Header {
+    magic_t magic;
+    index_t N, bt, depth, record_size, width, records, begin, end;
+
+    friend bool operator ==(const Header&, const Header&) noexcept = default;
+  };
+  static_assert(std::is_trivially_copyable_v<Header>);
+
+  inline Header make_header(const index_t depth, const index_t width) noexcept {
+    return {list_magic, D::N, index_t(D::bt), depth, sizeof(Record),
+            width, 0, 0, 0};
+  }
+
+
+  template <class T>
+  void write(std::ostream& out, const T& x) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    out.write(reinterpret_cast<const char*>(&x), sizeof(T));
+  }
+  template <class T>
+  void read(std::istream& in, T& x, const std::string& file) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    in.read(reinterpret_cast<char*>(&x), sizeof(T));
+    if (not in) throw std::runtime_error("File \"" + file + "\" too short.");
+  }
+
+  // Checks magic, N, bt, record-size and the size of the file:
+  void check(const Header& h, const magic_t& m, const std::string& file,
+             const std::uintmax_t size) {
+    if (h.magic != m)
+      throw std::runtime_error("File \"" + file + "\" has wrong format.");
+    if (h.N != D::N or h.bt != index_t(D::bt) or
+        h.record_size != sizeof(Record))
+      throw std::runtime_error("File \"" + file + "\" was created for N=" +
+        std::to_string(h.N) + ", bt=" + std::to_string(h.bt) +
+        ", record-size=" + std::to_string(h.record_size) + ".");
+    if (h.begin > h.end or h.end > h.records)
+      throw std::runtime_error("File \"" + file + "\" has invalid slice.");
+    const std::uintmax_t expected = sizeof(Header) +
+      h.width * sizeof(Statistics::NodeCounts) +
+      (m == list_magic ? h.records * sizeof(Record) : 0);
+    if (size != expected)
+      throw std::runtime_error("File \"" + file + "\" has size " +
+        std::to_string(size) + ", but should have size " +
+        std::to_string(expected) + ".");
+  }
+
+
+  // Depth-first enumeration of the nodes of depth d below B (of depth
+  // depth), with the statistics of the inner nodes added to s:
+  template <class OUT>
+  void enumerate(const Board::DoubleSweep& B, const index_t branch,
+                 const index_t depth, const index_t d,
+                 Statistics::NodeCounts& s, OUT& out) {
+    if (depth == d) {
+      Record r;
+      std::memset(static_cast<void*>(&r), 0, sizeof(Record)); // padding
+      r.b = B; r.branch = branch;
+      out(r); return;
+    }
+    Backtracking::expand(B, s, [&](const Board::DoubleSweep& C) {
+      enumerate(C, branch, depth+1, d, s, out);
+    });
+  }
+
+  // Returns the header (with the number of records):
+  Header export_list(const std::string& file, const index_t d) {
+    SB::board_v boards; SB::result_v results;
+    Statistics::NodeCounts res(true);
+    SB::root_branches(boards, results, res);
+    Header h = make_header(d, boards.size());
+    SB::stats_v S(boards.size());
+
+    std::ofstream out(file, std::ios::binary);
+    if (not out)
+      throw std::runtime_error("Can not open file \"" + file + "\".");
+    write(out, h);
+    for (const auto& s : S) write(out, s);
+    const auto output = [&out, &h](const Record& r) {
+      write(out, r); ++h.records;
+    };
+    for (index_t i = 0; i < boards.size(); ++i)
+      enumerate(boards[i], i, 0, d, S[i], output);
+    out.seekp(0);
+    write(out, h);
+    for (const auto& s : S) write(out, s);
+    out.close();
+    if (not out)
+      throw std::runtime_error("Error writing file \"" + file + "\".");
+    return h;
+  }
+
+  struct List {
+    Header h;
+    SB::stats_v S; // inner nodes
+  };
+  List read_list(const std::string& file) {
+    std::ifstream in(file, std::ios::binary);
+    if (not in)
+      throw std::runtime_error("Can not open file \"" + file + "\".");
+    List L;
+    read(in, L.h, file);
+    check(L.h, list_magic, file, std::filesystem::file_size(file));
+    L.S.resize(L.h.width);
+    for (auto& s : L.S) read(in, s, file);
+    return L;
+  }
+
+
+  // Counting the records begin <= i < min(end, records),
+  // returning the header of the result-file:
+  Header count_slice(const std::string& list, const index_t begin,
+                     const index_t end, const std::string& result,
+                     SB::pool_t& P) {
+    if (begin > end)
+      throw std::runtime_error("begin=" + std::to_string(begin) +
+                               " > end=" + std::to_string(end) + ".");
+    const List L = read_list(list);
+    Header h = L.h;
+    h.magic = result_magic;
+    h.end = std::min(end, h.records);
+    h.begin = std::min(begin, h.end);
+
+    SB::pool_t::task_v tasks; tasks.reserve(h.end - h.begin);
+    {std::ifstream in(list, std::ios::binary);
+     in.seekg(sizeof(Header) + h.width * sizeof(Statistics::NodeCounts) +
+              h.begin * sizeof(Record));
+     for (index_t i = h.begin; i < h.end; ++i) {
+       Record r; read(in, r, list);
+       if (r.branch >= h.width)
+         throw std::runtime_error("File \"" + list + "\": invalid record " +
+                                  std::to_string(i) + ".");
+       tasks.push_back({r.b, D::sizet(r.branch), 0});
+     }
+    }
+    SB::stats_v S(h.width);
+    SB::ws_run(P, 0, tasks, S);
+
+    const std::string tmp = result + ".tmp";
+    {std::ofstream out(tmp, std::ios::binary);
+     if (not out)
+       throw std::runtime_error("Can not open file \"" + tmp + "\".");
+     write(out, h);
+     for (const auto& s : S) write(out, s);
+     out.close();
+     if (not out)
+       throw std::runtime_error("Error writing file \"" + tmp + "\".");
+    }
+    std::filesystem::rename(tmp, result);
+    return h;
+  }
+
+
+  typedef std::pair<index_t, index_t> slice_t;
+  // Whether the (non-empty) slices [begin, end) partition [0, total):
+  bool partition(std::vector<slice_t> v, const index_t total) {
+    std::sort(v.begin(), v.end());
+    index_t next = 0;
+    for (const auto& [b, e] : v) {
+      if (b == e and b <= total) continue;
+      if (b != next or e < b) return false;
+      next = e;
+    }
+    return next == total;
+  }
+
+  /* Adding up the work-list and the result-files; results and res are as
+     for SymmetryBreaking::ws_counting:
+  */
+  void merge(const std::string& list, const std::vector<std::string>& files,
+             SB::result_v& results, Statistics::NodeCounts& res) {
+    const List L = read_list(list);
+    SB::board_v boards;
+    SB::root_branches(boards, results, res);
+    if (results.size() != L.h.width)
+      throw std::runtime_error("File \"" + list + "\" has width " +
+        std::to_string(L.h.width) + ", but should have width " +
+        std::to_string(results.size()) + ".");
+    for (index_t i = 0; i < L.h.width; ++i) results[i] += L.S[i];
+
+    std::vector<slice_t> slices;
+    for (const std::string& file : files) {
+      std::ifstream in(file, std::ios::binary);
+      if (not in)
+        throw std::runtime_error("Can not open file \"" + file + "\".");
+      Header h; read(in, h, file);
+      check(h, result_magic, file, std::filesystem::file_size(file));
+      Header hl = h; hl.magic = list_magic; hl.begin = hl.end = 0;
+      if (hl != L.h)
+        throw std::runtime_error("File \"" + file +
+          "\" does not belong to work-list \"" + list + "\".");
+      for (index_t i = 0; i < h.width; ++i) {
+        Statistics::NodeCounts s; read(in, s, file);
+        results[i] += s;
+      }
+      slices.emplace_back(h.begin, h.end);
+    }
+    if (not partition(slices, L.h.records))
+      throw std::runtime_error("The slices of the result-files do not cover"
+        " the " + std::to_string(L.h.records) + " records exactly once.");
+  }
+
+}
+
+#endif
@@ -1,5 +1,5 @@
 // Oliver Kullmann, 31.8.2020 (Swansea)
-/* Copyright 2020 Oliver Kullmann
+/* Copyright 2020, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -17,6 +17,7 @@ License, or any later version. */
 #include "Statistics.hpp"
 #include "Board.hpp"
 #include "Backtracking.hpp"
+#include "WorkStealing.hpp"
 
 namespace SymmetryBreaking {
 
@@ -35,24 +36,35 @@ namespace SymmetryBreaking {
 
   typedef std::vector<std::future<Statistics::NodeCounts>> job_v;
   typedef std::vector<Statistics::AnnotatedNodeCount> result_v;
+  typedef std::vector<Board::DoubleSweep> board_v;
 
-  void branching(job_v& jobs, result_v& results, Statistics::NodeCounts& res) noexcept {
+  /* The root-branches after symmetry-breaking: the open branches are
+     appended to boards, with their statistics (including the
+     duplication-factor) appended to results, while the statistics of
+     the branches decided by ucp are added to res.
+  */
+  void root_branches(board_v& boards, result_v& results, Statistics::NodeCounts& res) noexcept {
     using namespace Dimensions;
 
+    const auto add = [&](const Board::DoubleSweep& B,
+                         const Board::square_v& branch,
+                         const Statistics::count_t dup) {
+      Board::DoubleSweep Bc(B);
+      Statistics::NodeCounts s(false);
+      s.set_duplication(dup);
+      if (not Bc.ucp(s)) {
+        boards.push_back(Bc);
+        results.emplace_back(s, branch);
+      }
+      else res += s;
+    };
+
     if constexpr (N % 2 == 1) {
       const sizet mid = N/2;
       if (N <= 3) {
         for (sizet i = 0; i <= mid; ++i) {
           const Board::square_v branch{{0,i}};
-          Board::DoubleSweep B(branch);
-          Statistics::NodeCounts s(false);
-          if (i != mid) s.set_duplication(2);
-          if (not B.ucp(s)) {
-            jobs.push_back(std::async(std::launch::async,
-                                      Backtracking::count_init<bt>, B));
-            results.emplace_back(s, branch);
-          }
-          else res += s;
+          add(Board::DoubleSweep(branch), branch, i != mid ? 2 : 1);
         }
       }
       else {
@@ -60,51 +72,90 @@ namespace SymmetryBreaking {
         for (sizet i = 0; i < mid-1; ++i)
           for (sizet j = i+1; j < mid; ++j) {
             const Board::square_v branch{{mid,i},{j,mid}};
-            Board::DoubleSweep B(branch);
+            const Board::DoubleSweep B(branch);
             assert(not B.completed());
-            Statistics::NodeCounts s(false);
-            s.set_duplication(8);
-            if (not B.ucp(s)) {
-              jobs.push_back(std::async(std::launch::async,
-                                        Backtracking::count_init<bt>, B));
-              results.emplace_back(s, branch);
-            }
-            else res += s;
+            add(B, branch, 8);
           }
         for (sizet j = 0; j < mid-1; ++j) {
           const Board::square_v branch{{mid,mid},{mid-1,j}};
-          Board::DoubleSweep B(branch);
+          const Board::DoubleSweep B(branch);
           assert(not B.completed());
-          Statistics::NodeCounts s(false);
-          s.set_duplication(2);
-          if (not B.ucp(s)) {
-            jobs.push_back(std::async(std::launch::async,
-                                      Backtracking::count_init<bt>, B));
-            results.emplace_back(s,branch);
-          }
-          else res += s;
+          add(B, branch, 2);
         }
       }
     } else {
       assert(N % 2 == 0);
       for (sizet i = 0; i < N/2; ++i) {
         const Board::square_v branch{{0,i}};
-        Board::DoubleSweep B(branch);
-        Statistics::NodeCounts s(false);
-        s.set_duplication(2);
-        if (not B.ucp(s)) {
-          jobs.push_back(std::async(std::launch::async,
-                                    Backtracking::count_init<bt>, B));
-          results.emplace_back(s,branch);
-        }
-        else res += s;
+        add(Board::DoubleSweep(branch), branch, 2);
       }
     }
 
-    assert(jobs.size() == results.size());
-    assert(N > 3 or jobs.empty());
+    assert(boards.size() == results.size());
+    assert(N > 3 or boards.empty());
     assert(results.size() == width_branching());
+  }
+
+  // One thread per root-branch:
+  void branching(job_v& jobs, result_v& results, Statistics::NodeCounts& res) noexcept {
+    board_v boards;
+    root_branches(boards, results, res);
+    for (const auto& B : boards)
+      jobs.push_back(std::async(std::launch::async,
+                                Backtracking::count_init<Dimensions::bt>, B));
+    assert(jobs.size() == results.size());
+  }
+
+
+  /* Work-stealing (see WorkStealing.hpp) with T threads: tasks are nodes
+     of the search-tree of one of the root-branches, and nodes of depth
+     less than cutoff (the root-branches having depth 0) are split into
+     their children, while the other nodes are counted by one thread.
+     The statistics are collected per thread and root-branch, and are
+     added to results (as for branching) after the run; P then contains
+     the statistics of the threads.
+  */
+  struct Task {
+    Board::DoubleSweep b;
+    Dimensions::sizet branch; // index of root-branch
+    Dimensions::sizet depth;
+  };
+  typedef WorkStealing::Pool<Task> pool_t;
+
+  constexpr Dimensions::sizet default_cutoff = 2;
+
+  typedef std::vector<Statistics::NodeCounts> stats_v;
+
+  // Running P on the tasks init, adding the statistics to S (indexed by
+  // the root-branches):
+  void ws_run(pool_t& P, const Dimensions::sizet cutoff,
+              const pool_t::task_v& init, stats_v& S) {
+    const auto nb = S.size();
+    std::vector<stats_v> stats(P.threads(), stats_v(nb));
+    P.run(init, [&P, &stats, cutoff](const Task& t, const unsigned w) {
+      assert(t.branch < stats[w].size());
+      Statistics::NodeCounts& s = stats[w][t.branch];
+      if (t.depth >= cutoff)
+        s += Backtracking::count_init<Dimensions::bt>(t.b);
+      else
+        Backtracking::expand(t.b, s, [&P, &t, w](const Board::DoubleSweep& B) {
+          P.push(w, {B, t.branch, t.depth+1});
+        });
+    });
+    for (const stats_v& St : stats)
+      for (Dimensions::sizet i = 0; i < nb; ++i) S[i] += St[i];
+  }
 
+  void ws_counting(pool_t& P, const Dimensions::sizet cutoff,
+                   result_v& results, Statistics::NodeCounts& res) {
+    board_v boards;
+    root_branches(boards, results, res);
+    const auto nb = boards.size();
+    pool_t::task_v init; init.reserve(nb);
+    for (Dimensions::sizet i = 0; i < nb; ++i) init.push_back({boards[i], i, 0});
+    stats_v S(nb);
+    ws_run(P, cutoff, init, S);
+    for (Dimensions::sizet i = 0; i < nb; ++i) results[i] += S[i];
   }
 
 }
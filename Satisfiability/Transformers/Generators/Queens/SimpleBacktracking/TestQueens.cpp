@@ -1,11 +1,16 @@
 // Oliver Kullmann, 29.6.2020 (Swansea)
-/* Copyright 2020 Oliver Kullmann
+/* Copyright 2020, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
 License, or any later version. */
 
 #include <iostream>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <filesystem>
+#include <stdexcept>
 
 #include <cassert>
 
@@ -19,12 +24,14 @@ License, or any later version. */
 #include "Backtracking.hpp"
 #include "SymmetryBreaking.hpp"
 #include "Tables.hpp"
+#include "WorkStealing.hpp"
+#include "SubProblems.hpp"
 
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.0.9",
-        "28.10.2020",
+        "0.2.0",
+        "16.10.2026",
         __FILE__,
         "Oliver Kullmann",
         "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/Queens/SimpleBacktracking/TestQueens.cpp",
@@ -36,5 +43,75 @@ int main(const int argc, const char* const argv[]) {
   if (Environment::version_output(std::cout, proginfo, argc, argv))
     return 0;
 
+  {using namespace WorkStealing;
+   // Counting the nodes of complete binary trees of depth d:
+   struct Task { unsigned depth; };
+   for (const unsigned T : {1u, 2u, 4u}) {
+     Pool<Task> P(T);
+     assert(P.threads() == T);
+     for (const unsigned d : {0u, 1u, 5u, 12u}) {
+       std::vector<count_t> counts(T);
+       P.run({{d}}, [&P, &counts](const Task& t, const unsigned w) {
+         assert(w < P.threads());
+         ++counts[w];
+         if (t.depth != 0) {
+           P.push(w, {t.depth-1}); P.push(w, {t.depth-1});
+         }
+       });
+       count_t sum = 0, tasks = 0;
+       for (unsigned w = 0; w < T; ++w) {
+         sum += counts[w];
+         tasks += P.statistics()[w].tasks;
+         assert(P.statistics()[w].tasks == counts[w]);
+       }
+       assert(sum == (count_t(1) << (d+1)) - 1);
+       assert(tasks == sum);
+       assert(P.wall() >= 0);
+     }
+     // Several initial tasks, distributed round-robin:
+     std::vector<count_t> counts(T);
+     P.run({{3},{3},{3}}, [&P, &counts](const Task& t, const unsigned w) {
+       ++counts[w];
+       if (t.depth != 0) { P.push(w, {t.depth-1}); P.push(w, {t.depth-1}); }
+     });
+     count_t sum = 0;
+     for (const count_t c : counts) sum += c;
+     assert(sum == 3 * 15);
+   }
+   assert(Pool<Task>(0).threads() == 1);
+   assert(default_threads() >= 1);
+  }
+
+
+  {using namespace SubProblems;
+   assert(partition({}, 0));
+   assert(not partition({}, 1));
+   assert(partition({{0,3}}, 3));
+   assert(partition({{3,7},{0,3}}, 7));
+   assert(partition({{3,7},{5,5},{0,3},{7,7}}, 7));
+   assert(not partition({{0,3},{2,7}}, 7));
+   assert(not partition({{0,3},{3,7},{3,7}}, 7));
+   assert(not partition({{0,3},{4,7}}, 7));
+   assert(not partition({{0,3}}, 7));
+  }
+  {using namespace SubProblems;
+   const std::string list = std::filesystem::temp_directory_path() /
+     "TestQueens_SubProblems_list";
+   const Header h = export_list(list, 0);
+   assert(h.magic == list_magic);
+   assert(h.N == Dimensions::N and h.depth == 0);
+   assert(h.width == SymmetryBreaking::width_branching());
+   assert(h.records == h.width); // depth 0: the root-branches
+   const List L = read_list(list);
+   assert(L.h == h);
+   assert(L.S.size() == h.width);
+   for (const auto& s : L.S) assert(s.num_inds() == 0);
+   bool thrown = false;
+   {std::ofstream out(list, std::ios::app); out << "x";}
+   try { read_list(list); } catch (const std::runtime_error&) { thrown = true; }
+   assert(thrown);
+   std::filesystem::remove(list);
+  }
+
 }
 
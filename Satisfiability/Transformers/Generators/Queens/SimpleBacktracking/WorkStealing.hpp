@@ -0,0 +1,186 @@
+// Oliver Kullmann, 16.10.2026 (Swansea)
+/* Copyright 2026 Oliver Kullmann
+This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
+it and/or modify it under the terms of the GNU General Public License as published by
+the Free Software Foundation and included in this library; either version 3 of the
+License, or any later version. */
+
+/* A simple work-stealing pool for splitting search-trees
+
+   - Pool<Task> P(T) provides T worker-threads, each with its own
+     double-ended queue of tasks (protected by a mutex).
+   - P.run(tasks, f) distributes the initial tasks round-robin to the
+     workers, and runs until all tasks are processed, where f(task, w) is
+     called by worker w (0 <= w < T); f may create further tasks via
+     P.push(w, task).
+   - A worker takes its tasks from the back of its own queue (depth-first),
+     and if that is empty, steals from the front of the other queues (the
+     oldest tasks, which are the largest ones for search-trees).
+   - A worker finding no task waits on a condition-variable, which is
+     signalled by push (if some worker is waiting) and when the last task
+     is finished.
+   - Results are to be collected per worker (indexed by w), and merged
+     after run() (so that no synchronisation is needed for them).
+   - P.statistics() yields per worker the number of tasks, the number of
+     steals, and the time spent in f, while P.wall() is the time of the
+     last run(); utilisation(w) = busy-time / wall-time.
+
+*/
+
+#ifndef WORKSTEALING_g8RnWq1TzK
+#define WORKSTEALING_g8RnWq1TzK
+
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <optional>
+#include <chrono>
+#include <ostream>
+#include <algorithm>
+
+#include <cstdint>
+#include <cassert>
+
+namespace WorkStealing {
+
+  typedef std::uint_fast64_t count_t;
+  typedef std::chrono::steady_clock clock_type;
+
+  struct alignas(64) WorkerStats { // avoiding false sharing
+    count_t tasks = 0, steals = 0;
+    double busy = 0; // seconds
+  };
+
+  inline unsigned default_threads() noexcept {
+    return std::max(1u, std::thread::hardware_concurrency());
+  }
+
+  template <class Task>
+  class Pool {
+  public :
+    typedef Task task_t;
+    typedef std::vector<task_t> task_v;
+    typedef std::vector<WorkerStats> stats_v;
+
+    explicit Pool(const unsigned T) :
+      T(std::max(1u,T)), queues(this->T), stats(this->T) {}
+
+    unsigned threads() const noexcept { return T; }
+
+    void push(const unsigned w, const task_t& t) {
+      assert(w < T);
+      ++pending;
+      {std::lock_guard l(queues[w].m);
+       queues[w].d.push_back(t);
+       ++queued;
+      }
+      if (idle != 0) {
+        {std::lock_guard l(idle_m);}
+        idle_cv.notify_one();
+      }
+    }
+
+    template <class F>
+    void run(const task_v& init, F f) {
+      const auto start = clock_type::now();
+      for (unsigned w = 0; w < T; ++w) stats[w] = WorkerStats();
+      for (typename task_v::size_type i = 0; i < init.size(); ++i)
+        push(i % T, init[i]);
+      {std::vector<std::thread> workers;
+       workers.reserve(T);
+       for (unsigned w = 0; w < T; ++w)
+         workers.emplace_back([this, w, &f]{ work(w, f); });
+       for (auto& t : workers) t.join();
+      }
+      assert(pending == 0);
+      wall_ = std::chrono::duration<double>(clock_type::now() - start).count();
+    }
+
+    const stats_v& statistics() const noexcept { return stats; }
+    double wall() const noexcept { return wall_; }
+    double utilisation(const unsigned w) const noexcept {
+      assert(w < T);
+      return wall_ == 0 ? 0 : stats[w].busy / wall_;
+    }
+
+  private :
+
+    const unsigned T;
+    struct Queue {
+      std::mutex m;
+      std::deque<task_t> d;
+    };
+    std::vector<Queue> queues;
+    stats_v stats;
+    std::atomic<count_t> pending = 0; // pushed, but not finished
+    std::atomic<count_t> queued = 0; // pushed, but not taken
+    std::atomic<unsigned> idle = 0; // number of waiting workers
+    std::mutex idle_m;
+    std::condition_variable idle_cv;
+    double wall_ = 0;
+
+    std::optional<task_t> pop(const unsigned w) {
+      Queue& q = queues[w];
+      std::lock_guard l(q.m);
+      if (q.d.empty()) return {};
+      const task_t t = q.d.back(); q.d.pop_back();
+      --queued;
+      return t;
+    }
+    std::optional<task_t> steal(const unsigned w) {
+      for (unsigned i = 1; i < T; ++i) {
+        Queue& q = queues[(w + i) % T];
+        std::lock_guard l(q.m);
+        if (q.d.empty()) continue;
+        const task_t t = q.d.front(); q.d.pop_front();
+        --queued;
+        ++stats[w].steals;
+        return t;
+      }
+      return {};
+    }
+
+    template <class F>
+    void work(const unsigned w, F& f) {
+      WorkerStats& s = stats[w];
+      for (;;) {
+        std::optional<task_t> t = pop(w);
+        if (not t) t = steal(w);
+        if (t) {
+          const auto start = clock_type::now();
+          f(*t, w);
+          s.busy +=
+            std::chrono::duration<double>(clock_type::now() - start).count();
+          ++s.tasks;
+          if (--pending == 0) {
+            {std::lock_guard l(idle_m);}
+            idle_cv.notify_all();
+          }
+          continue;
+        }
+        std::unique_lock l(idle_m);
+        ++idle;
+        idle_cv.wait(l, [this]{ return queued != 0 or pending == 0; });
+        --idle;
+        if (pending == 0) return;
+      }
+    }
+
+  };
+
+  // One line per worker: w tasks steals busy-time utilisation
+  template <class Task>
+  void output_utilisation(std::ostream& out, const Pool<Task>& P,
+                          const char* const prefix = "") {
+    const auto& S = P.statistics();
+    for (unsigned w = 0; w < P.threads(); ++w)
+      out << prefix << w << " " << S[w].tasks << " " << S[w].steals << " "
+          << S[w].busy << " " << P.utilisation(w) << "\n";
+  }
+
+}
+
+#endif
@@ -1,5 +1,5 @@
 // Oliver Kullmann, 22.6.2019 (Swansea)
-/* Copyright 2019, 2020, 2021 Oliver Kullmann
+/* Copyright 2019, 2020, 2021, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -17,7 +17,7 @@ for information on the program, the version, and the environment.
 
 for basic help-information.
 
-> ./BRG [clauses] [options] [seeds] [output]
+> ./BRG [clauses] [options] [seeds] [output] [parallel]
 
 for creation of random CNFS.
 
@@ -30,8 +30,8 @@ TODOS:
 -1 Update to the use of SeedOrganisation (as in LSRG.cpp), and write
    application-tests.
     - There are three generic parameters:
-     1 Currently last in ClauseSets we have the thread-index (a hypothetical
-       parameter for hypothetical parallel computation); perhaps this should
+     1 Currently last in ClauseSets we have the thread-index (used for
+       the chunk-size in case of parallel computation); perhaps this should
        go first.
      2 The main structural parameters (renaming and ordering).
      3 The number of clause-blocks.
@@ -158,8 +158,8 @@ the context of the OKlibrary. Then the Git-id is just hardcoded.
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.4.9",
-        "10.7.2023",
+        "0.6.1",
+        "16.10.2026",
         __FILE__,
         "Oliver Kullmann",
         "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/Random/BRG.cpp",
@@ -178,18 +178,21 @@ namespace {
     if (not Environment::help_header(std::cout, argc, argv, proginfo))
       return false;
     std::cout <<
-    "> " << proginfo.prg << " [clauses] [options] [seeds] [output]\n\n"
+    "> " << proginfo.prg << " [clauses] [options] [seeds] [output] [parallel]\n\n"
     "   clauses : \"B1; ...; Bs\", with s >= 0 clause-blocks Bi\n"
     "     Bi    : \"C * P1 | ... | Pm\", with m >= 1 clause-parts Pi and C=#clauses\n"
     "     Pi    : \"N, W [, P]\", where\n"
     "              N=variable-range, W=#literals, P=#sign-probability\n"
     "   options : \"c1, ..., cl\", with l >= 0 option-choices ci from\n"
-    "               " << Environment::WRP<option_t>{} << ";\n"
-    "             defaults are the first values for both options\n"
+    "               " << Environment::WRP<option_t>{} << ",\n"
+    "               " << Environment::WRP<DimacsW>{} << " (buffered clause-output);\n"
+    "             defaults are the first values for all options\n"
     "   seeds   : ";
     explanation_seeds(std::cout, 13);
     std::cout <<
-    "   output  : \"-cout\" (standard output) or \"\"[-]\"\" (default filename) or \"FILENAME\"\n\n"
+    "   output  : \"-cout\" (standard output) or \"\"[-]\"\" (default filename) or \"FILENAME\"\n"
+    "   parallel: \"T[,S]\", T threads, chunks of S clauses (default " << ParGen::default_chunk << ",\n"
+    "             S=0 means one chunk per thread); only for options \"u,o\"\n\n"
     " computes the random CNF:\n\n"
     "  - The arguments are positional, not named (the names are used here only"
     " for communication).\n"
@@ -219,7 +222,10 @@ try {
     return int(Error::invalid_clauses);
   }
 
-  const GParam gpar = (argc <= index) ? GParam{} : GParam{Environment::translate<option_t>()(argv[index++], sep)};
+  const auto [sorto, renameo, dw] = (argc <= index) ?
+    optionw_t{} : Environment::translate<optionw_t>()(argv[index++], sep);
+  const GParam gpar{sorto, renameo};
+  const bool buffered = dw == DimacsW::buffered;
   const Param par{gpar, std::move(vpar)};
 
   vec_eseed_t s = seeds(par);
@@ -227,6 +233,16 @@ try {
   const evec_size_t esize_system = s.size();
   const evec_size_t esize_add = argc > 3 ? add_seeds(argv[index++], s) : 0;
 
+  const bool parallel = argc > index+1 and std::string_view(argv[index+1]) != "";
+  const ParGen pg = parallel ? read_pargen(argv[index+1]) : ParGen{};
+  if (parallel) {
+    if (gpar != GParam(-1)) {
+      std::cerr << error << "Parallel creation only for options \"u,o\".\n";
+      return int(Error::invalid_parallel);
+    }
+    set_chunk_seed(s, pg, extract_parameters(par.vp).c);
+  }
+
   std::ofstream out;
   std::string filename;
   if (index == argc or std::string_view(argv[index]) == "-cout") {
@@ -250,6 +266,7 @@ try {
       std::cout << "Output to file \"" << filename << "\".\n";
   }
   index++;
+  if (argc > index) index++;
 
   index.deactivate();
 
@@ -268,11 +285,23 @@ try {
             << DWW{"num_e-seeds"} << esize_system << "+" << esize_add << "=" << s.size() << "\n"
             << DWW{" e-seeds"} << ESW(s) << "\n";
   assert(not s.empty());
+  if (buffered)
+    out << DWW{"output-mode"} << dw << "\n";
+  if (parallel)
+    out << DWW{"threads"} << pg.threads << "\n"
+        << DWW{"chunk-size"} << s[thread_index_position] << "\n";
 
-  RandGen_t g(s);
-
-  if (gpar == GParam(-1)) rand_clauselist(out, g, par.vp);
-  else out << random(g,par).first;
+  if (parallel) rand_clauselist(out, s, par.vp, pg);
+  else {
+    RandGen_t g(s);
+    if (gpar == GParam(-1)) rand_clauselist(out, g, par.vp, dw);
+    else if (buffered) {
+      DimacsOut dout(out);
+      dout << random(g,par).first;
+      dout.flush();
+    }
+    else out << random(g,par).first;
+  }
 
 }
 catch(const std::domain_error& e) {
@@ -0,0 +1,192 @@
+// Oliver Kullmann, 16.10.2026 (Swansea)
+/* Copyright 2026 Oliver Kullmann
+This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
+it and/or modify it under the terms of the GNU General Public License as published by
+the Free Software Foundation and included in this library; either version 3 of the
+License, or any later version. */
+
+/*
+  The 64-bit Mersenne Twister, computed in blocks
+
+   - class BlockMT64 produces exactly the same sequence of values as
+     std::mt19937_64 (for the same seed-sequence), however the tempered
+     values are computed for the whole state (312 values) at once:
+    - refill() updates the state ("twist") and tempers all values into
+      an internal buffer; both loops are free of branches and
+      loop-carried dependencies (besides the fixed offsets of the
+      twist), and thus are vectorised by the compiler
+    - g() just reads the next value from the buffer
+    - fill(span<uint64_t> s) yields the next s.size() values (as calling
+      g() that often), tempering whole blocks directly into s
+    - discard(z) only twists for whole blocks (no tempering).
+
+   - The state (x, p) is as for std::mt19937_64 in libstdc++; so
+     operator ==, operator << and operator >> are compatible with it,
+     and conversion from and to std::mt19937_64 happens via the textual
+     representation (BlockMT64(std::mt19937_64), std_engine()).
+
+  Numbers.hpp uses BlockMT64 as the engine of RandGen_t if the macro
+  RANDGEN_BLOCK is defined (e.g. "make BRG CPPFLAGS=-DRANDGEN_BLOCK").
+
+  See TimingBlockMT64.cpp for measurements.
+
+*/
+
+#ifndef BLOCKMT64_Hx7tPq2WnL
+#define BLOCKMT64_Hx7tPq2WnL
+
+#include <random>
+#include <span>
+#include <type_traits>
+#include <array>
+#include <algorithm>
+#include <sstream>
+#include <istream>
+#include <ostream>
+#include <ios>
+
+#include <cstdint>
+#include <cstddef>
+
+namespace RandGen {
+
+  class BlockMT64 {
+  public :
+    typedef std::uint_fast64_t result_type;
+    typedef std::mt19937_64 std_t;
+    static_assert(std::is_same_v<result_type, std_t::result_type>);
+
+    static constexpr std::size_t word_size = std_t::word_size;
+    static constexpr std::size_t state_size = std_t::state_size;
+    static constexpr std::size_t shift_size = std_t::shift_size;
+    static constexpr std::size_t mask_bits = std_t::mask_bits;
+    static constexpr result_type xor_mask = std_t::xor_mask;
+    static constexpr std::size_t tempering_u = std_t::tempering_u;
+    static constexpr result_type tempering_d = std_t::tempering_d;
+    static constexpr std::size_t tempering_s = std_t::tempering_s;
+    static constexpr result_type tempering_b = std_t::tempering_b;
+    static constexpr std::size_t tempering_t = std_t::tempering_t;
+    static constexpr result_type tempering_c = std_t::tempering_c;
+    static constexpr std::size_t tempering_l = std_t::tempering_l;
+    static_assert(word_size == 64);
+
+    static constexpr result_type min() noexcept { return 0; }
+    static constexpr result_type max() noexcept { return std_t::max(); }
+
+    static constexpr std::size_t n = state_size, m = shift_size;
+    static constexpr result_type upper_mask = ~result_type(0) << mask_bits;
+    static constexpr result_type lower_mask = ~upper_mask;
+
+    // As std_t(5489):
+    BlockMT64() : BlockMT64(std_t()) {}
+    // As std_t(q) (see [rand.eng.mers] in the C++-standard):
+    explicit BlockMT64(std::seed_seq& q) { seed(q); }
+    explicit BlockMT64(const std_t& g) {
+      std::stringstream s; s << g; s >> *this;
+    }
+
+    void seed(std::seed_seq& q) {
+      constexpr std::size_t k = word_size / 32;
+      std::array<std::uint_least32_t, n * k> a;
+      q.generate(a.begin(), a.end());
+      for (std::size_t i = 0; i < n; ++i)
+        x[i] = result_type(a[k*i]) | (result_type(a[k*i+1]) << 32);
+      bool zero = (x[0] & upper_mask) == 0;
+      for (std::size_t i = 1; zero and i < n; ++i) zero = x[i] == 0;
+      if (zero) x[0] = result_type(1) << (word_size - 1);
+      p = n;
+    }
+
+    std_t std_engine() const {
+      std::stringstream s; s << *this;
+      std_t res; s >> res; return res;
+    }
+
+    result_type operator ()() noexcept {
+      if (p == n) refill();
+      return buf[p++];
+    }
+
+    // Equivalent to "for (auto& v : s) v = g();":
+    void fill(const std::span<result_type> s) noexcept {
+      result_type* out = s.data();
+      std::size_t k = s.size();
+      const std::size_t avail = n - p;
+      if (k <= avail) {
+        std::copy_n(buf.data() + p, k, out); p += k; return;
+      }
+      out = std::copy_n(buf.data() + p, avail, out); k -= avail;
+      for (; k >= n; k -= n, out += n) { twist(); temper(out); }
+      p = n;
+      if (k != 0) { refill(); std::copy_n(buf.data(), k, out); p = k; }
+    }
+
+    void discard(unsigned long long z) noexcept {
+      const std::size_t avail = n - p;
+      if (z <= avail) { p += z; return; }
+      z -= avail;
+      for (; z > n; z -= n) twist();
+      refill(); p = z;
+    }
+
+    friend bool operator ==(const BlockMT64& lhs, const BlockMT64& rhs) noexcept {
+      return lhs.p == rhs.p and lhs.x == rhs.x;
+    }
+
+    // Same format as libstdc++ for std_t:
+    friend std::ostream& operator <<(std::ostream& out, const BlockMT64& g) {
+      const auto flags = out.flags(); const auto fill = out.fill();
+      out.flags(std::ios_base::dec | std::ios_base::fixed | std::ios_base::left);
+      out.fill(' ');
+      for (const result_type v : g.x) out << v << ' ';
+      out << g.p;
+      out.flags(flags); out.fill(fill);
+      return out;
+    }
+    friend std::istream& operator >>(std::istream& in, BlockMT64& g) {
+      const auto flags = in.flags();
+      in.flags(std::ios_base::dec | std::ios_base::skipws);
+      for (result_type& v : g.x) in >> v;
+      in >> g.p;
+      in.flags(flags);
+      if (g.p < n) g.temper(g.buf.data());
+      else g.p = n;
+      return in;
+    }
+
+  private :
+
+    std::array<result_type, n> x; // the state
+    std::size_t p; // next index into buf (p = n: refill needed)
+    std::array<result_type, n> buf; // the tempered x
+
+    static constexpr result_type mag(const result_type y) noexcept {
+      return (y >> 1) ^ (-(y & 1) & xor_mask);
+    }
+    void twist() noexcept {
+      std::size_t i = 0;
+      for (; i < n - m; ++i)
+        x[i] = x[i+m] ^ mag((x[i] & upper_mask) | (x[i+1] & lower_mask));
+      for (; i < n - 1; ++i)
+        x[i] = x[i+m-n] ^ mag((x[i] & upper_mask) | (x[i+1] & lower_mask));
+      x[n-1] = x[m-1] ^ mag((x[n-1] & upper_mask) | (x[0] & lower_mask));
+    }
+    void temper(result_type* const out) const noexcept {
+      for (std::size_t i = 0; i < n; ++i) {
+        result_type z = x[i];
+        z ^= (z >> tempering_u) & tempering_d;
+        z ^= (z << tempering_s) & tempering_b;
+        z ^= (z << tempering_t) & tempering_c;
+        z ^= z >> tempering_l;
+        out[i] = z;
+      }
+    }
+    void refill() noexcept {
+      twist(); temper(buf.data()); p = 0;
+    }
+
+  };
+
+}
+
+#endif
@@ -1,5 +1,5 @@
 // Oliver Kullmann, 17.4.2019 (Swansea)
-/* Copyright 2019, 2020, 2021, 2022, 2023 Oliver Kullmann
+/* Copyright 2019, 2020, 2021, 2022, 2023, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -22,6 +22,8 @@ License, or any later version. */
   - function read_rparam_v(string)
   - scoped enum SortO, RenameO for the two option-types
   - struct GParam, containing these two options
+  - registration (and output) of DimacsW (DimacsOutput.hpp) as third
+    option-type ("-buf", "+buf") for the programs
   - struct Param for all parameters.
 
  - Computing the seeds:
@@ -57,16 +59,23 @@ License, or any later version. */
   - RDimacsClauseList : pair of DimacsClauseList and rename_info_t
   - DimacsComments : concrete datatype containing a vector of strings
 
-  - output-streaming for most above types
+  - output-streaming for most above types, and for DimacsOut
+    (DimacsOutput.hpp) for dimacs_pars, DimacsComments and the pairs
 
 
  - The generation of random clauses:
 
   - rand_clause(g, C, n, k, p) for adding a random clause to a given clause C
 
-  - rand_clauselist(out, g, par) for direct output to out, for option-value
-    GParam(-1) (the completely unrestriced form)
+  - rand_clauselist(out, g, par, DimacsW) for direct output to out, for
+    option-value GParam(-1) (the completely unrestriced form), with the
+    clauses output via DimacsOut for DimacsW::buffered
   - rand_clauselist_core(out, g, par) does not output the Dimacs-line
+    (out can be an ostream or a DimacsOut)
+  - struct ParGen for the parameters of parallel creation (number of threads,
+    chunk-size), read_pargen(string), set_chunk_seed(vec_eseed_t, ParGen, c)
+  - rand_clauselist_core(out, s, par, pg) for parallel creation (for
+    option-value GParam(-1)), rand_clauselist(out, s, par, pg) as above
 
   - rand_clauselist(g, par, RenameO) now computing a clause-list, and handling
     renaming
@@ -98,6 +107,7 @@ License, or any later version. */
 #include <set>
 #include <algorithm>
 #include <numeric>
+#include <thread>
 
 #include <cassert>
 
@@ -105,6 +115,7 @@ License, or any later version. */
 
 //Guaranteed to be included:
 #include "VarLit.hpp"
+#include "DimacsOutput.hpp"
 
 #include "SeedOrganisation.hpp"
 #include "Distributions.hpp"
@@ -334,6 +345,9 @@ namespace RandGen {
   enum class RenameO { renamed=0, maxindex=1, original=2 }; // r, m, o
 
   typedef std::tuple<SortO,RenameO> option_t;
+  // Including the choice of the Dimacs-writer (not part of GParam, and thus
+  // not influencing the seeds):
+  typedef std::tuple<SortO,RenameO,DimacsW> optionw_t;
   constexpr char sep = ',';
 
   // Packing both global parameters, providing index-access (with SortO
@@ -392,6 +406,12 @@ namespace Environment {
     static constexpr std::array<const char*, size> string
       {"r", "m", "o"};
   };
+  template <>
+  struct RegistrationPolicies<RandGen::DimacsW> {
+    static constexpr int size = int(RandGen::DimacsW::buffered)+1;
+    static constexpr std::array<const char*, size> string
+      {"-buf", "+buf"};
+  };
 }
 namespace RandGen {
 
@@ -407,6 +427,11 @@ namespace RandGen {
     case RenameO::maxindex : return out << "maxindex";
     default : return out << "renamed";}
   }
+  std::ostream& operator <<(std::ostream& out, const DimacsW w) {
+    switch (w) {
+    case DimacsW::buffered : return out << "buffered";
+    default : return out << "stream";}
+  }
   std::ostream& operator <<(std::ostream& out, const GParam p) {
     return out << "\"" << p.s_ << sep << p.r_ << "\"";
   }
@@ -602,6 +627,25 @@ namespace RandGen {
     return out << D.first << D.second;
   }
 
+  // The same for buffered output:
+  DimacsOut& operator <<(DimacsOut& out, const dimacs_pars pa) {
+    return out << "p cnf " << pa.n << ' ' << pa.c << '\n';
+  }
+  template <class CLS>
+  DimacsOut& operator <<(DimacsOut& out,
+                         const std::pair<dimacs_pars, CLS>& F) {
+    return out << F.first << F.second;
+  }
+  DimacsOut& operator <<(DimacsOut& out, const DimacsComments& com) {
+    for (const std::string& s : com.v) out << "c " << s << '\n';
+    return out;
+  }
+  template <class DCLS>
+  DimacsOut& operator <<(DimacsOut& out,
+                         const std::pair<DimacsComments, DCLS>& D) {
+    return out << D.first << D.second;
+  }
+
 
   /* *************************
      * The random generation *
@@ -647,8 +691,9 @@ namespace RandGen {
     }
   }
 
-  // Output the created clauses directly on out:
-  void rand_clauselist_core(std::ostream& out, RandGen_t& g, const rparam_v& par) {
+  // Output the created clauses directly on out (an ostream or a DimacsOut):
+  template <class OUT>
+  void rand_clauselist_core(OUT& out, RandGen_t& g, const rparam_v& par) {
     for (const RParam& pa : par)
       for (gen_uint_t i = 0; i < pa.c; ++i) {
         Clause C; C.reserve(size(pa.cps));
@@ -657,10 +702,117 @@ namespace RandGen {
         out << C;
       }
   }
-  void rand_clauselist(std::ostream& out, RandGen_t& g, const rparam_v& par) {
+  void rand_clauselist(std::ostream& out, RandGen_t& g, const rparam_v& par,
+                       const DimacsW w = DimacsW::stream) {
+    const auto dp = extract_parameters(par);
+    out << dp; if (dp.c == 0) return;
+    if (w == DimacsW::buffered) {
+      DimacsOut dout(out);
+      rand_clauselist_core(dout,g,par);
+      dout.flush();
+    }
+    else rand_clauselist_core(out,g,par);
+  }
+
+  /* Parallel creation of the clauses (for option-value GParam(-1)):
+      - The sequence of all clauses (over all clause-blocks) is split into
+        chunks of S clauses (the last chunk possibly smaller).
+      - Chunk j is created by its own generator, seeded with the e-seeds s
+        extended by j; the thread-index-seed s[thread_index_position] is
+        S (for sequential creation it is default_thread_index = 0), as set
+        by set_chunk_seed.
+      - The T threads create the chunks in rounds (thread t creating chunk
+        r*T+t in round r), formatting the clauses into their own buffer,
+        which are output in chunk-order.
+      - So the output depends only on the e-seeds (which include S), not
+        on T; with S = 0 the chunk-size is determined as ceil(c/T) (one
+        chunk per thread), and then the output depends on T.
+  */
+  struct ParGen {
+    unsigned threads = 1;
+    gen_uint_t chunk = default_chunk;
+    static constexpr gen_uint_t default_chunk = 1ULL << 16;
+    // The actual chunk-size for c clauses:
+    constexpr gen_uint_t chunk_size(const gen_uint_t c) const noexcept {
+      assert(threads >= 1);
+      if (chunk != 0) return chunk;
+      return std::max(gen_uint_t(1), c / threads + (c % threads != 0));
+    }
+  };
+  // Reading "T" or "T,S":
+  ParGen read_pargen(const std::string& s) {
+    const auto v = Environment::split(s, sep);
+    if (v.empty() or v.size() > 2)
+      throw std::domain_error("read_pargen: syntax error in \"" + s + "\"");
+    ParGen res;
+    const gen_uint_t T = to_gen_uint_t(v[0], true);
+    if (T == 0 or T > std::numeric_limits<unsigned>::max())
+      throw std::domain_error("read_pargen: invalid threads = " + v[0]);
+    res.threads = T;
+    if (v.size() == 2) res.chunk = to_gen_uint_t(v[1], true);
+    return res;
+  }
+
+  constexpr vec_eseed_t::size_type thread_index_position = 3;
+  void set_chunk_seed(vec_eseed_t& s, const ParGen pg, const gen_uint_t c) {
+    assert(s.size() > thread_index_position);
+    assert(s[thread_index_position] == default_thread_index);
+    s[thread_index_position] = pg.chunk_size(c);
+  }
+
+  // Appending the clauses with indices first <= i < last (over all
+  // clause-blocks) to buf:
+  void rand_clauses(std::string& buf, RandGen_t& g, const rparam_v& par,
+                    const gen_uint_t first, const gen_uint_t last) {
+    gen_uint_t offset = 0;
+    Clause C;
+    for (const RParam& pa : par) {
+      if (offset >= last) break;
+      const gen_uint_t b = std::max(first, offset),
+        e = std::min(last, offset + pa.c);
+      for (gen_uint_t i = b; i < e; ++i) {
+        C.clear(); C.reserve(size(pa.cps));
+        for (const ClausePart& cp : pa.cps)
+          rand_clause(g, C, cp.n, cp.k, cp.p);
+        append(buf, C);
+      }
+      offset += pa.c;
+    }
+  }
+
+  // Parallel version of rand_clauselist_core, where s are the e-seeds
+  // (with set_chunk_seed applied):
+  void rand_clauselist_core(std::ostream& out, const vec_eseed_t& s,
+                            const rparam_v& par, const ParGen pg) {
+    assert(pg.threads >= 1);
+    const gen_uint_t c = extract_parameters(par).c;
+    const gen_uint_t S = s[thread_index_position];
+    assert(S == pg.chunk_size(c));
+    const gen_uint_t num_chunks = c / S + (c % S != 0);
+    const gen_uint_t T = std::min(gen_uint_t(pg.threads), num_chunks);
+    std::vector<std::string> buffers(T);
+    const auto create = [&](const gen_uint_t j, std::string& buf) {
+      vec_eseed_t sj(s); sj.push_back(j);
+      RandGen_t g(sj);
+      buf.clear();
+      rand_clauses(buf, g, par, j*S, std::min(c, (j+1)*S));
+    };
+    for (gen_uint_t first = 0; first < num_chunks; first += T) {
+      const gen_uint_t size = std::min(T, num_chunks - first);
+      {std::vector<std::jthread> pool; pool.reserve(size-1);
+       for (gen_uint_t t = 1; t < size; ++t)
+         pool.emplace_back(create, first+t, std::ref(buffers[t]));
+       create(first, buffers[0]);
+      }
+      for (gen_uint_t t = 0; t < size; ++t)
+        out.write(buffers[t].data(), buffers[t].size());
+    }
+  }
+  void rand_clauselist(std::ostream& out, const vec_eseed_t& s,
+                       const rparam_v& par, const ParGen pg) {
     const auto dp = extract_parameters(par);
     out << dp; if (dp.c == 0) return;
-    rand_clauselist_core(out,g,par);
+    rand_clauselist_core(out, s, par, pg);
   }
 
   // Similar to rand_clauselist, but output into a clause-list, and handling
@@ -790,6 +942,7 @@ namespace RandGen {
     except = 50,
     invalid_clauses = 60,
     file_open = 61,
+    invalid_parallel = 62,
   };
 
 }
@@ -1,5 +1,5 @@
 // Oliver Kullmann, 17.7.2019 (Swansea)
-/* Copyright 2019, 2020 Oliver Kullmann
+/* Copyright 2019, 2020, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -17,7 +17,7 @@ for information on the program, the version, and the environment.
 
 for basic help-information.
 
-> ./DQBRG [quantifiers] [dependencies] [clauses] [options] [seeds] [output]
+> ./DQBRG [quantifiers] [dependencies] [clauses] [options] [seeds] [output] [parallel]
 
 for creation of random DQCNFS.
 
@@ -103,8 +103,8 @@ TODOS:
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.3.2",
-        "27.12.2020",
+        "0.4.0",
+        "16.10.2026",
         __FILE__,
         "Oliver Kullmann",
         "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/Random/DQBRG.cpp",
@@ -123,7 +123,7 @@ namespace {
     if (not Environment::help_header(std::cout, argc, argv, proginfo))
       return false;
     std::cout <<
-    "> " << proginfo.prg << " [quantifiers] [dependencies] [clauses] [options] [seeds] [output]\n\n"
+    "> " << proginfo.prg << " [quantifiers] [dependencies] [clauses] [options] [seeds] [output] [parallel]\n\n"
     "   quantifiers : \"b1 ... bt\", with t >= 1 quantifier-blocks bi\n"
     "     bi         \"eK\" or \"aK\" for K >= 1, except for bt, which is just K\n"
     "                (automatically existential, i.e., \"e\")\n"
@@ -137,7 +137,9 @@ namespace {
     "             defaults are the first values for both options\n"
     "   seeds   : \"s1, ..., sp\", with p >= 0 seed-values si, which are\n"
     "             unsigned 64-bit integers, \"r\" (for \"random\"), or \"t\" (for \"timestamp\")\n"
-    "   output  : \"-cout\" or \"[-]\" (default-filename) or [-]FILENAME\n\n"
+    "   output  : \"-cout\" or \"[-]\" (default-filename) or [-]FILENAME\n"
+    "   parallel: \"T[,S]\", T threads, chunks of S clauses (default " << ParGen::default_chunk << ",\n"
+    "             S=0 means one chunk per thread); only for options \"u,o\"\n\n"
 
     " computes the random DQCNF:\n\n"
     "  - The arguments are positional, not named (the names are used here only"
@@ -258,6 +260,16 @@ try {
   const evec_size_t esize_system = s.size();
   const evec_size_t esize_add = argc > 5 ? add_seeds(argv[index++], s) : 0;
 
+  const bool parallel = argc > index+1 and std::string_view(argv[index+1]) != "";
+  const ParGen pg = parallel ? read_pargen(argv[index+1]) : ParGen{};
+  if (parallel) {
+    if (gpar != GParam(-1)) {
+      std::cerr << error << "Parallel creation only for options \"u,o\".\n";
+      return int(Error::invalid_parallel);
+    }
+    set_chunk_seed(s, pg, extract_parameters(par.vp).c);
+  }
+
   std::ofstream out;
   std::string filename;
   if (index == argc or std::string_view(argv[index]) == "-cout") {
@@ -281,6 +293,7 @@ try {
       std::cout << "Output to file \"" << filename << "\".\n";
   }
   index++;
+  if (argc > index) index++;
 
   index.deactivate();
 
@@ -316,10 +329,14 @@ try {
   for (vec_eseed_t::size_type i = 1; i < s.size(); ++i)
     out << " " << s[i];
   out << "\n";
+  if (parallel)
+    out << DWW{"threads"} << pg.threads << "\n"
+        << DWW{"chunk-size"} << s[thread_index_position] << "\n";
 
   RandGen_t g(transform(s, SP::split));
 
-  if (gpar == GParam(-1)) rand_clauselist(out, g, par.vp, vblock, na, ne, deppar);
+  if (parallel) rand_clauselist(out, g, par.vp, vblock, na, ne, deppar, s, pg);
+  else if (gpar == GParam(-1)) rand_clauselist(out, g, par.vp, vblock, na, ne, deppar);
   else {
     const auto [dep_sets, dep_vector] = create_dependencies(g, vblock, na, ne, deppar);
     assert(not dep_sets.empty());
@@ -1,5 +1,5 @@
 // Oliver Kullmann, 17.7.2019 (Swansea)
-/* Copyright 2019, 2020 Oliver Kullmann
+/* Copyright 2019, 2020, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -66,6 +66,8 @@ License, or any later version. */
    Generation:
 
      - void rand_clauselist(std::ostream, RandGen_t, rparam_v, block_v, gen_uint_t na, ne, dep_par_t)
+     - void rand_clauselist(std::ostream, RandGen_t, rparam_v, block_v, gen_uint_t na, ne, dep_par_t, vec_eseed_t, ParGen),
+       creating the clauses in parallel (the dependencies via g)
      - void output_dqblocks(std::ostream, Dvector, AVarSetsystem, rename_info_t R, DepOp)
        (implementation not complete)
      - void rand_dqclauseset(RandGen_t, rparam_v, AVarSetsystem, Dvector)
@@ -381,7 +383,8 @@ namespace RandGen {
   }
 
 
-  void rand_clauselist(std::ostream& out, RandGen_t& g, const rparam_v& par, const block_v& bv, const gen_uint_t na, const gen_uint_t ne, const dep_par_t deppar) {
+  // Output of p-line and dependencies (false iff unknown dependency-form):
+  bool rand_dqprefix(std::ostream& out, RandGen_t& g, const rparam_v& par, const block_v& bv, const gen_uint_t na, const gen_uint_t ne, const dep_par_t deppar) {
     assert(valid(bv));
     assert(bv[0].v.b() == na+ne);
     {const auto dp = extract_parameters(par);
@@ -546,10 +549,18 @@ namespace RandGen {
     }
     default:
      out << "UNKNOWN DEPENDENCY-FORM.\n";
-     return;
+     return false;
     }
 
-    rand_clauselist_core(out, g, par);
+    return true;
+  }
+  void rand_clauselist(std::ostream& out, RandGen_t& g, const rparam_v& par, const block_v& bv, const gen_uint_t na, const gen_uint_t ne, const dep_par_t deppar) {
+    if (rand_dqprefix(out, g, par, bv, na, ne, deppar))
+      rand_clauselist_core(out, g, par);
+  }
+  void rand_clauselist(std::ostream& out, RandGen_t& g, const rparam_v& par, const block_v& bv, const gen_uint_t na, const gen_uint_t ne, const dep_par_t deppar, const vec_eseed_t& s, const ParGen pg) {
+    if (rand_dqprefix(out, g, par, bv, na, ne, deppar))
+      rand_clauselist_core(out, s, par, pg);
   }
 
 
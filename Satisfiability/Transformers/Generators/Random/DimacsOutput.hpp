@@ -0,0 +1,224 @@
+// Oliver Kullmann, 16.10.2026 (Swansea)
+/* Copyright 2026 Oliver Kullmann
+This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
+it and/or modify it under the terms of the GNU General Public License as published by
+the Free Software Foundation and included in this library; either version 3 of the
+License, or any later version. */
+
+/*
+  Buffered output of Dimacs-clauses
+
+   - max_chars_uint = 20, max_chars_lit = 21 (maximal lengths of the
+     decimal representations of var_t resp. Lit)
+   - write(char*, UInt), write(char*, Lit), write_clause(char*, Clause)
+     write into a given character-array (with enough space), returning the
+     end-pointer
+   - concepts LitRange (clauses) and ClauseRange (clause-lists)
+   - append(string&, Clause), appending the Dimacs-representation
+
+   - class DimacsOut : wrapper around an ostream, with a buffer of
+     (default) 2^20 characters; the buffer is handed over by a single
+     call of ostream::write when full and at flush(); the destructor
+     flushes only as a fallback, swallowing errors, so callers call flush()
+     explicitly at the end of the output
+    - operator << for characters, strings, integers, Var, Lit, clauses
+      (any LitRange) and clause-lists (any ClauseRange)
+    - the output is exactly as for the ostream-operators from VarLit.hpp
+      and ClauseSets.hpp
+   - scoped enum DimacsW (stream, buffered) for choosing between
+     ostream- and DimacsOut-output (option-strings "-buf", "+buf", registered
+     in ClauseSets.hpp).
+
+  For std::ofstream (with libstdc++) a write of 2^20 characters is passed
+  through directly (together with the pending content of the stream-buffer),
+  so that the output happens by one write-system-call per buffer; for
+  std::cout the characters go to std::fwrite, which also writes such large
+  blocks directly.
+
+  The speed-up compared to the ostream-operators comes mainly from
+  std::to_chars (avoiding the locale-machinery of the streams).
+
+  See TimingDimacsOutput.cpp for measurements.
+
+  Used (behind an option) by BRG, QBRG, BCC2SAT ("+buf"), Mols, Pandiagonal,
+  CPandiagonal ("+buf" as writer-argument) and Pythagorean ("buf=on").
+  Not applicable to LSRG (which outputs Latin squares, no clauses).
+  Not migrated: DQBRG (it does not compile), and the remaining programs in
+  Bicliques (Bipart2SAT and the CNF-transformers), which use the types
+  DimacsTools::Lit/Clause instead of RandGen::Lit/Clause.
+
+*/
+
+#ifndef DIMACSOUTPUT_jL5vRb8YqN
+#define DIMACSOUTPUT_jL5vRb8YqN
+
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <concepts>
+#include <ranges>
+#include <charconv>
+#include <algorithm>
+#include <type_traits>
+
+#include <cassert>
+#include <cstring>
+
+#include "VarLit.hpp"
+
+namespace RandGen {
+
+  constexpr std::size_t max_chars_uint = 20; // 2^64-1 has 20 digits
+  constexpr std::size_t max_chars_lit = max_chars_uint + 1;
+
+  template <class Int>
+  concept DimacsInt = std::integral<Int> and not std::same_as<Int, bool>;
+
+  template <DimacsInt Int>
+  inline char* write(char* const p, const Int x) noexcept {
+    const auto [end, ec] = std::to_chars(p, p + max_chars_lit, x);
+    assert(ec == std::errc());
+    return end;
+  }
+  inline char* write(char* p, const Var v) noexcept {
+    return write(p, v.v);
+  }
+  inline char* write(char* p, const Lit x) noexcept {
+    if (not x.s) *p++ = '-';
+    return write(p, x.v.v);
+  }
+
+  template <class C>
+  concept LitRange = std::ranges::input_range<C> and
+    std::same_as<std::remove_cvref_t<std::ranges::range_value_t<C>>, Lit>;
+  template <class F>
+  concept ClauseRange = std::ranges::input_range<F> and
+    LitRange<std::ranges::range_value_t<F>>;
+
+  // The number of characters needed for the Dimacs-representation of C
+  // is at most max_chars(C):
+  template <LitRange C>
+  inline std::size_t max_chars(const C& cl) noexcept {
+    return std::ranges::size(cl) * (max_chars_lit + 1) + 2;
+  }
+  template <LitRange C>
+  inline char* write_clause(char* p, const C& cl) noexcept {
+    for (const Lit x : cl) { p = write(p, x); *p++ = ' '; }
+    *p++ = '0'; *p++ = '\n';
+    return p;
+  }
+
+  template <LitRange C>
+  inline void append(std::string& buf, const C& cl) {
+    const auto old_size = buf.size();
+    buf.resize(old_size + max_chars(cl));
+    char* const end = write_clause(buf.data() + old_size, cl);
+    buf.resize(end - buf.data());
+  }
+
+
+  class DimacsOut {
+  public :
+    typedef std::vector<char> buffer_t;
+    typedef buffer_t::size_type size_type;
+    static constexpr size_type default_capacity = size_type(1) << 20;
+    // Enough for one literal plus separator, or "0\n":
+    static constexpr size_type min_capacity = max_chars_lit + 1;
+
+    explicit DimacsOut(std::ostream& out,
+                       const size_type cap = default_capacity)
+      : out(out), buf(std::max(cap, min_capacity)),
+        pos(buf.data()), end(buf.data() + buf.size()) {}
+    DimacsOut(const DimacsOut&) = delete;
+    DimacsOut& operator =(const DimacsOut&) = delete;
+    // A destructor must not throw; so errors on this last flush are ignored
+    // (callers who want them reported call flush() before):
+    ~DimacsOut() noexcept { try { flush(); } catch (...) {} }
+
+    size_type capacity() const noexcept { return buf.size(); }
+    // The number of characters currently in the buffer:
+    size_type size() const noexcept { return pos - buf.data(); }
+    // The number of write-calls so far:
+    size_type writes() const noexcept { return writes_; }
+
+    // Handing the buffer to out (without flushing out):
+    void flush() {
+      if (pos == buf.data()) return;
+      out.write(buf.data(), size());
+      pos = buf.data(); ++writes_;
+    }
+
+    void put(const char c) {
+      reserve(1); *pos++ = c;
+    }
+    void put(const std::string_view s) {
+      if (s.size() > size_type(end - pos)) {
+        flush();
+        if (s.size() > capacity()) {
+          out.write(s.data(), s.size()); ++writes_; return;
+        }
+      }
+      std::memcpy(pos, s.data(), s.size()); pos += s.size();
+    }
+    template <DimacsInt Int>
+    void put(const Int x) {
+      reserve(max_chars_lit); pos = write(pos, x);
+    }
+    void put(const Var v) { put(v.v); }
+    void put(const Lit x) {
+      reserve(max_chars_lit); pos = write(pos, x);
+    }
+    template <LitRange C>
+    void put_clause(const C& cl) {
+      for (const Lit x : cl) {
+        reserve(max_chars_lit + 1); pos = write(pos, x); *pos++ = ' ';
+      }
+      reserve(2); *pos++ = '0'; *pos++ = '\n';
+    }
+
+  private :
+    std::ostream& out;
+    buffer_t buf;
+    char* pos;
+    char* const end;
+    size_type writes_ = 0;
+
+    void reserve(const size_type n) {
+      assert(n <= capacity());
+      if (size_type(end - pos) < n) flush();
+    }
+  };
+
+  inline DimacsOut& operator <<(DimacsOut& out, const char c) {
+    out.put(c); return out;
+  }
+  inline DimacsOut& operator <<(DimacsOut& out, const std::string_view s) {
+    out.put(s); return out;
+  }
+  template <DimacsInt Int>
+  inline DimacsOut& operator <<(DimacsOut& out, const Int x) {
+    out.put(x); return out;
+  }
+  inline DimacsOut& operator <<(DimacsOut& out, const Var v) {
+    out.put(v); return out;
+  }
+  inline DimacsOut& operator <<(DimacsOut& out, const Lit x) {
+    out.put(x); return out;
+  }
+  template <LitRange C>
+  inline DimacsOut& operator <<(DimacsOut& out, const C& cl) {
+    out.put_clause(cl); return out;
+  }
+  template <ClauseRange F>
+  inline DimacsOut& operator <<(DimacsOut& out, const F& cls) {
+    for (const auto& cl : cls) out.put_clause(cl);
+    return out;
+  }
+
+
+  enum class DimacsW { stream = 0, buffered = 1 };
+
+}
+
+#endif
@@ -1,5 +1,5 @@
 // Oliver Kullmann, 15.3.2019 (Swansea)
-/* Copyright 2019, 2021, 2023 Oliver Kullmann
+/* Copyright 2019, 2021, 2023, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -29,6 +29,7 @@ License, or any later version. */
       While class Bernoulli takes a RandGen_t by reference, the class
       BernoulliS takes a seed-sequence instead, and creates the generator
       internally.
+      b.fill(span<bool>) is the batch-version (see below for UniformRange).
 
     Uniform distributions:
 
@@ -36,6 +37,11 @@ License, or any later version. */
       0, ..., n-1. Also well-defined, but for n which are not powers of
       two, possibly more than one generator-call is needed.
       Constructed as UniformRange u(g,n,start=0), called via u().
+      The batch-version u.fill(span<gen_uint_t> s) is equivalent to
+      calling u() s.size()-many times (with the same results and the same
+      generator-calls), but obtains the random numbers via fill(g,span)
+      (from Numbers.hpp), which for the block-engine BlockMT64 copies
+      whole blocks.
     - Wrapper UniformRangeS, constructed by a seed-sequence instead of
       a generator: UniformRangeS(n,seeds,start=0).
     - Function-object uniform_range u(g), called via u(n).
@@ -58,6 +64,9 @@ TODOS:
 #include <bitset>
 #include <ostream>
 #include <type_traits>
+#include <span>
+#include <array>
+#include <algorithm>
 
 #include <cassert>
 #include <cstdint>
@@ -271,6 +280,34 @@ namespace RandGen {
     gen_uint_t last() const noexcept { return last_generated; }
     gen_uint_t rejected() const noexcept { return rejected_; }
 
+    // Equivalent to "for (bool& x : res) x = b();":
+    void fill(const std::span<bool> res) noexcept {
+      if (s == S::c0 or s == S::c1) {
+        std::ranges::fill(res, s == S::c1); return;
+      }
+      std::array<gen_uint_t, batch_size> buf;
+      bool* out = res.data();
+      for (std::size_t k = res.size(); k != 0;) {
+        const std::size_t size = std::min(k, batch_size);
+        RandGen::fill(g, {buf.data(), size});
+        if (s == S::dy) {
+          for (std::size_t i = 0; i < size; ++i)
+            out[i] = buf[i] < threshold;
+          out += size; k -= size;
+        }
+        else
+          for (std::size_t i = 0; i < size; ++i) {
+            const gen_uint_t r = buf[i];
+            if (r > last_valid) ++rejected_;
+            else {
+              *out++ = r < threshold; --k;
+              last_generated = r;
+            }
+          }
+      }
+    }
+    static constexpr std::size_t batch_size = 256;
+
     static constexpr S set_S(const Prob64 p) noexcept {
       if (p.zero()) return S::c0;
       if (p.one()) return S::c1;
@@ -339,7 +376,8 @@ namespace RandGen {
   */
   template <class RG>
   class UniformRange {
-    static_assert(std::is_same_v<RG,RandGen_t> or std::is_same_v<RG, randgen_t>);
+    static_assert(std::is_same_v<RG,RandGen_t> or std::is_same_v<RG, randgen_t>
+                  or std::is_same_v<RG, BlockMT64>);
     RG& g;
   public :
     typedef RG rg_t;
@@ -390,6 +428,23 @@ namespace RandGen {
       return result/size_region + s;
     }
 
+    // Equivalent to "for (gen_uint_t& x : res) x = u();" (the random
+    // numbers are created in place, and the accepted ones are moved to
+    // the front):
+    void fill(const std::span<gen_uint_t> res) const noexcept {
+      if (trivial) { std::ranges::fill(res, s); return; }
+      gen_uint_t* out = res.data();
+      for (std::size_t k = res.size(); k != 0;) {
+        RandGen::fill(g, {out, k});
+        gen_uint_t* const begin = out;
+        for (std::size_t i = 0; i < k; ++i) {
+          const gen_uint_t r = begin[i];
+          if (r <= last_regions) *out++ = r/size_region + s;
+        }
+        k -= out - begin;
+      }
+    }
+
     friend std::ostream& operator <<(std::ostream& out, const UniformRange& u) {
       return out << u.n << "," << u.s << "," << u.trivial << ","
         << u.p2 << "," << u.size_region << "," << u.last_regions;
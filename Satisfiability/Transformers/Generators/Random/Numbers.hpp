@@ -1,5 +1,5 @@
 // Oliver Kullmann, 6.7.2018 (Swansea)
-/* Copyright 2018, 2019, 2020, 2021, 2022, 2023 Oliver Kullmann
+/* Copyright 2018, 2019, 2020, 2021, 2022, 2023, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -89,6 +89,12 @@ License, or any later version. */
       with vec_seed_t, vec_eseed_t, or a list of seed_t: the direct
       initialisation with a single seed is not allowed (to avoid weak seeds,
       and unknowingly duplicated runs).
+     - The engine used by RandGen_t is randengine_t, which is randgen_t,
+       or, if macro RANDGEN_BLOCK is defined, BlockMT64 (BlockMT64.hpp),
+       which computes the same sequence in blocks; extract() always
+       returns a randgen_t.
+     - g.fill(span<gen_uint_t> s) fills s with the next s.size() values.
+    - fill(g, s) for randgen_t, BlockMT64 and RandGen_t.
 
     - Prob64 is a simple type for precise probabilities, based on fractions of
       unsigned 64-bit integers:
@@ -154,6 +160,7 @@ TODOS:
 #include <optional>
 #include <numeric>
 #include <limits>
+#include <span>
 
 #include <cstdint>
 #include <cassert>
@@ -163,6 +170,8 @@ TODOS:
 #include <Numerics/FloatingPoint.hpp>
 #include <ProgramOptions/Environment.hpp>
 
+#include "BlockMT64.hpp"
+
 namespace RandGen {
 
   // The type of the random-engine:
@@ -457,6 +466,27 @@ namespace RandGen {
     return randgen_t(s);
   }
 
+  // The engine of RandGen_t:
+#ifdef RANDGEN_BLOCK
+  typedef BlockMT64 randengine_t;
+  inline randengine_t init_engine(const vec_seed_t& v) {
+    std::seed_seq s(v.begin(), v.end());
+    return randengine_t(s);
+  }
+#else
+  typedef randgen_t randengine_t;
+  inline randengine_t init_engine(const vec_seed_t& v) { return init(v); }
+#endif
+  static_assert(std::is_same_v<randengine_t::result_type, gen_uint_t>);
+
+  // Filling s with the next s.size() values of g:
+  inline void fill(randgen_t& g, const std::span<gen_uint_t> s) noexcept {
+    for (gen_uint_t& x : s) x = g();
+  }
+  inline void fill(BlockMT64& g, const std::span<gen_uint_t> s) noexcept {
+    g.fill(s);
+  }
+
   // Seed-Wrap:
   struct SW { const vec_seed_t& v; };
   std::ostream& operator <<(std::ostream& out, const SW& sw) {
@@ -502,18 +532,25 @@ namespace RandGen {
      empty vector (32- or 64-bit).
   */
   class RandGen_t {
-    randgen_t g_;
+    randengine_t g_;
   public :
     static constexpr gen_uint_t min() noexcept {return 0;}
     static constexpr gen_uint_t max() noexcept {return randgen_max;}
     void discard(unsigned long long z) noexcept {g_.discard(z);}
     gen_uint_t operator ()() noexcept { return g_(); }
+    void fill(const std::span<gen_uint_t> s) noexcept {
+      RandGen::fill(g_, s);
+    }
 
+#ifdef RANDGEN_BLOCK
+    randgen_t extract() const { return g_.std_engine(); }
+#else
     randgen_t extract() const noexcept { return g_; }
+#endif
 
-    explicit RandGen_t() noexcept : g_(init({})) {};
-    explicit RandGen_t(const vec_seed_t& v) : g_(init(v)) {}
-    RandGen_t(std::initializer_list<seed_t> l) : g_(init(l)) {}
+    explicit RandGen_t() noexcept : g_(init_engine({})) {};
+    explicit RandGen_t(const vec_seed_t& v) : g_(init_engine(v)) {}
+    RandGen_t(std::initializer_list<seed_t> l) : g_(init_engine(l)) {}
     RandGen_t(const vec_eseed_t& v) : RandGen_t(transform(v, SP::split)) {}
 
     explicit RandGen_t(const RandGen_t&) noexcept = default;
@@ -534,6 +571,9 @@ namespace RandGen {
   };
   static_assert(RandGen_t::min() == randgen_t::min());
   static_assert(RandGen_t::max() == randgen_t::max());
+  inline void fill(RandGen_t& g, const std::span<gen_uint_t> s) noexcept {
+    g.fill(s);
+  }
 
 
   // Probabilities as 64-bit fractions
@@ -1,5 +1,5 @@
 // Oliver Kullmann, 30.6.2019 (Swansea)
-/* Copyright 2019, 2020 Oliver Kullmann
+/* Copyright 2019, 2020, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -17,7 +17,7 @@ for information on the program, the version, and the environment.
 
 for basic help-information.
 
-> ./QBRG [quantifiers] [clauses] [options] [seeds] [output]
+> ./QBRG [quantifiers] [clauses] [options] [seeds] [output] [parallel]
 
 for creation of random QCNFS.
 
@@ -65,8 +65,8 @@ the context of the OKlibrary. Then the Git-id is just hardcoded.
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.4.2",
-        "27.12.2020",
+        "0.6.1",
+        "16.10.2026",
         __FILE__,
         "Oliver Kullmann",
         "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/Random/QBRG.cpp",
@@ -85,7 +85,7 @@ namespace {
     if (not Environment::help_header(std::cout, argc, argv, proginfo))
       return false;
     std::cout <<
-    "> " << proginfo.prg << " [quantifiers] [clauses] [options] [seeds] [output]\n\n"
+    "> " << proginfo.prg << " [quantifiers] [clauses] [options] [seeds] [output] [parallel]\n\n"
     "   quantifiers: \"b1 ... bt\", with t >= 1 quantifier-blocks bi\n"
     "     bi         \"eK\" or \"aK\" for K >= 1, except for bt, which is just K\n"
     "                (automatically existential, i.e., \"e\")\n"
@@ -94,11 +94,14 @@ namespace {
     "     Pi    : \"N, W [, P]\", where\n"
     "              N=quantifier-block-range, W=#literals, P=#sign-probability\n"
     "   options : \"c1, ..., cl\", with l >= 0 option-choices ci from\n"
-    "               " << Environment::WRP<option_t>{} << ";\n"
-    "             defaults are the first values for both options\n"
+    "               " << Environment::WRP<option_t>{} << ",\n"
+    "               " << Environment::WRP<DimacsW>{} << " (buffered clause-output);\n"
+    "             defaults are the first values for all options\n"
     "   seeds   : \"s1, ..., sp\", with p >= 0 seed-values si, which are\n"
     "             unsigned 64-bit integers, \"r\" (for \"random\"), or \"t\" (for \"timestamp\")\n"
-    "   output  : \"-cout\" or \"[-]\" (default-filename) or [-]FILENAME\n\n"
+    "   output  : \"-cout\" or \"[-]\" (default-filename) or [-]FILENAME\n"
+    "   parallel: \"T[,S]\", T threads, chunks of S clauses (default " << ParGen::default_chunk << ",\n"
+    "             S=0 means one chunk per thread); only for options \"u,o\"\n\n"
     " computes the random QCNF:\n\n"
     "  - The arguments are positional, not named (the names are used here only"
     " for communication).\n"
@@ -146,7 +149,10 @@ try {
     return int(Error::invalid_clauses);
   }
 
-  const GParam gpar = (argc <= index) ? GParam{} : GParam{Environment::translate<option_t>()(argv[index++], sep)};
+  const auto [sorto, renameo, dw] = (argc <= index) ?
+    optionw_t{} : Environment::translate<optionw_t>()(argv[index++], sep);
+  const GParam gpar{sorto, renameo};
+  const bool buffered = dw == DimacsW::buffered;
   if (gpar == GParam{}) {
     for (const auto& b : vpar) {
       if (b.c == 0) {
@@ -171,6 +177,16 @@ try {
   const evec_size_t esize_system = s.size();
   const evec_size_t esize_add = argc > 4 ? add_seeds(argv[index++], s) : 0;
 
+  const bool parallel = argc > index+1 and std::string_view(argv[index+1]) != "";
+  const ParGen pg = parallel ? read_pargen(argv[index+1]) : ParGen{};
+  if (parallel) {
+    if (gpar != GParam(-1)) {
+      std::cerr << error << "Parallel creation only for options \"u,o\".\n";
+      return int(Error::invalid_parallel);
+    }
+    set_chunk_seed(s, pg, extract_parameters(par.vp).c);
+  }
+
   std::ofstream out;
   std::string filename;
   if (index == argc or std::string_view(argv[index]) == "-cout") {
@@ -194,6 +210,7 @@ try {
       std::cout << "Output to file \"" << filename << "\".\n";
   }
   index++;
+  if (argc > index) index++;
 
   index.deactivate();
 
@@ -220,10 +237,16 @@ try {
   for (vec_eseed_t::size_type i = 1; i < s.size(); ++i)
     out << " " << s[i];
   out << "\n";
+  if (buffered)
+    out << DWW{"output-mode"} << dw << "\n";
+  if (parallel)
+    out << DWW{"threads"} << pg.threads << "\n"
+        << DWW{"chunk-size"} << s[thread_index_position] << "\n";
 
   RandGen_t g(transform(s, SP::split));
 
-  if (gpar == GParam(-1)) rand_clauselist(out, g, par.vp, vblock);
+  if (parallel) rand_clauselist(out, s, par.vp, vblock, pg);
+  else if (gpar == GParam(-1)) rand_clauselist(out, g, par.vp, vblock, dw);
   else {
     const auto R = gpar == GParam{} ?
       rand_qclauseset(g, par.vp, vblock) :
@@ -234,7 +257,12 @@ try {
       out << dimacs_pars{vblock[0].v.b(), R.first.first.c};
     if (R.first.first.n != 0)
       output_qblocks(out, vblock, R.second);
-    out << R.first.second;
+    if (buffered) {
+      DimacsOut dout(out);
+      dout << R.first.second;
+      dout.flush();
+    }
+    else out << R.first.second;
   }
 
 }
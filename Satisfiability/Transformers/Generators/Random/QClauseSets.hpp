@@ -1,5 +1,5 @@
 // Oliver Kullmann, 9.6.2019 (Swansea)
-/* Copyright 2019, 2020 Oliver Kullmann
+/* Copyright 2019, 2020, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -19,7 +19,9 @@ License, or any later version. */
   - seeds(Param, block_v).
 
  - The generation of random clauses:
-  - rand_clauselist(ostream, RandGen_t, rparam_v, block_v)
+  - rand_clauselist(ostream, RandGen_t, rparam_v, block_v, DimacsW)
+  - rand_clauselist(ostream, vec_eseed_t, rparam_v, block_v, ParGen) for
+    parallel creation
   - rand_qclauseset(RandGen_t, rparam_v, block_v).
 
  - Input and output:
@@ -358,12 +360,24 @@ namespace RandGen {
   }
 
 
-  void rand_clauselist(std::ostream& out, RandGen_t& g, const rparam_v& par, const block_v& bv) {
+  void rand_clauselist(std::ostream& out, RandGen_t& g, const rparam_v& par, const block_v& bv, const DimacsW w = DimacsW::stream) {
     assert(bv.size() >= 2);
     const auto dp = extract_parameters(par);
     out << dimacs_pars{bv[0].v.b(), dp.c};
     output_qblocks(out, bv, {});
-    rand_clauselist_core(out, g, par);
+    if (w == DimacsW::buffered) {
+      DimacsOut dout(out);
+      rand_clauselist_core(dout, g, par);
+      dout.flush();
+    }
+    else rand_clauselist_core(out, g, par);
+  }
+  void rand_clauselist(std::ostream& out, const vec_eseed_t& s, const rparam_v& par, const block_v& bv, const ParGen pg) {
+    assert(bv.size() >= 2);
+    const auto dp = extract_parameters(par);
+    out << dimacs_pars{bv[0].v.b(), dp.c};
+    output_qblocks(out, bv, {});
+    rand_clauselist_core(out, s, par, pg);
   }
 
   // Testing whether clause C is free from uncovered universal literals:
@@ -1,5 +1,5 @@
 // Oliver Kullmann, 18.4.2019 (Swansea)
-/* Copyright 2019, 2020, 2022 Oliver Kullmann
+/* Copyright 2019, 2020, 2022, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -8,6 +8,8 @@ License, or any later version. */
 #include <iostream>
 #include <string_view>
 #include <sstream>
+#include <string>
+#include <algorithm>
 
 #include <cassert>
 
@@ -18,8 +20,8 @@ License, or any later version. */
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.3.1",
-        "13.3.2022",
+        "0.4.0",
+        "16.10.2026",
         __FILE__,
         "Oliver Kullmann",
         "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/Random/TestClauseSets.cpp",
@@ -310,4 +312,50 @@ int main(const int argc, const char* const argv[]) {
    assert(not valid(DimacsClauseList{{5,2},{{},{{6,1}}}}));
   }
 
+  {const ParGen pg = read_pargen("4");
+   assert(pg.threads == 4 and pg.chunk == ParGen::default_chunk);
+   assert(pg.chunk_size(10) == ParGen::default_chunk);
+   const ParGen pg2 = read_pargen("3,0");
+   assert(pg2.threads == 3 and pg2.chunk == 0);
+   assert(pg2.chunk_size(0) == 1);
+   assert(pg2.chunk_size(9) == 3);
+   assert(pg2.chunk_size(10) == 4);
+   assert(read_pargen("1,77").chunk == 77);
+   for (const std::string s : {"", "0", "1,2,3", "x", "-1"}) {
+     bool has_thrown = false;
+     try { read_pargen(s); }
+     catch(const std::logic_error&) { has_thrown = true; }
+     assert(has_thrown);
+   }
+  }
+  {const rparam_v par{{{{{2,7},3u}},5}, {{{{9,12},4u,2u}},800}, {{{{1,4},3u,Prob64{1,3}}},95}};
+   const gen_uint_t c = extract_parameters(par).c;
+   assert(c == 900);
+   const vec_eseed_t s0{1,2,3,default_thread_index,55};
+   for (const gen_uint_t S : {gen_uint_t(1), gen_uint_t(100), ParGen::default_chunk}) {
+     vec_eseed_t s(s0);
+     set_chunk_seed(s, {1,S}, c);
+     assert(s[thread_index_position] == S);
+     std::string res;
+     for (const unsigned T : {1u, 2u, 3u, 7u}) {
+       std::ostringstream out;
+       rand_clauselist_core(out, s, par, {T,S});
+       if (T == 1) res = out.str();
+       else assert(out.str() == res);
+     }
+     assert(std::count(res.begin(), res.end(), '\n') == std::ptrdiff_t(c));
+     if (S >= c) {
+       vec_eseed_t s1(s); s1.push_back(0);
+       RandGen_t g(s1);
+       std::ostringstream out;
+       rand_clauselist_core(out, g, par);
+       assert(out.str() == res);
+     }
+   }
+   {vec_eseed_t s(s0);
+    set_chunk_seed(s, {3,0}, c);
+    assert(s[thread_index_position] == 300);
+   }
+  }
+
 }
@@ -0,0 +1,141 @@
+// Oliver Kullmann, 16.10.2026 (Swansea)
+/* Copyright 2026 Oliver Kullmann
+This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
+it and/or modify it under the terms of the GNU General Public License as published by
+the Free Software Foundation and included in this library; either version 3 of the
+License, or any later version. */
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <array>
+
+#include <cassert>
+
+#include <ProgramOptions/Environment.hpp>
+
+#include "DimacsOutput.hpp"
+#include "ClauseSets.hpp"
+
+namespace {
+
+  const Environment::ProgramInfo proginfo{
+        "0.1.0",
+        "16.10.2026",
+        __FILE__,
+        "Oliver Kullmann",
+        "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/Random/TestDimacsOutput.cpp",
+        "GPL v3"};
+
+  using namespace RandGen;
+
+  template <class X>
+  std::string via_stream(const X& x) {
+    std::ostringstream ss; ss << x; return ss.str();
+  }
+  template <class X>
+  std::string via_buffer(const X& x, const DimacsOut::size_type cap) {
+    std::ostringstream ss;
+    {DimacsOut out(ss, cap); out << x; out.flush();}
+    return ss.str();
+  }
+
+}
+
+int main(const int argc, const char* const argv[]) {
+  if (Environment::version_output(std::cout, proginfo, argc, argv))
+  return 0;
+
+  static_assert(LitRange<Clause>);
+  static_assert(LitRange<std::array<Lit,3>>);
+  static_assert(not LitRange<std::string>);
+  static_assert(ClauseRange<ClauseList>);
+  static_assert(ClauseRange<ClauseSet>);
+  static_assert(not ClauseRange<Clause>);
+
+  {std::array<char, 64> a;
+   char* p = write(a.data(), Lit(0,1));
+   assert(std::string(a.data(), p) == "0");
+   p = write(a.data(), Lit(max_var,-1));
+   assert(std::string(a.data(), p) == "-18446744073709551615");
+   assert(std::size_t(p - a.data()) == max_chars_lit);
+   p = write(a.data(), Var(77));
+   assert(std::string(a.data(), p) == "77");
+   p = write(a.data(), min_lit);
+   assert(std::string(a.data(), p) == "-9223372036854775808");
+   p = write_clause(a.data(), Clause{{1,-1},{22,1}});
+   assert(std::string(a.data(), p) == "-1 22 0\n");
+   p = write_clause(a.data(), Clause{});
+   assert(std::string(a.data(), p) == "0\n");
+  }
+
+  {std::string s = "x";
+   append(s, Clause{{3,1},{4,-1}});
+   assert(s == "x3 -4 0\n");
+   append(s, Clause{});
+   assert(s == "x3 -4 0\n0\n");
+  }
+
+  {std::ostringstream ss;
+   {DimacsOut out(ss, 0);
+    assert(out.capacity() == DimacsOut::min_capacity);
+    out << 'c' << " " << std::string("ab") << gen_uint_t(12) << ' ' << -7
+        << Var(3) << Lit(5,-1) << '\n';
+    assert(ss.str().empty() or out.writes() >= 1);
+   } // the destructor flushes as fallback
+   assert(ss.str() == "c ab12 -73-5\n");
+  }
+
+  {std::ostringstream ss;
+   {DimacsOut out(ss);
+    out << "abc";
+    assert(out.size() == 3);
+    assert(ss.str().empty());
+    out.flush();
+    assert(out.size() == 0 and out.writes() == 1);
+    assert(ss.str() == "abc");
+    out.flush();
+    assert(out.writes() == 1);
+    out << std::string(3 * out.capacity(), 'x');
+    assert(out.writes() == 2 and out.size() == 0);
+    out << "d";
+    out.flush();
+    assert(out.writes() == 3);
+   }
+   assert(ss.str() == "abc" + std::string(3 * DimacsOut::default_capacity, 'x') + "d");
+  }
+
+  {RandGen_t g({1,2,3});
+   ClauseList F;
+   for (gen_uint_t i = 0; i < 1000; ++i) {
+     Clause C;
+     rand_clause(g, C, VarInterval(1, i+1), std::min(i+1, gen_uint_t(7)), SignDist{Prob64{1,3}});
+     F.push_back(C);
+   }
+   F.push_back({}); F.push_back({Lit(max_var,-1)});
+   const std::string s = via_stream(F);
+   for (const DimacsOut::size_type cap : {0ul, 1ul, 23ul, 100ul, 4096ul, DimacsOut::default_capacity})
+     assert(via_buffer(F, cap) == s);
+   const DimacsClauseList D{{2000,1002}, F};
+   assert(via_buffer(D, 50) == via_stream(D));
+   const DimacsComments com{{"abc", "", "x y"}};
+   assert(via_buffer(com, 0) == "c abc\nc \nc x y\n");
+   assert(via_buffer(std::pair{com, D}, 1000) == via_stream(std::pair{com, D}));
+   const ClauseSet S(F.begin(), F.end());
+   assert(via_buffer(DimacsClauseSet{{2000,S.size()}, S}, 0) ==
+          via_stream(DimacsClauseSet{{2000,S.size()}, S}));
+  }
+
+  {const rparam_v par{{{{{2,7},3u}},5}, {{{{9,12},4u,2u}},800}, {{{{1,4},3u,Prob64{1,3}}},95}};
+   std::ostringstream ss1, ss2;
+   {RandGen_t g({4,5});
+    rand_clauselist(ss1, g, par);
+   }
+   {RandGen_t g({4,5});
+    rand_clauselist(ss2, g, par, DimacsW::buffered);
+   }
+   assert(ss1.str() == ss2.str());
+   assert(ss1.str().starts_with("p cnf 12 900\n"));
+  }
+
+}
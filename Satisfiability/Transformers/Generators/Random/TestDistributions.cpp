@@ -1,11 +1,13 @@
 // Oliver Kullmann, 18.4.2019 (Swansea)
-/* Copyright 2019, 2020 Oliver Kullmann
+/* Copyright 2019, 2020, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
 License, or any later version. */
 
 #include <iostream>
+#include <vector>
+#include <memory>
 
 #include <cmath>
 
@@ -16,8 +18,8 @@ License, or any later version. */
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.3.0",
-        "13.11.2020",
+        "0.4.0",
+        "16.10.2026",
         __FILE__,
         "Oliver Kullmann",
         "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/Random/Distributions.cpp",
@@ -301,4 +303,35 @@ int main(const int argc, const char* const argv[]) {
    assert(b.digits >= 32);
   }
 
+  // Batch-versions:
+  for (const gen_uint_t n : {gen_uint_t(1), gen_uint_t(2), gen_uint_t(3),
+         gen_uint_t(1007), iexp2(40), iexp2(63)+1, randgen_max}) {
+    RandGen_t g1(vec_eseed_t{n}), g2(vec_eseed_t{n});
+    BlockMT64 g3(g1.extract());
+    UniformRange u1(g1, n, 1), u2(g2, n, 1);
+    UniformRange u3(g3, n, 1);
+    for (const std::size_t size : {0, 1, 17, 400, 1000}) {
+      std::vector<gen_uint_t> v(size), w(size);
+      u2.fill(v); u3.fill(w);
+      for (const gen_uint_t x : v) assert(x == u1());
+      assert(v == w);
+      assert(g1 == g2);
+      assert(BlockMT64(g1.extract()) == g3);
+    }
+  }
+  for (const Prob64 p : {Prob64{0,1}, Prob64{1,1}, Prob64{1,4},
+         Prob64{1,3}, Prob64{1,9223372036854775809ULL}}) {
+    RandGen_t g1(vec_eseed_t{p.nom(), p.den()}),
+      g2(vec_eseed_t{p.nom(), p.den()});
+    Bernoulli b1(g1, p), b2(g2, p);
+    for (const std::size_t size : {0, 1, 17, 256, 257, 1000}) {
+      const std::unique_ptr<bool[]> v(new bool[size]);
+      b2.fill({v.get(), size});
+      for (std::size_t i = 0; i < size; ++i) assert(v[i] == b1());
+      assert(g1 == g2);
+      assert(b1.rejected() == b2.rejected());
+      assert(b1.last() == b2.last());
+    }
+  }
+
 }
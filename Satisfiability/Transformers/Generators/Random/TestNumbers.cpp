@@ -1,5 +1,5 @@
 // Oliver Kullmann, 18.4.2019 (Swansea)
-/* Copyright 2019, 2021, 2022, 2023 Oliver Kullmann
+/* Copyright 2019, 2021, 2022, 2023, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -7,6 +7,7 @@ License, or any later version. */
 
 #include <iostream>
 #include <sstream>
+#include <vector>
 
 #include <ProgramOptions/Environment.hpp>
 
@@ -15,8 +16,8 @@ License, or any later version. */
 namespace {
 
   const Environment::ProgramInfo proginfo{
-        "0.3.2",
-        "21.9.2023",
+        "0.4.0",
+        "16.10.2026",
         __FILE__,
         "Oliver Kullmann",
         "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/Random/TestNumbers.cpp",
@@ -189,6 +190,56 @@ int main(const int argc, const char* const argv[]) {
    assert(g() == valempty_30001);
   }
 
+  {BlockMT64 g;
+   std::seed_seq s{};
+   g.seed(s);
+   assert(g() == valempty_1);
+   assert(g() == valempty_2);
+   assert(g() == valempty_3);
+   g.discard(9997);
+   assert(g() == valempty_10001);
+   g.discard(9999);
+   assert(g() == valempty_20001);
+   g.discard(9999);
+   assert(g() == valempty_30001);
+  }
+  {BlockMT64 g;
+   g.discard(9999);
+   assert(g() == specval);
+  }
+  {randgen_t g1(init({1,2,3}));
+   std::seed_seq s{1,2,3};
+   BlockMT64 g2(s);
+   assert(g2 == BlockMT64(g1));
+   assert(g2.std_engine() == g1);
+   for (unsigned i = 0; i < 1000; ++i) assert(g1() == g2());
+   assert(g2.std_engine() == g1);
+   {std::stringstream s1, s2; s1 << g1; s2 << g2;
+    assert(s1.str() == s2.str());
+   }
+   g1.discard(100000); g2.discard(100000);
+   assert(g1() == g2());
+   g1.discard(311); g2.discard(311);
+   assert(g1() == g2());
+   for (const std::size_t size : {0, 1, 5, 311, 312, 313, 700, 2000}) {
+     std::vector<gen_uint_t> v(size);
+     g2.fill(v);
+     for (const gen_uint_t x : v) assert(x == g1());
+     assert(g1() == g2());
+     assert(g2.std_engine() == g1);
+   }
+   assert(BlockMT64(g1) == g2);
+   std::vector<gen_uint_t> v(10), w(10);
+   fill(g1, v); fill(g2, w);
+   assert(v == w);
+  }
+  {RandGen_t g1({7,8}), g2({7,8});
+   std::vector<gen_uint_t> v(1000);
+   g1.fill(v);
+   for (const gen_uint_t x : v) assert(x == g2());
+   assert(g1 == g2);
+  }
+
   {RandGen_t g1({});
    randgen_t g2(init({}));
    assert(g1.extract() == g2);
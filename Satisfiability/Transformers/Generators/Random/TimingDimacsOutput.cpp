@@ -0,0 +1,173 @@
+// Oliver Kullmann, 16.10.2026 (Swansea)
+/* Copyright 2026 Oliver Kullmann
+This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
+it and/or modify it under the terms of the GNU General Public License as published by
+the Free Software Foundation and included in this library; either version 3 of the
+License, or any later version. */
+
+/* Timing of the output of Dimacs-clauses, via ostream versus DimacsOut
+
+Examples (annotations on following lines):
+
+The arguments and their default values:
+Random> ./TimingDimacsOutput mode=b N=3e7 n=1e6 k=3 [file]
+
+Output N clauses of length k over n variables (taken cyclically from a
+pool of 1024 random clauses, so that the creation of the clauses is not
+measured), with mode "s" via the ostream-operators, with mode "b" via
+DimacsOut (DimacsOutput.hpp).
+Without the file-argument the output goes into a stream-buffer, which
+only counts the characters and sums them up (so that the main costs
+are those of the formatting), otherwise into the file ("-cout" for
+standard output).
+
+Random> ./TimingDimacsOutput s
+# mode = s, N = 30000000, n = 1000000, k = 3
+# file = ""
+724863288 34490713238
+# the number of characters output and their sum (as unsigned 64-bit),
+# which are the same for both modes.
+
+
+Results:
+
+On vm (g++ 12.2.0, bogomips 4200):
+
+Random> time ./TimingDimacsOutput s
+724863288 34490713238
+real 5.827 user 5.749
+Random> time ./TimingDimacsOutput b
+724863288 34490713238
+real 1.884 user 1.863
+
+Random> time ./TimingDimacsOutput s 3e7 1e6 3 /tmp/out_s.cnf
+real 7.780 user 7.133
+Random> time ./TimingDimacsOutput b 3e7 1e6 3 /tmp/out_b.cnf
+real 1.741 user 1.354
+(the two files are identical).
+
+So for file-output DimacsOut is roughly 4.5 times faster (~420e6
+characters per second versus ~95e6). For BRG (option "b", where also the
+clauses need to be created) "3000000*10000,3 u,o" goes down from 1.30s
+to 0.86s.
+
+*/
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <array>
+#include <streambuf>
+
+#include <cassert>
+
+#include <Numerics/FloatingPoint.hpp>
+#include <ProgramOptions/Environment.hpp>
+
+#include "Numbers.hpp"
+#include "ClauseSets.hpp"
+#include "DimacsOutput.hpp"
+
+namespace {
+
+  const Environment::ProgramInfo proginfo{
+        "0.1.0",
+        "16.10.2026",
+        __FILE__,
+        "Oliver Kullmann",
+        "https://github.com/OKullmann/oklibrary/blob/master/Satisfiability/Transformers/Generators/Random/TimingDimacsOutput.cpp",
+        "GPL v3"};
+
+  using namespace RandGen;
+
+  constexpr gen_uint_t N_default = 3e7L;
+  constexpr gen_uint_t n_default = 1e6L;
+  constexpr gen_uint_t k_default = 3;
+  constexpr gen_uint_t pool_size = 1024;
+
+  // Only counting the characters, and summing them up:
+  class CountingBuf : public std::streambuf {
+    std::array<char, 1 << 16> buf;
+    void consume() noexcept {
+      for (const char* p = pbase(); p != pptr(); ++p)
+        sum += (unsigned char)(*p);
+      count += pptr() - pbase();
+      setp(buf.data(), buf.data() + buf.size());
+    }
+  public :
+    gen_uint_t count = 0, sum = 0;
+    CountingBuf() noexcept { setp(buf.data(), buf.data() + buf.size()); }
+    int_type overflow(const int_type c) override {
+      consume();
+      if (not traits_type::eq_int_type(c, traits_type::eof())) {
+        ++count; sum += (unsigned char)(traits_type::to_char_type(c));
+      }
+      return traits_type::not_eof(c);
+    }
+    int sync() override { consume(); return 0; }
+  };
+
+  template <class OUT>
+  void output(OUT& out, const ClauseList& F, const gen_uint_t N) {
+    for (gen_uint_t i = 0; i < N; ++i) out << F[i % F.size()];
+  }
+
+}
+
+int main(const int argc, const char* const argv[]) {
+
+  if (Environment::version_output(std::cout, proginfo, argc, argv)) return 0;
+
+  Environment::Index index;
+  const std::string mode = (argc <= index) ? "b" : argv[index++];
+  if (mode != "s" and mode != "b") {
+    std::cerr << "ERROR[" << proginfo.prg << "]: mode must be \"s\" or \"b\".\n";
+    return 1;
+  }
+  const gen_uint_t N = (argc <= index) ? N_default : FloatingPoint::toUInt(argv[index++]);
+  const gen_uint_t n = (argc <= index) ? n_default : FloatingPoint::toUInt(argv[index++]);
+  const gen_uint_t k = (argc <= index) ? k_default : FloatingPoint::toUInt(argv[index++]);
+  assert(k <= n);
+  const std::string file = (argc <= index) ? "" : argv[index++];
+  index.deactivate();
+
+  ClauseList F; F.reserve(pool_size);
+  {RandGen_t g(vec_eseed_t{n,k});
+   for (gen_uint_t i = 0; i < pool_size; ++i) {
+     Clause C; rand_clause(g, C, VarInterval(n), k, SignDist{Prob64{1,2}});
+     F.push_back(std::move(C));
+   }
+  }
+
+  if (file != "-cout")
+    std::cout << "# mode = " << mode << ", N = " << N << ", n = " << n
+              << ", k = " << k << "\n"
+              << "# file = " << Environment::qu(file) << std::endl;
+
+  CountingBuf cb;
+  std::ostream cbout(&cb);
+  std::ofstream fout;
+  std::ostream* out;
+  if (file.empty()) out = &cbout;
+  else if (file == "-cout") out = &std::cout;
+  else {
+    fout.open(file);
+    if (not fout) {
+      std::cerr << "ERROR[" << proginfo.prg << "]: can't open file "
+                << Environment::qu(file) << ".\n";
+      return 1;
+    }
+    out = &fout;
+  }
+
+  if (mode == "s") output(*out, F, N);
+  else {
+    DimacsOut dout(*out);
+    output(dout, F, N);
+    dout.flush();
+  }
+  out -> flush();
+
+  if (file.empty()) std::cout << cb.count << " " << cb.sum << "\n";
+
+}
@@ -0,0 +1,61 @@
+// Oliver Kullmann, 16.10.2026 (Swansea)
+/* Copyright 2026 Oliver Kullmann
+This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
+it and/or modify it under the terms of the GNU General Public License as published by
+the Free Software Foundation and included in this library; either version 3 of the
+License, or any later version. */
+
+/*!
+  \file OKlib/Structures/NumberTheory/PrimeNumbers/ParallelSegmentedSieve.hpp
+  \brief Multi-threaded filling of the segments of a Prime_bitset
+
+  Boost_threads_execution(T) as second argument of the construction of
+  Prime_bitset distributes the segments over T threads (via Boost::Threads;
+  thus -lboost_thread is needed for linking).
+
+  The execution-policies are also used for the blockwise computation in
+  Combinatorics/Hypergraphs/Generators/VanderWaerden.hpp.
+*/
+
+#ifndef PARALLELSEGMENTEDSIEVE_Ue4nWq8bXs
+#define PARALLELSEGMENTEDSIEVE_Ue4nWq8bXs
+
+#include <vector>
+
+#include <boost/thread.hpp>
+
+#include <OKlib/Structures/NumberTheory/PrimeNumbers/SegmentedSieve.hpp>
+
+namespace OKlib {
+  namespace Structures {
+    namespace NumberTheory {
+      namespace PrimeNumbers {
+
+        /*!
+          \class Boost_threads_execution
+          \brief Execution-policy for Prime_bitset, running the tasks in
+          parallel (the first task in the calling thread)
+        */
+
+        class Boost_threads_execution {
+          unsigned int threads_;
+        public :
+          explicit Boost_threads_execution(const unsigned int threads) : threads_((threads == 0) ? 1 : threads) {}
+          unsigned int threads() const { return threads_; }
+          template <class Task>
+          void operator()(const std::vector<Task>& tasks) const {
+            if (tasks.empty()) return;
+            boost::thread_group group;
+            for (typename std::vector<Task>::size_type i = 1; i < tasks.size(); ++i)
+              group.create_thread(tasks[i]);
+            tasks[0]();
+            group.join_all();
+          }
+        };
+
+      }
+    }
+  }
+}
+
+#endif
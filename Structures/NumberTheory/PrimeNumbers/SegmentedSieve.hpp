@@ -0,0 +1,214 @@
+// Oliver Kullmann, 16.10.2026 (Swansea)
+/* Copyright 2026 Oliver Kullmann
+This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
+it and/or modify it under the terms of the GNU General Public License as published by
+the Free Software Foundation and included in this library; either version 3 of the
+License, or any later version. */
+
+/*!
+  \file OKlib/Structures/NumberTheory/PrimeNumbers/SegmentedSieve.hpp
+  \brief Segmented sieve of Eratosthenes, providing a bitset as primality
+  oracle
+
+  Prime_bitset<UInt>(max) stores for every odd number up to max whether
+  it is prime (one bit per odd number), so that for x <= max the call
+  P(x) is an O(1) membership test (also for even x). The primes can be
+  extracted in ascending order via P.primes(out, n).
+
+  The sieving happens segment-wise: a segment consists of segment_words
+  many words (32 KB, fitting into the L1-cache), and is sieved by the odd
+  primes up to sqrt(max). The segments are independent of each other,
+  and thus can be filled in parallel: the construction takes an
+  "execution" as optional second argument, which gets a vector of nullary
+  tasks to be run (for sequential computation Sequential_execution, for
+  parallel computation see ParallelSegmentedSieve.hpp); the result is the
+  same in all cases.
+
+  nth_prime_upper_bound(n) is an upper bound on the n-th prime number
+  (for n >= 6 by Rosser's inequality p_n < n (ln n + ln ln n)).
+
+*/
+
+#ifndef SEGMENTEDSIEVE_h7TqwR3kPz
+#define SEGMENTEDSIEVE_h7TqwR3kPz
+
+#include <vector>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include <boost/cstdint.hpp>
+
+namespace OKlib {
+  namespace Structures {
+    namespace NumberTheory {
+      namespace PrimeNumbers {
+
+        typedef boost::uint64_t sieve_index_type;
+
+        /*!
+          \brief Returns an upper bound on the n-th prime number
+        */
+
+        inline sieve_index_type nth_prime_upper_bound(const sieve_index_type n) {
+          if (n < 6) return 13;
+          const double x = n, lx = std::log(x);
+          return sieve_index_type(x * (lx + std::log(lx))) + 1;
+        }
+
+        /*!
+          \class Sequential_execution
+          \brief Execution-policy for Prime_bitset, running the tasks one
+          after another
+        */
+
+        struct Sequential_execution {
+          unsigned int threads() const { return 1; }
+          template <class Task>
+          void operator()(const std::vector<Task>& tasks) const {
+            for (typename std::vector<Task>::size_type i = 0; i < tasks.size(); ++i)
+              tasks[i]();
+          }
+        };
+
+        /*!
+          \class Prime_bitset
+          \brief The prime numbers up to max, as bitset over the odd numbers
+
+          Bit i of the table corresponds to the number 2i+1.
+        */
+
+        template <typename UInt = unsigned long>
+        class Prime_bitset {
+        public :
+
+          typedef UInt uint_type;
+          typedef sieve_index_type index_type;
+          typedef boost::uint64_t word_type;
+          typedef std::vector<word_type> table_type;
+          typedef typename table_type::size_type size_type;
+
+          static const unsigned int bits_per_word = 64;
+          static const size_type segment_words = 4096;
+
+          explicit Prime_bitset(const uint_type max) : max_(max), N(odd_numbers(max)) {
+            init(Sequential_execution());
+          }
+          template <class Execution>
+          Prime_bitset(const uint_type max, const Execution& ex) : max_(max), N(odd_numbers(max)) {
+            init(ex);
+          }
+
+          uint_type max() const { return max_; }
+          size_type segments() const {
+            return (table.size() + segment_words - 1) / segment_words;
+          }
+          const table_type& bits() const { return table; }
+
+          bool operator()(const uint_type x) const {
+            assert(x <= max_);
+            if (x % 2 == 0) return x == 2;
+            const index_type i = x / 2;
+            return (table[i / bits_per_word] >> (i % bits_per_word)) & 1;
+          }
+
+          //! The number of primes <= max
+          index_type count() const {
+            index_type sum = (max_ >= 2);
+            for (size_type w = 0; w < table.size(); ++w)
+              sum += __builtin_popcountll(table[w]);
+            return sum;
+          }
+
+          //! Outputs the first min(n, count()) primes (ascending)
+          template <class OutputIterator>
+          OutputIterator primes(OutputIterator out, index_type n) const {
+            if (n == 0 or max_ < 2) return out;
+            *out = uint_type(2); ++out; --n;
+            for (size_type w = 0; w < table.size() and n != 0; ++w)
+              for (word_type bits = table[w]; bits != 0 and n != 0; bits &= bits - 1, --n) {
+                const index_type i = index_type(w) * bits_per_word + __builtin_ctzll(bits);
+                *out = uint_type(2*i+1); ++out;
+              }
+            return out;
+          }
+
+          //! Sieving the segments first, first+step, ...
+          struct Segment_task {
+            Prime_bitset* P;
+            size_type first, step;
+            Segment_task(Prime_bitset* const P, const size_type first, const size_type step) : P(P), first(first), step(step) {}
+            void operator()() const {
+              const size_type s = P -> segments();
+              for (size_type i = first; i < s; i += step) P -> sieve_segment(i);
+            }
+          };
+
+        private :
+
+          const uint_type max_;
+          const index_type N; // number of odd numbers <= max
+          table_type table;
+          std::vector<index_type> base_primes; // odd primes p with p^2 <= max
+
+          static index_type odd_numbers(const uint_type max) {
+            return (index_type(max) + 1) / 2;
+          }
+
+          template <class Execution>
+          void init(const Execution& ex) {
+            table.resize((N + bits_per_word - 1) / bits_per_word);
+            compute_base_primes();
+            const size_type s = segments();
+            if (s == 0) return;
+            const size_type T = std::max(size_type(1), std::min(size_type(ex.threads()), s));
+            std::vector<Segment_task> tasks;
+            tasks.reserve(T);
+            for (size_type t = 0; t < T; ++t) tasks.push_back(Segment_task(this, t, T));
+            ex(tasks);
+          }
+
+          void compute_base_primes() {
+            index_type r = index_type(std::sqrt(double(max_)));
+            while (r * r > index_type(max_)) --r;
+            while ((r+1) * (r+1) <= index_type(max_)) ++r;
+            std::vector<char> composite(r+1, 0);
+            for (index_type p = 3; p <= r; p += 2) {
+              if (composite[p]) continue;
+              base_primes.push_back(p);
+              for (index_type m = p*p; m <= r; m += 2*p) composite[m] = 1;
+            }
+          }
+
+          void sieve_segment(const size_type s) {
+            const size_type wb = s * segment_words;
+            const size_type we = std::min(wb + segment_words, table.size());
+            assert(wb < we);
+            std::fill(table.begin() + wb, table.begin() + we, ~word_type(0));
+            if (we == table.size() and N % bits_per_word != 0)
+              table[we-1] &= (word_type(1) << (N % bits_per_word)) - 1;
+            if (wb == 0) table[0] &= ~word_type(1); // 1 is not prime
+            const index_type L = index_type(wb) * bits_per_word;
+            const index_type R = std::min(index_type(we) * bits_per_word, N);
+            for (size_type j = 0; j < base_primes.size(); ++j) {
+              const index_type p = base_primes[j];
+              index_type i = (p*p) / 2;
+              if (i >= R) break;
+              if (i < L) i += ((L - i + p - 1) / p) * p;
+              for (; i < R; i += p)
+                table[i / bits_per_word] &= ~(word_type(1) << (i % bits_per_word));
+            }
+          }
+
+        };
+        template <typename UInt>
+        const unsigned int Prime_bitset<UInt>::bits_per_word;
+        template <typename UInt>
+        const typename Prime_bitset<UInt>::size_type Prime_bitset<UInt>::segment_words;
+
+      }
+    }
+  }
+}
+
+#endif
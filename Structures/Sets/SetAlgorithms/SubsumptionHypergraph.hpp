@@ -1,5 +1,5 @@
 // Matthew Gwynne, 29.7.2010 (Swansea)
-/* Copyright 2010, 2011 Oliver Kullmann
+/* Copyright 2010, 2011, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -28,6 +28,18 @@ License, or any later version. */
 
   The class implemented here implements the generation of such an ordered
   subsumption hypergraph given (ordered) set systems F and G.
+
+  If all sets in F are given as strictly increasing sequences, then for every
+  strictly increasing set S in G the hyperedge is computed via the
+  occurrences of the elements of F (for each element x the set of indices of
+  the sets in F containing x). If F is dense over its elements U (the
+  occurrence-bitsets are not larger than the occurrence-lists), then the sets
+  in F not subsumed by S are removed as those containing some element of U not
+  in S; otherwise the sets F_i with |F_i cap S| = |F_i| are found by counting
+  via the occurrence-lists of the elements of S. The hyperedges are
+  computed in parallel (by default using all hardware threads); the result is
+  the same as by the direct comparison of all pairs, which is still used for
+  all other sets.
   
 
   \todo Improve code quality
@@ -67,6 +79,11 @@ License, or any later version. */
 #include <algorithm>
 #include <map>
 #include <vector>
+#include <thread>
+#include <atomic>
+#include <limits>
+#include <bit>
+#include <cstdint>
 
 #include <boost/range.hpp>
 #include <boost/iterator/counting_iterator.hpp>
@@ -124,10 +141,12 @@ namespace OKlib {
       //! set in G corresponding to H.
       const set_system_type hyperedges;
 
+      //! threads = 0 means std::thread::hardware_concurrency() many threads
       Subsumption_hypergraph(const RangeF& f_range, 
-                             const RangeG& g_range):
+                             const RangeG& g_range,
+                             const unsigned threads = 0):
         vertex_set(fill_vertex_set(boost::distance(f_range))), 
-        hyperedges(subsumption_hypergraph(f_range, g_range)) {}
+        hyperedges(subsumption_hypergraph(f_range, g_range, threads)) {}
 
     private:
 
@@ -214,20 +233,212 @@ namespace OKlib {
         return(subsumes_set);
       }
 
+      //! Whether the elements of the set are strictly increasing (so that
+      //! std::includes is the subset-relation).
+      template <class RangeC>
+      static bool strictly_increasing(const RangeC& c_range) {
+        return std::adjacent_find(boost::begin(c_range), boost::end(c_range),
+          [](const auto& x, const auto& y){return not (x < y);}) ==
+          boost::end(c_range);
+      }
+
+      //! Type of the elements of the sets in F.
+      typedef typename boost::range_value<f_value_type>::type element_type;
+      //! Type of the words of the bitsets over the indices of F.
+      typedef std::uint64_t word_type;
+      static const int word_bits = std::numeric_limits<word_type>::digits;
+
+      /*!
+        \class Occurrences
+        \brief The occurrences of the elements of F
+
+        For F with strictly increasing sets: the sorted elements U of F, and
+        for each element U[k] the list of indices i of F such that U[k] is
+        element of F_i, stored as list[start[k], start[k+1]).
+
+        If the bitsets are not larger than these lists, that is, if
+        |U| * num_words <= |list| (F dense over U), then also for each U[k]
+        the bitset of these indices is stored as
+        occ[k*num_words, (k+1)*num_words), and the hyperedge for S is
+        computed by removing the sets containing elements of U not in S
+        (costing up to |U| * num_words word-operations). Otherwise
+        (F sparse over U) the sets F_i contained in S are those with
+        |F_i cap S| = |F_i|, counted via the lists of the elements of S
+        (costing up to |list| operations).
+      */
+      struct Occurrences {
+        typedef std::vector<element_type> elements_type;
+        typedef typename hyperedge_type::size_type size_type;
+        typedef std::vector<size_type> list_type;
+        const hyperedge_type& index; // the vertices of F_i
+        elements_type U;
+        list_type start, list;
+        list_type size; // |F_i|
+        list_type empty; // the i with empty F_i
+        bool dense;
+        typename std::vector<word_type>::size_type num_words;
+        std::vector<word_type> occ;
+
+        //! Per thread: the bitset "candidates" of length num_words, or the
+        //! counts of |F_i cap S| and the indices i with nonzero count.
+        struct Workspace {
+          std::vector<word_type> candidates;
+          list_type count, touched;
+        };
+
+        //! For indexed = false nothing is computed.
+        Occurrences(const RangeF& f_range, const hyperedge_type& index,
+                    const bool indexed) :
+            index(index), dense(false),
+            num_words((index.size() + word_bits - 1) / word_bits) {
+          if (not indexed) return;
+          for (const f_value_type& f : f_range)
+            U.insert(U.end(), boost::begin(f), boost::end(f));
+          std::sort(U.begin(), U.end());
+          U.erase(std::unique(U.begin(), U.end()), U.end());
+          std::vector<size_type> pos; // the positions in U
+          start.assign(U.size() + 1, 0);
+          size.reserve(index.size());
+          for (const f_value_type& f : f_range) {
+            size_type s = 0;
+            for (const element_type& x : f) {
+              pos.push_back(std::lower_bound(U.begin(), U.end(), x) - U.begin());
+              ++start[pos.back() + 1]; ++s;
+            }
+            if (s == 0) empty.push_back(size.size());
+            size.push_back(s);
+          }
+          for (size_type k = 0; k < U.size(); ++k) start[k+1] += start[k];
+          list.resize(pos.size());
+          {list_type next(start.begin(), start.end() - 1);
+           size_type p = 0;
+           for (size_type i = 0; i < size.size(); ++i)
+             for (size_type e = p + size[i]; p < e; ++p)
+               list[next[pos[p]]++] = i;
+          }
+          dense = U.size() * num_words <= list.size();
+          if (not dense) return;
+          occ.resize(U.size() * num_words);
+          for (size_type k = 0; k < U.size(); ++k)
+            for (size_type p = start[k]; p < start[k+1]; ++p)
+              occ[k * num_words + list[p] / word_bits] |=
+                word_type(1) << (list[p] % word_bits);
+        }
+
+        Workspace workspace() const {
+          Workspace w;
+          if (dense) w.candidates.resize(num_words);
+          else w.count.resize(index.size());
+          return w;
+        }
+
+        //! The hyperedge for the strictly increasing set c_range.
+        template <class RangeC>
+        hyperedge_type subsuming(const RangeC& c_range, Workspace& w) const {
+          return dense ? subsuming_dense(c_range, w.candidates) :
+            subsuming_sparse(c_range, w);
+        }
+
+        template <class RangeC>
+        hyperedge_type subsuming_dense(const RangeC& c_range,
+                                       std::vector<word_type>& candidates) const {
+          const auto n = index.size();
+          std::fill(candidates.begin(), candidates.end(), ~word_type(0));
+          if (n % word_bits != 0)
+            candidates.back() = (word_type(1) << (n % word_bits)) - 1;
+          // Removing the sets containing elements not in c_range:
+          auto it = boost::begin(c_range);
+          const auto end = boost::end(c_range);
+          for (typename elements_type::size_type k = 0; k < U.size(); ++k) {
+            while (it != end and *it < U[k]) ++it;
+            if (it != end and not (U[k] < *it)) continue;
+            const word_type* const o = &occ[k * num_words];
+            for (typename std::vector<word_type>::size_type j = 0; j < num_words; ++j)
+              candidates[j] &= ~o[j];
+          }
+          hyperedge_type edge;
+          {typename hyperedge_type::size_type size = 0;
+           for (const word_type x : candidates) size += std::popcount(x);
+           edge.reserve(size);
+          }
+          for (typename std::vector<word_type>::size_type j = 0; j < num_words; ++j)
+            for (word_type x = candidates[j]; x != 0; x &= x - 1)
+              edge.push_back(index[j * word_bits + std::countr_zero(x)]);
+          return edge;
+        }
+
+        template <class RangeC>
+        hyperedge_type subsuming_sparse(const RangeC& c_range,
+                                        Workspace& w) const {
+          list_type& count = w.count;
+          list_type& touched = w.touched;
+          touched.clear();
+          auto u = U.begin();
+          for (const auto& x : c_range) {
+            u = std::lower_bound(u, U.end(), x);
+            if (u == U.end()) break;
+            if (x < *u) continue;
+            const size_type k = u - U.begin();
+            for (size_type p = start[k]; p < start[k+1]; ++p)
+              if (count[list[p]]++ == 0) touched.push_back(list[p]);
+          }
+          list_type hits(empty);
+          for (const size_type i : touched) {
+            if (count[i] == size[i]) hits.push_back(i);
+            count[i] = 0;
+          }
+          std::sort(hits.begin(), hits.end());
+          hyperedge_type edge;
+          edge.reserve(hits.size());
+          for (const size_type i : hits) edge.push_back(index[i]);
+          return edge;
+        }
+      };
+
       //! Given the input ranges computes the hyperedges of the subsumption 
-      //! hypergraph.
+      //! hypergraph, using threads many threads.
       static const set_system_type subsumption_hypergraph(const RangeF& f_range,
-                                                          const RangeG& g_range) {
-        set_system_type hyperedges;
-        for (
-             struct {
-               g_iterator_type it;
-               const g_iterator_type end;
-               const hyperedge_map_type map;
-             } g = {boost::begin(g_range), boost::end(g_range), 
-                    fill_hyperedge_map(f_range)};
-             g.it != g.end; ++g.it)
-          hyperedges.push_back(standardise_hyperedge(all_subsuming(*g.it, f_range), g.map));
+                                                          const RangeG& g_range,
+                                                          const unsigned threads) {
+        const hyperedge_map_type map = fill_hyperedge_map(f_range);
+        hyperedge_type index; // index[i] is the vertex for F_i
+        bool indexed = true;
+        for (const f_value_type& f : f_range) {
+          index.push_back(map.find(f)->second);
+          indexed = indexed and strictly_increasing(f);
+        }
+        std::vector<g_iterator_type> G;
+        for (g_iterator_type it = boost::begin(g_range); it != boost::end(g_range); ++it)
+          G.push_back(it);
+        set_system_type hyperedges(G.size());
+        if (G.empty()) return hyperedges;
+        const Occurrences O(f_range, index, indexed);
+
+        // The hyperedges for G[b, e):
+        const auto compute = [&](const std::size_t b, const std::size_t e) {
+          typename Occurrences::Workspace w;
+          if (indexed) w = O.workspace();
+          for (std::size_t j = b; j < e; ++j)
+            if (indexed and strictly_increasing(*G[j]))
+              hyperedges[j] = O.subsuming(*G[j], w);
+            else
+              hyperedges[j] = standardise_hyperedge(all_subsuming(*G[j], f_range), map);
+        };
+        const std::size_t block = 256,
+          num_blocks = (G.size() + block - 1) / block;
+        const unsigned T = std::min<std::size_t>(num_blocks,
+          threads != 0 ? threads : std::max(1u, std::thread::hardware_concurrency()));
+        if (T <= 1) compute(0, G.size());
+        else {
+          std::atomic<std::size_t> next(0);
+          std::vector<std::thread> workers;
+          for (unsigned t = 0; t < T; ++t)
+            workers.emplace_back([&]{
+              for (std::size_t u; (u = next++) < num_blocks;)
+                compute(u * block, std::min(G.size(), (u+1) * block));
+            });
+          for (std::thread& w : workers) w.join();
+        }
         return hyperedges;
       }
     };
@@ -252,14 +463,17 @@ namespace OKlib {
                      i.e., the list of sets which subsumes elements of g_range.
       @param g_range the list of sets which are mapped to hyperedges, i.e., 
                       the sets which are subsumed by elements of f_range.
+      @param threads the number of threads used (0 means
+                     std::thread::hardware_concurrency()).
       @return the std::vector of hyperedges in the subsumption hypergraph of 
               f_range (subsuming sets) w.r.t g_range (subsumed sets).
     */
 
     template<class RangeF, class RangeG>
     typename Subsumption_hypergraph<RangeF, RangeG>::set_system_type
-    subsumption_hypergraph(const RangeF& f_range, const RangeG& g_range) {
-      Subsumption_hypergraph<RangeF, RangeG> sub_hyp(f_range,g_range);
+    subsumption_hypergraph(const RangeF& f_range, const RangeG& g_range,
+                           const unsigned threads = 0) {
+      Subsumption_hypergraph<RangeF, RangeG> sub_hyp(f_range,g_range,threads);
       return sub_hyp.hyperedges;
     }
 
@@ -9,5 +9,5 @@ programs := SubsumptionHypergraph
 
 source_libraries =  $(boost_include_option_okl)
 
-link_libraries := 
+link_libraries := -pthread
 
@@ -1,5 +1,5 @@
 // Matthew Gwynne, 15.9.2010 (Swansea)
-/* Copyright 2010, 2011 Oliver Kullmann
+/* Copyright 2010, 2011, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -29,6 +29,21 @@ License, or any later version. */
   </ul>
 
   
+  \todo DONE Indexed construction
+  <ul>
+   <li> Comparing every set in F with every set in G is quadratic. </li>
+   <li> Now, if all sets in F are strictly increasing, for every element x of
+   F the bitset of (indices of) sets in F containing x is computed. </li>
+   <li> For a strictly increasing set S in G then the sets of F subsumed
+   by S are obtained by removing from all of F the bitsets of the elements
+   of F not in S (running through 64 sets at once). </li>
+   <li> For all other sets the direct comparison (via std::includes) is
+   used, so that the output is always the same as before. </li>
+   <li> A trie over F should be considered if the number of elements of F is
+   large (while F is small). </li>
+  </ul>
+
+
   \todo Offering live subsumption hypergraph generation
   <ul>
    <li> The subsumption hypergraph for some inputs will be very large,
@@ -55,6 +70,11 @@ License, or any later version. */
    default parameter to the subsumption hypergraph generator, as knowledge
    that the problem is splittable in this way is something that belongs
    to the algorithm, not the user. </li>
+   <li> DONE Parallel processing is now available, via std::thread (the
+   number of threads is the additional parameter "threads" of the generator,
+   with default 0 meaning std::thread::hardware_concurrency()); the
+   subsumed sets are split into blocks of 256, taken by the threads in
+   turn, and the hyperedges are written to their final positions. </li>
    <li> To combine these two techniques, there is the possibility of having
    an additional thread utilised by a class handling the hyperedge set, such
    that any call to the hyperedge set results in the hyperedge being added
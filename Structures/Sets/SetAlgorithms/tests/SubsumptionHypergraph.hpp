@@ -1,5 +1,5 @@
 // Matthew Gwynne, 12.8.2010 (Swansea)
-/* Copyright 2010, 2011 Oliver Kullmann
+/* Copyright 2010, 2011, 2026 Oliver Kullmann
 This file is part of the OKlibrary. OKlibrary is free software; you can redistribute
 it and/or modify it under the terms of the GNU General Public License as published by
 the Free Software Foundation and included in this library; either version 3 of the
@@ -73,6 +73,35 @@ namespace OKlib {
             const hypergraph_type example_output = hypergraph_type(hg_F, hg_G);
             OKLIB_TEST_EQUAL_W2(example_output.hyperedges, intended_output);
           }
+          { // several threads, and sets not strictly increasing
+            const hypergraph_G_type hg_F = boost::assign::list_of
+              (boost::assign::list_of(1)(2))
+              (boost::assign::list_of(2)(4))
+              (boost::assign::list_of(3));
+            hypergraph_G_type hg_G;
+            for (int i = 0; i < 1000; ++i)
+              hg_G.push_back(boost::assign::list_of(1)(2)(3)(4));
+            hg_G.push_back(boost::assign::list_of(2)(2)(4));
+            hypergraph_output_type intended_output(1000, boost::assign::list_of(1)(2)(3));
+            intended_output.push_back(boost::assign::list_of(2));
+            const hypergraph_type example_output = hypergraph_type(hg_F, hg_G, 3);
+            OKLIB_TEST_EQUAL_W2(example_output.hyperedges, intended_output);
+          }
+          { // F sparse over its elements (counting via occurrence-lists)
+            hypergraph_F_type hg_F(1);
+            for (int i = 1; i <= 100; ++i)
+              hg_F.push_back(boost::assign::list_of(i)(i+1000));
+            const hypergraph_G_type hg_G = boost::assign::list_of
+              (boost::assign::list_of(1)(2)(5)(1001)(1002))
+              (boost::assign::list_of(3)(1003))
+              (boost::assign::list_of(7));
+            const hypergraph_output_type intended_output = boost::assign::list_of
+              (boost::assign::list_of(1)(2)(3))
+              (boost::assign::list_of(1)(4))
+              (boost::assign::list_of(1));
+            const hypergraph_type example_output = hypergraph_type(hg_F, hg_G);
+            OKLIB_TEST_EQUAL_W2(example_output.hyperedges, intended_output);
+          }
         }
       };
     }